@@ -19,6 +19,7 @@
 
 #include "zex_driver.h"
 #include "zex_memory.h"
+#include "zex_metric.h"
 #include "zex_module.h"
 
 #endif // _ZEX_API_H
@@ -52,4 +52,22 @@ zexCommandListAppendWriteToMemory(
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListFlushPendingCommands(
+    zex_command_list_handle_t hCommandList) {
+    try {
+        {
+            if (nullptr == hCommandList)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->flushPendingCommands();
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
 } // namespace L0
@@ -24,4 +24,7 @@ zexCommandListAppendWriteToMemory(
     zex_write_to_mem_desc_t *desc,
     void *ptr,
     uint64_t data);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListFlushPendingCommands(
+    zex_command_list_handle_t hCommandList);
 } // namespace L0
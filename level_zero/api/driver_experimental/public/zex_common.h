@@ -54,6 +54,16 @@ typedef struct _zex_write_to_mem_desc_t {
     zex_mem_action_scope_flags_t writeScope;
 } zex_write_to_mem_desc_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Contiguous batch of metric reports streamed into user ring buffer
+typedef struct _zex_metric_streamed_batch_t {
+    uint64_t offset;           ///< byte offset of the batch within the ring buffer
+    uint64_t size;             ///< batch size in bytes, multiple of the report size
+    uint64_t firstReportIndex; ///< sequence number of the first report in the batch
+    uint32_t reportCount;      ///< number of reports in the batch
+    uint32_t setIndex;         ///< sub-device index for multi-device streamers, 0 otherwise
+} zex_metric_streamed_batch_t;
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
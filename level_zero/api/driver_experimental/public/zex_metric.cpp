@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/api/driver_experimental/public/zex_metric.h"
+
+#include "level_zero/tools/source/metrics/metric.h"
+
+#include <vector>
+
+namespace L0 {
+
+ze_result_t ZE_APICALL
+zexMetricStreamerStartStreaming(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    void *pRingBuffer,
+    size_t ringBufferSize) {
+    if (nullptr == hMetricStreamer) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (nullptr == pRingBuffer) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    return L0::MetricStreamer::fromHandle(hMetricStreamer)->startStreaming(static_cast<uint8_t *>(pRingBuffer), ringBufferSize);
+}
+
+ze_result_t ZE_APICALL
+zexMetricStreamerStopStreaming(
+    zet_metric_streamer_handle_t hMetricStreamer) {
+    if (nullptr == hMetricStreamer) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    L0::MetricStreamer::fromHandle(hMetricStreamer)->stopStreaming();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zexMetricStreamerGetStreamedBatches(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    uint32_t *pCount,
+    zex_metric_streamed_batch_t *pBatches) {
+    if (nullptr == hMetricStreamer) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (nullptr == pCount || (*pCount > 0 && nullptr == pBatches)) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    auto streamingReader = L0::MetricStreamer::fromHandle(hMetricStreamer)->getStreamingReader();
+    if (streamingReader == nullptr) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+    if (*pCount == 0) {
+        return streamingReader->getBatches(pCount, nullptr);
+    }
+
+    std::vector<MetricStreamedBatch> batches(*pCount);
+    const auto result = streamingReader->getBatches(pCount, batches.data());
+    for (uint32_t i = 0; i < *pCount; i++) {
+        pBatches[i].offset = batches[i].offset;
+        pBatches[i].size = batches[i].size;
+        pBatches[i].firstReportIndex = batches[i].firstReportIndex;
+        pBatches[i].reportCount = batches[i].reportCount;
+        pBatches[i].setIndex = batches[i].setIndex;
+    }
+    return result;
+}
+
+ze_result_t ZE_APICALL
+zexMetricStreamerGetReportTimestamps(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    const zex_metric_streamed_batch_t *pBatch,
+    uint64_t *pTimestamps) {
+    if (nullptr == hMetricStreamer) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (nullptr == pBatch || nullptr == pTimestamps) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    auto streamingReader = L0::MetricStreamer::fromHandle(hMetricStreamer)->getStreamingReader();
+    if (streamingReader == nullptr) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    MetricStreamedBatch batch = {};
+    batch.offset = pBatch->offset;
+    batch.size = pBatch->size;
+    batch.firstReportIndex = pBatch->firstReportIndex;
+    batch.reportCount = pBatch->reportCount;
+    batch.setIndex = pBatch->setIndex;
+    return streamingReader->getReportTimestamps(batch, pTimestamps);
+}
+
+ze_result_t ZE_APICALL
+zexMetricStreamerReleaseStreamedBatches(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    uint32_t count) {
+    if (nullptr == hMetricStreamer) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    auto streamingReader = L0::MetricStreamer::fromHandle(hMetricStreamer)->getStreamingReader();
+    if (streamingReader == nullptr) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+    return streamingReader->releaseBatches(count);
+}
+
+} // namespace L0
+
+extern "C" {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexMetricStreamerStartStreaming(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    void *pRingBuffer,
+    size_t ringBufferSize) {
+    return L0::zexMetricStreamerStartStreaming(hMetricStreamer, pRingBuffer, ringBufferSize);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexMetricStreamerStopStreaming(
+    zet_metric_streamer_handle_t hMetricStreamer) {
+    return L0::zexMetricStreamerStopStreaming(hMetricStreamer);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexMetricStreamerGetStreamedBatches(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    uint32_t *pCount,
+    zex_metric_streamed_batch_t *pBatches) {
+    return L0::zexMetricStreamerGetStreamedBatches(hMetricStreamer, pCount, pBatches);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexMetricStreamerGetReportTimestamps(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    const zex_metric_streamed_batch_t *pBatch,
+    uint64_t *pTimestamps) {
+    return L0::zexMetricStreamerGetReportTimestamps(hMetricStreamer, pBatch, pTimestamps);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexMetricStreamerReleaseStreamedBatches(
+    zet_metric_streamer_handle_t hMetricStreamer,
+    uint32_t count) {
+    return L0::zexMetricStreamerReleaseStreamedBatches(hMetricStreamer, count);
+}
+}
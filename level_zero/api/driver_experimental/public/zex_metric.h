@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef _ZEX_METRIC_H
+#define _ZEX_METRIC_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+#include <level_zero/zet_api.h>
+
+namespace L0 {
+
+ze_result_t ZE_APICALL
+zexMetricStreamerStartStreaming(
+    zet_metric_streamer_handle_t hMetricStreamer, ///< [in] handle of the metric streamer
+    void *pRingBuffer,                            ///< [in] ring buffer the reports are streamed into
+    size_t ringBufferSize                         ///< [in] size of the ring buffer in bytes
+);
+
+ze_result_t ZE_APICALL
+zexMetricStreamerStopStreaming(
+    zet_metric_streamer_handle_t hMetricStreamer ///< [in] handle of the metric streamer
+);
+
+ze_result_t ZE_APICALL
+zexMetricStreamerGetStreamedBatches(
+    zet_metric_streamer_handle_t hMetricStreamer, ///< [in] handle of the metric streamer
+    uint32_t *pCount,                             ///< [in,out] number of batches, if zero returns number of available batches
+    zex_metric_streamed_batch_t *pBatches         ///< [in,out][optional] batches available in the ring buffer, oldest first
+);
+
+ze_result_t ZE_APICALL
+zexMetricStreamerGetReportTimestamps(
+    zet_metric_streamer_handle_t hMetricStreamer, ///< [in] handle of the metric streamer
+    const zex_metric_streamed_batch_t *pBatch,    ///< [in] batch which was not released yet
+    uint64_t *pTimestamps                         ///< [out] host timestamp in nanoseconds of every report in the batch
+);
+
+ze_result_t ZE_APICALL
+zexMetricStreamerReleaseStreamedBatches(
+    zet_metric_streamer_handle_t hMetricStreamer, ///< [in] handle of the metric streamer
+    uint32_t count                                ///< [in] number of oldest batches whose ring buffer space can be reused
+);
+
+} // namespace L0
+
+#endif // _ZEX_METRIC_H
@@ -21,6 +21,7 @@
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/event/event_batch_query.h"
 #include "level_zero/core/source/kernel/kernel.h"
 
 namespace L0 {
@@ -186,6 +187,10 @@ bool CommandList::setupTimestampEventForMultiTile(Event *signalEvent) {
 }
 
 void CommandList::synchronizeEventList(uint32_t numWaitEvents, ze_event_handle_t *waitEventList) {
+    if (NEO::DebugManager.flags.EnableBatchedEventSynchronization.get() == 1) {
+        EventBatchQuery::hostSynchronizeAll(numWaitEvents, waitEventList, std::numeric_limits<uint64_t>::max());
+        return;
+    }
     for (uint32_t i = 0; i < numWaitEvents; i++) {
         Event *event = Event::fromHandle(waitEventList[i]);
         event->hostSynchronize(std::numeric_limits<uint64_t>::max());
@@ -150,6 +150,9 @@ struct CommandList : _ze_command_list_handle_t {
 
     virtual ze_result_t reserveSpace(size_t size, void **ptr) = 0;
     virtual ze_result_t reset() = 0;
+    virtual ze_result_t flushPendingCommands() { return ZE_RESULT_SUCCESS; }
+    // Called by PendingCommandsFlusher, returns ZE_RESULT_NOT_READY when commands stay pending and the list stays registered.
+    virtual ze_result_t flushRegisteredPendingCommands(bool expiredOnly) { return ZE_RESULT_SUCCESS; }
 
     virtual ze_result_t appendMetricMemoryBarrier() = 0;
     virtual ze_result_t appendMetricStreamerMarker(zet_metric_streamer_handle_t hMetricStreamer,
@@ -2672,7 +2672,10 @@ bool CommandListCoreFamily<gfxCoreFamily>::isAppendSplitNeeded(void *dstPtr, con
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 inline bool CommandListCoreFamily<gfxCoreFamily>::isAppendSplitNeeded(NEO::MemoryPool dstPool, NEO::MemoryPool srcPool, size_t size, NEO::TransferDirection &directionOut) {
-    constexpr size_t minimalSizeForBcsSplit = 4 * MemoryConstants::megaByte;
+    size_t minimalSizeForBcsSplit = 4 * MemoryConstants::megaByte;
+    if (NEO::DebugManager.flags.SplitBcsSize.get() > 0) {
+        minimalSizeForBcsSplit = static_cast<size_t>(NEO::DebugManager.flags.SplitBcsSize.get());
+    }
 
     directionOut = NEO::createTransferDirection(!NEO::MemoryPoolHelper::isSystemMemoryPool(srcPool), !NEO::MemoryPoolHelper::isSystemMemoryPool(dstPool));
 
@@ -12,6 +12,10 @@
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 
 #include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace NEO {
 struct SvmAllocationData;
@@ -23,6 +27,7 @@ namespace L0 {
 
 struct EventPool;
 struct Event;
+class PendingCommandsFlusher;
 inline constexpr size_t maxImmediateCommandSize = 4 * MemoryConstants::kiloByte;
 
 struct CpuMemCopyInfo {
@@ -43,6 +48,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     using BaseClass::executeCommandListImmediate;
     using BaseClass::isCopyOnly;
 
+    ~CommandListCoreFamilyImmediate() override;
+
     ze_result_t appendLaunchKernel(ze_kernel_handle_t kernelHandle,
                                    const ze_group_count_t *threadGroupDimensions,
                                    ze_event_handle_t hEvent, uint32_t numWaitEvents,
@@ -147,7 +154,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     NEO::CompletionStamp flushRegularTask(NEO::LinearStream &cmdStreamTask, size_t taskStartOffset, bool hasStallingCmds, bool hasRelaxedOrderingDependencies);
     NEO::CompletionStamp flushBcsTask(NEO::LinearStream &cmdStreamTask, size_t taskStartOffset, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, NEO::CommandStreamReceiver *csr);
 
-    void checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies);
+    ze_result_t checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies);
     void updateDispatchFlagsWithRequiredStreamState(NEO::DispatchFlags &dispatchFlags);
 
     ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, ze_event_handle_t hSignalEvent);
@@ -160,6 +167,10 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     bool isSuitableUSMDeviceAlloc(NEO::SvmAllocationData *alloc);
     bool isSuitableUSMSharedAlloc(NEO::SvmAllocationData *alloc);
     ze_result_t performCpuMemcpy(const CpuMemCopyInfo &cpuMemCopyInfo, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    bool preferCpuImageCopy(Image *image, const ze_image_region_t *pRegion, ze_image_region_t &cpuCopyRegion);
+    ze_result_t performCpuImageCopyFromMemory(Image *image, const void *srcPtr, const ze_image_region_t &region, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    bool preferStagingCopy(const CpuMemCopyInfo &cpuMemCopyInfo);
+    ze_result_t performStagingCopy(const CpuMemCopyInfo &cpuMemCopyInfo, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
     void *obtainLockedPtrFromDevice(NEO::SvmAllocationData *alloc, void *ptr, bool &lockingFailed);
     bool waitForEventsFromHost();
     void checkWaitEventsState(uint32_t numWaitEvents, ze_event_handle_t *waitEventList);
@@ -167,10 +178,79 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     size_t getTransferThreshold(TransferType transferType);
     bool isBarrierRequired();
 
+    ze_result_t flushPendingCommands() override;
+    ze_result_t flushRegisteredPendingCommands(bool expiredOnly) override;
+    ze_result_t flushCoalescedCommands();
+    ze_result_t flushReplayedLaunches();
+    ze_result_t destroy() override;
+
+    struct LaunchReplayStatistics {
+        uint64_t hitCount = 0;
+        uint64_t missCount = 0;
+        uint64_t reencodeCount = 0;
+    };
+    const LaunchReplayStatistics &getLaunchReplayStatistics() const { return launchReplayStatistics; }
+
   protected:
+    struct RecordedLaunch {
+        ~RecordedLaunch();
+
+        bool matches(Kernel &kernel, const ze_group_count_t &groupCount) const;
+        void capture(Kernel &kernel, const ze_group_count_t &groupCount);
+
+        CommandList *commandList = nullptr;
+        const Kernel *kernel = nullptr;
+        const void *kernelImmData = nullptr;
+        uint64_t kernelStateVersion = 0;
+        ze_group_count_t groupCount = {};
+        TaskCountType lastUsedTaskCount = 0;
+        uint64_t lastUsedSequence = 0;
+    };
+
+    struct CoalescedDispatchState {
+        int32_t numGrfRequired = 0;
+        int32_t threadArbitrationPolicy = 0;
+        bool systolicPipelineSelectMode = false;
+        bool fusedEuDisabled = false;
+        bool requiresUncachedMocs = false;
+
+        bool operator==(const CoalescedDispatchState &other) const {
+            return numGrfRequired == other.numGrfRequired && threadArbitrationPolicy == other.threadArbitrationPolicy &&
+                   systolicPipelineSelectMode == other.systolicPipelineSelectMode && fusedEuDisabled == other.fusedEuDisabled &&
+                   requiresUncachedMocs == other.requiresUncachedMocs;
+        }
+    };
+
     void printKernelsPrintfOutput(bool hangDetected);
     MOCKABLE_VIRTUAL void checkAssert();
+    bool isCoalescedFlushAllowed(Kernel *kernel, const ze_group_count_t *threadGroupDimensions, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
+                                 bool relaxedOrderingDispatch, const CmdListKernelLaunchParams &launchParams, CoalescedDispatchState &dispatchState);
+    bool isCoalescedFlushThresholdReached();
+    bool isCoalescedFlushDelayExpired();
+    void registerCoalescedCommands();
+    void unregisterCoalescedCommands();
+    bool isLaunchReplayAllowed(Kernel *kernel, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
+                               bool relaxedOrderingDispatch, const CmdListKernelLaunchParams &launchParams);
+    ze_result_t appendReplayedLaunch(Kernel *kernel, const ze_group_count_t &threadGroupDimensions, const CmdListKernelLaunchParams &launchParams);
+    RecordedLaunch *recordLaunch(Kernel *kernel, const ze_group_count_t &threadGroupDimensions, const CmdListKernelLaunchParams &launchParams, ze_result_t &result);
+    void evictRecordedLaunch();
+    void releaseCompletedRetiredLaunches();
+    void releaseRecordedLaunches();
     std::atomic<bool> dependenciesPresent{false};
+
+    CoalescedDispatchState coalescedDispatchState{};
+    std::chrono::steady_clock::time_point coalescedCommandsStartTime{};
+    std::atomic<uint32_t> coalescedCommandCount{0};
+    bool coalescingKernelAppend = false;
+    // Guards coalesced commands against submission by PendingCommandsFlusher from other threads.
+    std::recursive_mutex coalescedCommandsMutex;
+    PendingCommandsFlusher *pendingCommandsFlusher = nullptr;
+
+    std::vector<std::unique_ptr<RecordedLaunch>> recordedLaunches;
+    std::vector<std::unique_ptr<RecordedLaunch>> retiredLaunches;
+    std::vector<RecordedLaunch *> pendingReplayedLaunches;
+    LaunchReplayStatistics launchReplayStatistics;
+    uint64_t launchReplaySequence = 0;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
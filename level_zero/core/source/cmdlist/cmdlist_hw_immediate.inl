@@ -16,15 +16,21 @@
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/completion_stamp.h"
+#include "shared/source/helpers/cpu_memcpy.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/tiled_image_copy.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
+#include "level_zero/core/source/cmdlist/pending_commands_flusher.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_hw.h"
 #include "level_zero/core/source/device/bcs_split.h"
+#include "level_zero/core/source/device/staging_buffer_pool.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/helpers/error_code_helper_l0.h"
+#include "level_zero/core/source/image/image.h"
 
 #include "encode_surface_state_args.h"
 
@@ -36,18 +42,36 @@ NEO::LogicalStateHelper *CommandListCoreFamilyImmediate<gfxCoreFamily>::getLogic
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
-void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies) {
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies) {
     this->commandContainer.fillReusableAllocationLists();
 
+    const bool swapStreamsRequired = (hasRelaxedOrderingDependencies == NEO::MemoryPoolHelper::isSystemMemoryPool(this->commandContainer.getCommandStream()->getGraphicsAllocation()->getMemoryPool()));
+    size_t semaphoreSize = NEO::EncodeSemaphore<GfxFamily>::getSizeMiSemaphoreWait() * numEvents;
+
+    if (!this->pendingReplayedLaunches.empty()) {
+        auto ret = this->flushReplayedLaunches();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+
+    // Coalesced commands must be submitted before any other command is appended and before their command buffer is switched.
+    if (this->coalescedCommandCount > 0 &&
+        (!this->coalescingKernelAppend || swapStreamsRequired || this->commandContainer.getCommandStream()->getAvailableSpace() < maxImmediateCommandSize + semaphoreSize)) {
+        auto ret = this->flushCoalescedCommands();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+
     /* Command container might has two command buffers. If it has, one is in local memory, because relaxed ordering requires that and one in system for copying it into ring buffer.
        If relaxed ordering is needed in given dispatch and current command stream is in system memory, swap of command streams is required to ensure local memory. Same in the opposite scenario. */
-    if (hasRelaxedOrderingDependencies == NEO::MemoryPoolHelper::isSystemMemoryPool(this->commandContainer.getCommandStream()->getGraphicsAllocation()->getMemoryPool())) {
+    if (swapStreamsRequired) {
         if (this->commandContainer.swapStreams()) {
             this->cmdListCurrentStartOffset = this->commandContainer.getCommandStream()->getUsed();
         }
     }
 
-    size_t semaphoreSize = NEO::EncodeSemaphore<GfxFamily>::getSizeMiSemaphoreWait() * numEvents;
     if (this->commandContainer.getCommandStream()->getAvailableSpace() < maxImmediateCommandSize + semaphoreSize) {
         bool requireSystemMemoryCommandBuffer = !hasRelaxedOrderingDependencies;
 
@@ -61,6 +85,7 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
         this->commandContainer.setCmdBuffer(alloc);
         this->cmdListCurrentStartOffset = 0;
     }
+    return ZE_RESULT_SUCCESS;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -270,6 +295,10 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
         return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
     }
 
+    for (auto kernel : this->printfKernelContainer) {
+        kernel->setPrintfTaskCountToWait(csr, completionStamp.taskCount);
+    }
+
     if (this->isSyncModeQueue || this->printfKernelContainer.size() > 0u) {
         auto timeoutMicroseconds = NEO::TimeoutControls::maxTimeout;
         const auto waitStatus = csr->waitForCompletionWithTimeout(NEO::WaitParams{false, false, timeoutMicroseconds}, completionStamp.taskCount);
@@ -329,8 +358,26 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
 
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
+    if (threadGroupDimensions && isLaunchReplayAllowed(Kernel::fromHandle(kernelHandle), hSignalEvent, numWaitEvents, relaxedOrderingDispatch, launchParams)) {
+        return appendReplayedLaunch(Kernel::fromHandle(kernelHandle), *threadGroupDimensions, launchParams);
+    }
+
+    std::unique_lock<std::recursive_mutex> coalescedCommandsLock(this->coalescedCommandsMutex, std::defer_lock);
+    if (NEO::DebugManager.flags.EnableImmediateCmdListCoalescedFlush.get() == 1) {
+        coalescedCommandsLock.lock();
+    }
+
+    CoalescedDispatchState dispatchState;
+    const bool coalesce = isCoalescedFlushAllowed(Kernel::fromHandle(kernelHandle), threadGroupDimensions, hSignalEvent, numWaitEvents,
+                                                  relaxedOrderingDispatch, launchParams, dispatchState);
+
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        this->coalescingKernelAppend = coalesce;
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        this->coalescingKernelAppend = false;
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
     }
     bool hostWait = waitForEventsFromHost();
     if (hostWait || this->eventWaitlistSyncRequired()) {
@@ -344,6 +391,21 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(kernelHandle, threadGroupDimensions,
                                                                         hSignalEvent, numWaitEvents, phWaitEvents,
                                                                         launchParams, relaxedOrderingDispatch);
+
+    if (coalesce && ret == ZE_RESULT_SUCCESS && this->printfKernelContainer.empty() && !this->kernelWithAssertAppended) {
+        if (this->coalescedCommandCount++ == 0) {
+            this->coalescedDispatchState = dispatchState;
+            this->coalescedCommandsStartTime = std::chrono::steady_clock::now();
+            registerCoalescedCommands();
+        }
+        if (!isCoalescedFlushThresholdReached()) {
+            return ZE_RESULT_SUCCESS;
+        }
+    } else if (ret != ZE_RESULT_SUCCESS) {
+        this->flushCoalescedCommands();
+    }
+    this->coalescedCommandCount = 0;
+    unregisterCoalescedCommands();
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
 }
 
@@ -354,7 +416,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelInd
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -371,7 +436,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, false);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, false);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
     ret = CommandListCoreFamily<gfxCoreFamily>::appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents);
@@ -391,7 +459,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -404,6 +475,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
         if (ret == ZE_RESULT_SUCCESS || ret == ZE_RESULT_ERROR_DEVICE_LOST) {
             return ret;
         }
+    } else if (preferStagingCopy(cpuMemCopyInfo)) {
+        ret = performStagingCopy(cpuMemCopyInfo, hSignalEvent, numWaitEvents, phWaitEvents);
+        if (ret != ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY) {
+            return ret;
+        }
     }
 
     NEO::TransferDirection direction;
@@ -436,7 +512,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -477,7 +556,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -492,7 +574,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(0, false);
+        auto checkSpaceResult = checkAvailableSpace(0, false);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
     }
     ret = CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEvent);
     return flushImmediate(ret, true, true, false, hSignalEvent);
@@ -504,7 +589,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_e
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(0, false);
+        auto checkSpaceResult = checkAvailableSpace(0, false);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
     }
     ret = CommandListCoreFamily<gfxCoreFamily>::appendEventReset(hSignalEvent);
     return flushImmediate(ret, true, true, false, hSignalEvent);
@@ -516,7 +604,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
                                                                                size_t size, bool flushHost) {
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(0, false);
+        auto checkSpaceResult = checkAvailableSpace(0, false);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
     }
 
     ze_result_t ret;
@@ -552,7 +643,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(ui
         return ZE_RESULT_SUCCESS;
     }
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numEvents, false);
+        auto checkSpaceResult = checkAvailableSpace(numEvents, false);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numEvents, phWaitEvents);
     }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(numEvents, phWaitEvents, relaxedOrderingAllowed, trackDependencies);
@@ -566,7 +660,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTime
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, false);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, false);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
@@ -604,7 +701,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -621,10 +721,22 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    ze_image_region_t cpuCopyRegion = {};
+    if (preferCpuImageCopy(Image::fromHandle(hDstImage), pDstRegion, cpuCopyRegion)) {
+        auto ret = flushPendingCommands();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+        return performCpuImageCopyFromMemory(Image::fromHandle(hDstImage), srcPtr, cpuCopyRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -645,7 +757,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
@@ -663,7 +778,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
                                                                                      uint32_t numWaitEvents,
                                                                                      ze_event_handle_t *phWaitEvents) {
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, false);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, false);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
@@ -679,7 +797,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
     relaxedOrderingDispatch = NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
-        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        auto checkSpaceResult = checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch);
+        if (checkSpaceResult != ZE_RESULT_SUCCESS) {
+            return checkSpaceResult;
+        }
         checkWaitEventsState(numWaitEvents, waitEventHandles);
     }
 
@@ -703,6 +824,313 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
     return inputRet;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isCoalescedFlushAllowed(Kernel *kernel, const ze_group_count_t *threadGroupDimensions, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
+                                                                            bool relaxedOrderingDispatch, const CmdListKernelLaunchParams &launchParams, CoalescedDispatchState &dispatchState) {
+    if (NEO::DebugManager.flags.EnableImmediateCmdListCoalescedFlush.get() != 1) {
+        return false;
+    }
+
+    // Only plain kernel launches without host visible dependencies are coalesced.
+    if (!this->isFlushTaskSubmissionEnabled || this->isSyncModeQueue || isCopyOnly() || kernel == nullptr ||
+        hSignalEvent != nullptr || numWaitEvents > 0 || relaxedOrderingDispatch ||
+        launchParams.isCooperative || launchParams.isIndirect || launchParams.isPredicate || launchParams.isBuiltInKernel || launchParams.isKernelSplitOperation) {
+        return false;
+    }
+
+    // Coalesced kernels are submitted with a single set of dispatch flags, so they have to require the same state.
+    const auto &kernelAttributes = kernel->getKernelDescriptor().kernelAttributes;
+    dispatchState.numGrfRequired = static_cast<int32_t>(kernelAttributes.numGrfRequired);
+    dispatchState.threadArbitrationPolicy = static_cast<int32_t>(kernelAttributes.threadArbitrationPolicy);
+    dispatchState.systolicPipelineSelectMode = kernelAttributes.flags.usesSystolicPipelineSelectMode;
+    dispatchState.fusedEuDisabled = getFusedEuDisabled<gfxCoreFamily>(*kernel, this->device, threadGroupDimensions, false);
+    dispatchState.requiresUncachedMocs = static_cast<KernelImp *>(kernel)->getKernelRequiresUncachedMocs();
+
+    return this->coalescedCommandCount == 0 || this->coalescedDispatchState == dispatchState;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isCoalescedFlushThresholdReached() {
+    size_t maxSize = 16 * MemoryConstants::kiloByte;
+    if (NEO::DebugManager.flags.ImmediateCmdListCoalescedFlushMaxSize.get() != -1) {
+        maxSize = static_cast<size_t>(NEO::DebugManager.flags.ImmediateCmdListCoalescedFlushMaxSize.get());
+    }
+
+    if (this->commandContainer.getCommandStream()->getUsed() - this->cmdListCurrentStartOffset >= maxSize) {
+        return true;
+    }
+    return isCoalescedFlushDelayExpired();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isCoalescedFlushDelayExpired() {
+    int64_t maxDelayUs = 100;
+    if (NEO::DebugManager.flags.ImmediateCmdListCoalescedFlushMaxDelayUs.get() != -1) {
+        maxDelayUs = NEO::DebugManager.flags.ImmediateCmdListCoalescedFlushMaxDelayUs.get();
+    }
+
+    auto pendingTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - this->coalescedCommandsStartTime);
+    return pendingTime.count() >= maxDelayUs;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::registerCoalescedCommands() {
+    auto flusher = static_cast<DriverHandleImp *>(this->device->getDriverHandle())->getPendingCommandsFlusher();
+    if (flusher) {
+        flusher->registerCommandList(this);
+        this->pendingCommandsFlusher = flusher;
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::unregisterCoalescedCommands() {
+    if (this->pendingCommandsFlusher) {
+        this->pendingCommandsFlusher->unregisterCommandList(this);
+        this->pendingCommandsFlusher = nullptr;
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushPendingCommands() {
+    auto ret = flushReplayedLaunches();
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+    return flushCoalescedCommands();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushRegisteredPendingCommands(bool expiredOnly) {
+    std::unique_lock<std::recursive_mutex> lock(this->coalescedCommandsMutex, std::try_to_lock);
+    if (!lock.owns_lock() || (expiredOnly && !isCoalescedFlushDelayExpired())) {
+        return ZE_RESULT_NOT_READY;
+    }
+
+    // Flusher removes this list from its registry itself.
+    this->pendingCommandsFlusher = nullptr;
+    return flushCoalescedCommands();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushCoalescedCommands() {
+    std::lock_guard<std::recursive_mutex> lock(this->coalescedCommandsMutex);
+    if (this->coalescedCommandCount == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+    this->coalescedCommandCount = 0;
+    unregisterCoalescedCommands();
+    return executeCommandListImmediateWithFlushTask(true, false, false);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+CommandListCoreFamilyImmediate<gfxCoreFamily>::RecordedLaunch::~RecordedLaunch() {
+    if (commandList) {
+        commandList->destroy();
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::RecordedLaunch::matches(Kernel &kernel, const ze_group_count_t &groupCount) const {
+    // Every application visible change of arguments, group size or launch properties bumps the kernel state version.
+    return this->kernel == &kernel && this->kernelImmData == kernel.getImmutableData() &&
+           this->kernelStateVersion == static_cast<KernelImp &>(kernel).getStateVersion() &&
+           this->groupCount.groupCountX == groupCount.groupCountX && this->groupCount.groupCountY == groupCount.groupCountY && this->groupCount.groupCountZ == groupCount.groupCountZ;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::RecordedLaunch::capture(Kernel &kernel, const ze_group_count_t &groupCount) {
+    this->kernel = &kernel;
+    this->kernelImmData = kernel.getImmutableData();
+    this->kernelStateVersion = static_cast<KernelImp &>(kernel).getStateVersion();
+    this->groupCount = groupCount;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isLaunchReplayAllowed(Kernel *kernel, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
+                                                                          bool relaxedOrderingDispatch, const CmdListKernelLaunchParams &launchParams) {
+    if (NEO::DebugManager.flags.EnableImmediateCmdListLaunchReplay.get() != 1) {
+        return false;
+    }
+
+    if (!this->isFlushTaskSubmissionEnabled || this->isSyncModeQueue || isCopyOnly() || kernel == nullptr ||
+        hSignalEvent != nullptr || numWaitEvents > 0 || relaxedOrderingDispatch ||
+        launchParams.isCooperative || launchParams.isIndirect || launchParams.isPredicate || launchParams.isBuiltInKernel || launchParams.isKernelSplitOperation) {
+        return false;
+    }
+
+    // Kernels producing host visible side effects or patching per dispatch allocations are always encoded in place.
+    const auto &kernelAttributes = kernel->getKernelDescriptor().kernelAttributes;
+    auto kernelImp = static_cast<KernelImp *>(kernel);
+    if (kernel->getPrintfBufferAllocation() != nullptr || kernelAttributes.flags.usesAssert || kernel->usesSyncBuffer() ||
+        kernel->getImplicitArgs() != nullptr ||
+        (kernelAttributes.perHwThreadPrivateMemorySize != 0 && kernelImp->getParentModule().shouldAllocatePrivateMemoryPerDispatch())) {
+        return false;
+    }
+    return true;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendReplayedLaunch(Kernel *kernel, const ze_group_count_t &threadGroupDimensions, const CmdListKernelLaunchParams &launchParams) {
+    auto ret = this->flushCoalescedCommands();
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
+    RecordedLaunch *recordedLaunch = nullptr;
+    bool kernelRecorded = false;
+    for (auto &launch : this->recordedLaunches) {
+        if (launch->kernel == kernel) {
+            kernelRecorded = true;
+            if (launch->matches(*kernel, threadGroupDimensions)) {
+                recordedLaunch = launch.get();
+                break;
+            }
+        }
+    }
+
+    if (recordedLaunch) {
+        this->launchReplayStatistics.hitCount++;
+    } else {
+        this->launchReplayStatistics.missCount++;
+        if (kernelRecorded) {
+            this->launchReplayStatistics.reencodeCount++;
+        }
+        recordedLaunch = recordLaunch(kernel, threadGroupDimensions, launchParams, ret);
+        if (recordedLaunch == nullptr) {
+            return ret;
+        }
+    }
+    recordedLaunch->lastUsedSequence = ++this->launchReplaySequence;
+
+    // Primary batch buffers are chained in place, so a recorded launch cannot be submitted twice in one batch.
+    if (this->dispatchCmdListBatchBufferAsPrimary &&
+        std::find(this->pendingReplayedLaunches.begin(), this->pendingReplayedLaunches.end(), recordedLaunch) != this->pendingReplayedLaunches.end()) {
+        ret = flushReplayedLaunches();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+    this->pendingReplayedLaunches.push_back(recordedLaunch);
+
+    size_t maxPendingLaunches = 16;
+    if (NEO::DebugManager.flags.ImmediateCmdListLaunchReplayMaxBatch.get() != -1) {
+        maxPendingLaunches = static_cast<size_t>(NEO::DebugManager.flags.ImmediateCmdListLaunchReplayMaxBatch.get());
+    }
+    if (this->pendingReplayedLaunches.size() >= maxPendingLaunches) {
+        return flushReplayedLaunches();
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+typename CommandListCoreFamilyImmediate<gfxCoreFamily>::RecordedLaunch *CommandListCoreFamilyImmediate<gfxCoreFamily>::recordLaunch(Kernel *kernel, const ze_group_count_t &threadGroupDimensions,
+                                                                                                                                    const CmdListKernelLaunchParams &launchParams, ze_result_t &result) {
+    size_t maxRecordedLaunches = 32;
+    if (NEO::DebugManager.flags.ImmediateCmdListLaunchReplayCacheSize.get() != -1) {
+        maxRecordedLaunches = static_cast<size_t>(NEO::DebugManager.flags.ImmediateCmdListLaunchReplayCacheSize.get());
+    }
+    releaseCompletedRetiredLaunches();
+    while (!this->recordedLaunches.empty() && this->recordedLaunches.size() >= maxRecordedLaunches) {
+        evictRecordedLaunch();
+    }
+
+    auto recordedLaunch = std::make_unique<RecordedLaunch>();
+    auto productFamily = this->device->getNEODevice()->getHardwareInfo().platform.eProductFamily;
+    recordedLaunch->commandList = CommandList::create(productFamily, this->device, this->engineGroupType, 0u, result);
+    if (recordedLaunch->commandList == nullptr) {
+        return nullptr;
+    }
+
+    result = recordedLaunch->commandList->appendLaunchKernel(kernel->toHandle(), &threadGroupDimensions, nullptr, 0, nullptr, launchParams, false);
+    if (result == ZE_RESULT_SUCCESS) {
+        result = recordedLaunch->commandList->close();
+    }
+    if (result != ZE_RESULT_SUCCESS) {
+        return nullptr;
+    }
+    recordedLaunch->capture(*kernel, threadGroupDimensions);
+
+    this->recordedLaunches.push_back(std::move(recordedLaunch));
+    return this->recordedLaunches.back().get();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::evictRecordedLaunch() {
+    // Evicted launch may still be pending or executing, it is released once its task count is reached.
+    auto leastRecentlyUsed = std::min_element(this->recordedLaunches.begin(), this->recordedLaunches.end(),
+                                              [](const auto &lhs, const auto &rhs) { return lhs->lastUsedSequence < rhs->lastUsedSequence; });
+    this->retiredLaunches.push_back(std::move(*leastRecentlyUsed));
+    this->recordedLaunches.erase(leastRecentlyUsed);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::releaseCompletedRetiredLaunches() {
+    auto isCompleted = [this](const std::unique_ptr<RecordedLaunch> &launch) {
+        if (std::find(this->pendingReplayedLaunches.begin(), this->pendingReplayedLaunches.end(), launch.get()) != this->pendingReplayedLaunches.end()) {
+            return false;
+        }
+        return this->csr->testTaskCountReady(this->csr->getTagAddress(), launch->lastUsedTaskCount);
+    };
+    this->retiredLaunches.erase(std::remove_if(this->retiredLaunches.begin(), this->retiredLaunches.end(), isCompleted), this->retiredLaunches.end());
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::releaseRecordedLaunches() {
+    this->flushReplayedLaunches();
+    if (this->recordedLaunches.empty() && this->retiredLaunches.empty()) {
+        return;
+    }
+
+    TaskCountType lastUsedTaskCount = 0;
+    for (auto &launch : this->recordedLaunches) {
+        lastUsedTaskCount = std::max(lastUsedTaskCount, launch->lastUsedTaskCount);
+    }
+    for (auto &launch : this->retiredLaunches) {
+        lastUsedTaskCount = std::max(lastUsedTaskCount, launch->lastUsedTaskCount);
+    }
+    this->csr->waitForCompletionWithTimeout(NEO::WaitParams{false, false, NEO::TimeoutControls::maxTimeout}, lastUsedTaskCount);
+    this->recordedLaunches.clear();
+    this->retiredLaunches.clear();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushReplayedLaunches() {
+    if (this->pendingReplayedLaunches.empty()) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    std::vector<ze_command_list_handle_t> commandListHandles;
+    commandListHandles.reserve(this->pendingReplayedLaunches.size());
+    for (auto launch : this->pendingReplayedLaunches) {
+        commandListHandles.push_back(launch->commandList->toHandle());
+    }
+
+    auto ret = this->cmdQImmediate->executeCommandLists(static_cast<uint32_t>(commandListHandles.size()), commandListHandles.data(), nullptr, true);
+
+    auto taskCount = this->csr->peekTaskCount();
+    for (auto launch : this->pendingReplayedLaunches) {
+        launch->lastUsedTaskCount = taskCount;
+    }
+    this->pendingReplayedLaunches.clear();
+
+    // Recorded command lists are submitted with their own heaps, next flushed task has to program state base address again.
+    this->csr->setGSBAStateDirty(true);
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+CommandListCoreFamilyImmediate<gfxCoreFamily>::~CommandListCoreFamilyImmediate() {
+    std::lock_guard<std::recursive_mutex> lock(this->coalescedCommandsMutex);
+    unregisterCoalescedCommands();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::destroy() {
+    this->flushCoalescedCommands();
+    this->releaseRecordedLaunches();
+    return BaseClass::destroy();
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferCopyThroughLockedPtr(CpuMemCopyInfo &cpuMemCopyInfo, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
     if (NEO::DebugManager.flags.ExperimentalForceCopyThroughLock.get() == 1) {
@@ -821,7 +1249,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
         signalEvent->setGpuStartTimestamp();
     }
 
-    memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    if (dstLockPointer) {
+        NEO::cpuMemcpyToLockedMemory(cpuMemcpyDstPtr, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    } else if (srcLockPointer) {
+        NEO::cpuMemcpyFromLockedMemory(cpuMemcpyDstPtr, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    } else {
+        memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    }
 
     if (signalEvent) {
         signalEvent->setGpuEndTimestamp();
@@ -831,6 +1265,213 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferCpuImageCopy(Image *image, const ze_image_region_t *pRegion, ze_image_region_t &cpuCopyRegion) {
+    const auto imageInfo = image->getImageInfo();
+    const auto imageType = imageInfo.imgDesc.imageType;
+    if (imageType != NEO::ImageType::Image2D && imageType != NEO::ImageType::Image2DArray && imageType != NEO::ImageType::Image3D) {
+        return false;
+    }
+    if (imageInfo.imgDesc.numMipLevels > 1 || imageInfo.imgDesc.numSamples > 1 || imageInfo.plane != GMM_NO_PLANE) {
+        return false;
+    }
+
+    if (pRegion) {
+        cpuCopyRegion = *pRegion;
+    } else {
+        const auto imageDesc = image->getImageDesc();
+        cpuCopyRegion = {0, 0, 0,
+                         static_cast<uint32_t>(imageDesc.width),
+                         static_cast<uint32_t>(imageDesc.height),
+                         imageType == NEO::ImageType::Image3D ? static_cast<uint32_t>(imageDesc.depth) : 1u};
+    }
+
+    const size_t copySize = static_cast<size_t>(cpuCopyRegion.width) * cpuCopyRegion.height * cpuCopyRegion.depth * imageInfo.surfaceFormat->ImageElementSizeInBytes;
+    if (!NEO::TiledImageCopy::isCpuCopyPreferred(copySize)) {
+        return false;
+    }
+
+    auto driverHandle = static_cast<DriverHandleImp *>(this->device->getDriverHandle());
+    if (driverHandle->isRemoteImageNeeded(image, this->device)) {
+        return false;
+    }
+
+    NEO::ImageTilingMode tilingMode = NEO::ImageTilingMode::linear;
+    return NEO::TiledImageCopy::isCpuCopySupported(*image->getAllocation(), tilingMode);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuImageCopyFromMemory(Image *image, const void *srcPtr, const ze_image_region_t &region, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto allocation = image->getAllocation();
+    NEO::ImageTilingMode tilingMode = NEO::ImageTilingMode::linear;
+    UNRECOVERABLE_IF(!NEO::TiledImageCopy::isCpuCopySupported(*allocation, tilingMode));
+
+    void *imageStorage = allocation->getUnderlyingBuffer();
+    if (!NEO::MemoryPoolHelper::isSystemMemoryPool(allocation->getMemoryPool())) {
+        imageStorage = this->device->getDriverHandle()->getMemoryManager()->lockResource(allocation);
+        if (!allocation->isLocked()) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+    }
+
+    if (numWaitEvents > 0) {
+        this->synchronizeEventList(numWaitEvents, phWaitEvents);
+    }
+
+    if (this->dependenciesPresent) {
+        auto submissionStatus = this->csr->flushTagUpdate();
+        if (submissionStatus != NEO::SubmissionStatus::SUCCESS) {
+            return getErrorCodeForSubmissionStatus(submissionStatus);
+        }
+        const auto waitStatus = this->csr->waitForCompletionWithTimeout(NEO::WaitParams{false, false, NEO::TimeoutControls::maxTimeout}, this->csr->peekTaskCount());
+        if (waitStatus == NEO::WaitStatus::GpuHang) {
+            return ZE_RESULT_ERROR_DEVICE_LOST;
+        }
+        this->dependenciesPresent = false;
+    }
+
+    Event *signalEvent = nullptr;
+    if (hSignalEvent) {
+        signalEvent = Event::fromHandle(hSignalEvent);
+        signalEvent->setGpuStartTimestamp();
+    }
+
+    const auto imageInfo = image->getImageInfo();
+    const size_t bytesPerPixel = imageInfo.surfaceFormat->ImageElementSizeInBytes;
+    const size_t srcRowPitch = region.width * bytesPerPixel;
+    const size_t srcSlicePitch = region.height * srcRowPitch;
+
+    NEO::TiledImageCopy::copyLinearToTiled(tilingMode, imageStorage, imageInfo.rowPitch, imageInfo.slicePitch,
+                                           srcPtr, srcRowPitch, srcSlicePitch, bytesPerPixel,
+                                           {region.originX, region.originY, region.originZ},
+                                           {region.width, region.height, region.depth});
+
+    if (signalEvent) {
+        signalEvent->setGpuEndTimestamp();
+        signalEvent->hostSignal();
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferStagingCopy(const CpuMemCopyInfo &cpuMemCopyInfo) {
+    if (NEO::DebugManager.flags.EnableStagingBufferCopy.get() != 1) {
+        return false;
+    }
+
+    const TransferType transferType = getTransferType(cpuMemCopyInfo.dstAllocData, cpuMemCopyInfo.srcAllocData);
+    if (transferType != HOST_NON_USM_TO_DEVICE_USM && transferType != DEVICE_USM_TO_HOST_NON_USM) {
+        return false;
+    }
+
+    // Copies up to the copy-through-lock threshold keep the CPU memcpy path, and a single chunk gives no pipelining.
+    const size_t stagingThreshold = std::max(getTransferThreshold(transferType), static_cast<DeviceImp *>(this->device)->stagingBuffers.getChunkSize());
+    return cpuMemCopyInfo.size > stagingThreshold;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performStagingCopy(const CpuMemCopyInfo &cpuMemCopyInfo, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto &stagingBuffers = static_cast<DeviceImp *>(this->device)->stagingBuffers;
+    const bool hostToDevice = cpuMemCopyInfo.srcAllocData == nullptr;
+    const size_t chunkSize = stagingBuffers.getChunkSize();
+    const size_t size = cpuMemCopyInfo.size;
+    const size_t chunksNeeded = std::min(stagingBuffers.getChunksPerCopy(), (size + chunkSize - 1) / chunkSize);
+
+    StackVec<StagingBuffer *, 4> chunks;
+    for (size_t i = 0; i < chunksNeeded; i++) {
+        auto chunk = stagingBuffers.obtain();
+        if (chunk == nullptr) {
+            break;
+        }
+        chunks.push_back(chunk);
+    }
+    if (chunks.empty()) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    // Wait events may guard the user buffer accessed by the CPU, so they are synchronized before the first memcpy.
+    if (numWaitEvents > 0) {
+        this->synchronizeEventList(numWaitEvents, phWaitEvents);
+    }
+
+    // H2D: CPU fills chunk N while the copy engine reads chunk N-1.
+    // D2H: copy engine writes chunk N while the CPU drains chunk N-1 into the user buffer.
+    ze_result_t ret = ZE_RESULT_SUCCESS;
+    StagingBuffer *pendingChunk = nullptr;
+    size_t pendingOffset = 0u;
+    size_t pendingSize = 0u;
+
+    auto drainPendingChunk = [&]() {
+        if (pendingChunk->waitForCompletion() == NEO::WaitStatus::GpuHang) {
+            return ZE_RESULT_ERROR_DEVICE_LOST;
+        }
+        memcpy_s(ptrOffset(cpuMemCopyInfo.dstPtr, pendingOffset), pendingSize, pendingChunk->ptr, pendingSize);
+        pendingChunk = nullptr;
+        return ZE_RESULT_SUCCESS;
+    };
+
+    Event *signalEvent = hSignalEvent ? Event::fromHandle(hSignalEvent) : nullptr;
+    if (signalEvent && !hostToDevice) {
+        signalEvent->setGpuStartTimestamp();
+    }
+
+    for (size_t offset = 0u, chunkIndex = 0u; offset < size && ret == ZE_RESULT_SUCCESS; offset += chunkSize, chunkIndex++) {
+        auto chunk = chunks[chunkIndex % chunks.size()];
+        const size_t copySize = std::min(chunkSize, size - offset);
+        const bool firstChunk = offset == 0u;
+        const bool lastChunk = offset + copySize == size;
+
+        if (chunk->waitForCompletion() == NEO::WaitStatus::GpuHang) {
+            ret = ZE_RESULT_ERROR_DEVICE_LOST;
+            break;
+        }
+
+        if (this->isFlushTaskSubmissionEnabled && !firstChunk) {
+            ret = checkAvailableSpace(0u, false);
+            if (ret != ZE_RESULT_SUCCESS) {
+                break;
+            }
+        }
+
+        auto chunkSignalEvent = (hostToDevice && lastChunk) ? hSignalEvent : nullptr;
+        if (hostToDevice) {
+            memcpy_s(chunk->ptr, copySize, ptrOffset(cpuMemCopyInfo.srcPtr, offset), copySize);
+            ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(ptrOffset(cpuMemCopyInfo.dstPtr, offset), chunk->ptr, copySize, chunkSignalEvent, 0u, nullptr, false);
+        } else {
+            ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(chunk->ptr, ptrOffset(cpuMemCopyInfo.srcPtr, offset), copySize, nullptr, 0u, nullptr, false);
+        }
+        ret = flushImmediate(ret, true, false, false, chunkSignalEvent);
+
+        chunk->csr = this->csr;
+        chunk->taskCount = this->csr->peekTaskCount();
+
+        if (!hostToDevice && ret == ZE_RESULT_SUCCESS) {
+            if (pendingChunk) {
+                ret = drainPendingChunk();
+            }
+            pendingChunk = chunk;
+            pendingOffset = offset;
+            pendingSize = copySize;
+        }
+    }
+
+    if (pendingChunk && ret == ZE_RESULT_SUCCESS) {
+        ret = drainPendingChunk();
+    }
+
+    if (signalEvent && !hostToDevice && ret == ZE_RESULT_SUCCESS) {
+        signalEvent->setGpuEndTimestamp();
+        signalEvent->hostSignal();
+    }
+
+    for (auto chunk : chunks) {
+        stagingBuffers.release(chunk);
+    }
+
+    return ret;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void *CommandListCoreFamilyImmediate<gfxCoreFamily>::obtainLockedPtrFromDevice(NEO::SvmAllocationData *allocData, void *ptr, bool &lockingFailed) {
     if (!allocData) {
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/cmdlist/pending_commands_flusher.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+PendingCommandsFlusher::PendingCommandsFlusher(std::chrono::microseconds flushInterval) : flushInterval(flushInterval) {}
+
+PendingCommandsFlusher::~PendingCommandsFlusher() {
+    stop();
+}
+
+void PendingCommandsFlusher::registerCommandList(CommandList *commandList) {
+    std::lock_guard<std::mutex> lock(commandListsMutex);
+    if (std::find(commandLists.begin(), commandLists.end(), commandList) == commandLists.end()) {
+        commandLists.push_back(commandList);
+        registeredCount.store(commandLists.size());
+    }
+
+    if (!flusherThread) {
+        keepRunning.store(true);
+        flusherThread = NEO::Thread::create(flusherThreadFunction, reinterpret_cast<void *>(this));
+    }
+}
+
+void PendingCommandsFlusher::unregisterCommandList(CommandList *commandList) {
+    std::lock_guard<std::mutex> lock(commandListsMutex);
+    commandLists.erase(std::remove(commandLists.begin(), commandLists.end(), commandList), commandLists.end());
+    registeredCount.store(commandLists.size());
+}
+
+ze_result_t PendingCommandsFlusher::flush(bool expiredOnly) {
+    if (registeredCount.load() == 0u) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::lock_guard<std::mutex> lock(commandListsMutex);
+    for (auto it = commandLists.begin(); it != commandLists.end();) {
+        // Command list keeps its launches pending while it is appending on another thread or its delay has not expired yet.
+        auto ret = (*it)->flushRegisteredPendingCommands(expiredOnly);
+        if (ret == ZE_RESULT_NOT_READY) {
+            ++it;
+            continue;
+        }
+        it = commandLists.erase(it);
+        if (result == ZE_RESULT_SUCCESS) {
+            result = ret;
+        }
+    }
+    registeredCount.store(commandLists.size());
+    return result;
+}
+
+void PendingCommandsFlusher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        keepRunning.store(false);
+    }
+    sleepCondition.notify_all();
+    if (flusherThread) {
+        flusherThread->join();
+        flusherThread.reset();
+    }
+}
+
+void *PendingCommandsFlusher::flusherThreadFunction(void *arg) {
+    auto flusher = reinterpret_cast<PendingCommandsFlusher *>(arg);
+
+    while (flusher->keepRunning.load()) {
+        flusher->flush(true);
+        flusher->sleep();
+    }
+    return nullptr;
+}
+
+void PendingCommandsFlusher::sleep() {
+    std::unique_lock<std::mutex> lock(sleepMutex);
+    sleepCondition.wait_for(lock, flushInterval, [this]() { return !keepRunning.load(); });
+}
+
+} // namespace L0
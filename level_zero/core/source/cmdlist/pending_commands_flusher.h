@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <level_zero/ze_api.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace L0 {
+struct CommandList;
+
+// Tracks immediate command lists holding coalesced launches that are not submitted yet. Pending launches are
+// submitted at host synchronization points, before resources they may use are freed, and on a background
+// thread once the coalescing delay of a command list expires.
+class PendingCommandsFlusher {
+  public:
+    PendingCommandsFlusher(std::chrono::microseconds flushInterval);
+    virtual ~PendingCommandsFlusher();
+
+    void registerCommandList(CommandList *commandList);
+    void unregisterCommandList(CommandList *commandList);
+    ze_result_t flush(bool expiredOnly);
+    void stop();
+
+    size_t getRegisteredCommandListCount() const { return registeredCount.load(); }
+
+  protected:
+    static void *flusherThreadFunction(void *arg);
+
+    MOCKABLE_VIRTUAL void sleep();
+
+    std::vector<CommandList *> commandLists;
+    std::mutex commandListsMutex;
+    std::atomic<size_t> registeredCount{0u};
+
+    std::unique_ptr<NEO::Thread> flusherThread;
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+    std::atomic_bool keepRunning{false};
+    std::chrono::microseconds flushInterval;
+};
+
+} // namespace L0
@@ -143,6 +143,14 @@ NEO::SubmissionStatus CommandQueueImp::submitBatchBuffer(size_t offset, NEO::Res
 }
 
 ze_result_t CommandQueueImp::synchronize(uint64_t timeout) {
+    auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
+    if (driverHandle != nullptr) {
+        auto ret = driverHandle->flushPendingCoalescedCommands();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+
     if ((timeout == std::numeric_limits<uint64_t>::max()) && useKmdWaitFunction) {
         auto &waitPair = buffers.getCurrentFlushStamp();
         const auto waitStatus = csr->waitForTaskCountWithKmdNotifyFallback(waitPair.first, waitPair.second, false, NEO::QueueThrottle::MEDIUM);
@@ -172,6 +172,7 @@ struct CommandQueueHw : public CommandQueueImp {
 
     inline void cleanLeftoverMemory(NEO::LinearStream &outerCommandStream, NEO::LinearStream &innerCommandStream);
     inline void updateTaskCountAndPostSync(bool isDispatchTaskCountPostSyncRequired);
+    inline void updatePrintfTaskCountToWait(bool isDispatchTaskCountPostSyncRequired);
     inline ze_result_t waitForCommandQueueCompletionAndCleanHeapContainer();
     inline ze_result_t handleSubmissionAndCompletionResults(NEO::SubmissionStatus submitRet, ze_result_t completionRet);
     inline size_t estimatePipelineSelectCmdSizeForMultipleCommandLists(NEO::StreamProperties &csrStateCopy,
@@ -40,6 +40,7 @@
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/fence/fence.h"
 #include "level_zero/core/source/helpers/error_code_helper_l0.h"
+#include "level_zero/core/source/kernel/kernel.h"
 
 #include <algorithm>
 #include <limits>
@@ -215,6 +216,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
 
     this->csr->setPreemptionMode(ctx.statePreemption);
     this->updateTaskCountAndPostSync(ctx.isDispatchTaskCountPostSyncRequired);
+    this->updatePrintfTaskCountToWait(ctx.isDispatchTaskCountPostSyncRequired);
 
     this->csr->makeSurfacePackNonResident(this->csr->getResidencyAllocations(), false);
 
@@ -1024,6 +1026,10 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandQueueHw<gfxCoreFamily>::collectPrintfContentsFromCommandsList(
     CommandList *commandList) {
 
+    // background drain of printf output waits until the task count of this submission is known
+    for (auto kernel : commandList->getPrintfKernelContainer()) {
+        kernel->setPrintfTaskCountToWait(nullptr, 0u);
+    }
     this->printfKernelContainer.insert(this->printfKernelContainer.end(),
                                        commandList->getPrintfKernelContainer().begin(),
                                        commandList->getPrintfKernelContainer().end());
@@ -1172,6 +1178,17 @@ void CommandQueueHw<gfxCoreFamily>::updateTaskCountAndPostSync(bool isDispatchTa
     this->csr->setLatestFlushedTaskCount(this->taskCount);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::updatePrintfTaskCountToWait(bool isDispatchTaskCountPostSyncRequired) {
+
+    if (!isDispatchTaskCountPostSyncRequired) {
+        return;
+    }
+    for (auto kernel : this->printfKernelContainer) {
+        kernel->setPrintfTaskCountToWait(this->csr, this->taskCount);
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandQueueHw<gfxCoreFamily>::waitForCommandQueueCompletionAndCleanHeapContainer() {
 
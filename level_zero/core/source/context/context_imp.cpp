@@ -394,6 +394,8 @@ ze_result_t ContextImp::freeMem(const void *ptr, bool blocking) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    this->driverHandle->flushPendingCoalescedCommands();
+
     for (auto pairDevice : this->devices) {
         this->freePeerAllocations(ptr, blocking, Device::fromHandle(pairDevice.second));
     }
@@ -414,6 +416,8 @@ ze_result_t ContextImp::freeMemExt(const ze_memory_free_ext_desc_t *pMemFreeDesc
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        this->driverHandle->flushPendingCoalescedCommands();
+
         for (auto pairDevice : this->devices) {
             this->freePeerAllocations(ptr, false, Device::fromHandle(pairDevice.second));
         }
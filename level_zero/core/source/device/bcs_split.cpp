@@ -11,8 +11,11 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device_imp.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr) {
@@ -114,21 +117,80 @@ std::vector<CommandQueue *> &BcsSplit::getCmdQsForSplit(NEO::TransferDirection d
     return this->cmdQs;
 }
 
+size_t BcsSplit::getEngineCountForSplit(size_t size, size_t availableEngines) const {
+    size_t chunkSize = minimalChunkSize;
+    if (NEO::DebugManager.flags.SplitBcsMinChunkSize.get() > 0) {
+        chunkSize = static_cast<size_t>(NEO::DebugManager.flags.SplitBcsMinChunkSize.get());
+    }
+
+    return std::clamp(size / chunkSize, static_cast<size_t>(1u), availableEngines);
+}
+
+TaskCountType BcsSplit::getOutstandingTaskCount(CommandQueue *cmdQ) {
+    auto csr = static_cast<CommandQueueImp *>(cmdQ)->getCsr();
+    auto taskCount = csr->peekTaskCount();
+    TaskCountType completedTaskCount = *csr->getTagAddress();
+
+    return taskCount > completedTaskCount ? taskCount - completedTaskCount : 0u;
+}
+
+void BcsSplit::selectCmdQsForSplit(NEO::TransferDirection direction, size_t size, StackVec<CommandQueue *, 4> &selectedCmdQs) {
+    auto &cmdQsForSplit = this->getCmdQsForSplit(direction);
+    auto engineCount = this->getEngineCountForSplit(size, cmdQsForSplit.size());
+
+    if (engineCount == cmdQsForSplit.size()) {
+        for (auto cmdQ : cmdQsForSplit) {
+            selectedCmdQs.push_back(cmdQ);
+        }
+        return;
+    }
+
+    // Prefer engines with the least outstanding work, ties keep the configured engine order.
+    StackVec<std::pair<TaskCountType, size_t>, 4> load;
+    for (size_t i = 0; i < cmdQsForSplit.size(); i++) {
+        load.push_back({getOutstandingTaskCount(cmdQsForSplit[i]), i});
+    }
+    std::sort(load.begin(), load.end());
+
+    StackVec<size_t, 4> selectedIndices;
+    for (size_t i = 0; i < engineCount; i++) {
+        selectedIndices.push_back(load[i].second);
+    }
+    std::sort(selectedIndices.begin(), selectedIndices.end());
+
+    for (auto index : selectedIndices) {
+        selectedCmdQs.push_back(cmdQsForSplit[index]);
+    }
+}
+
 size_t BcsSplit::Events::obtainForSplit(Context *context, size_t maxEventCountInPool) {
     std::lock_guard<std::mutex> lock(this->mtx);
+
+    auto completedSet = this->obtainCompleted();
+    if (completedSet.has_value()) {
+        return *completedSet;
+    }
+
+    return this->allocateNew(context, maxEventCountInPool);
+}
+
+std::optional<size_t> BcsSplit::Events::obtainCompleted() {
     for (size_t i = 0; i < this->marker.size(); i++) {
-        auto ret = this->marker[i]->queryStatus();
-        if (ret == ZE_RESULT_SUCCESS) {
-            this->marker[i]->reset();
-            this->barrier[i]->reset();
-            for (size_t j = 0; j < this->bcsSplit.cmdQs.size(); j++) {
-                this->subcopy[i * this->bcsSplit.cmdQs.size() + j]->reset();
-            }
+        if (this->marker[i]->queryStatus() == ZE_RESULT_SUCCESS) {
+            this->resetSet(i);
             return i;
         }
     }
 
-    return this->allocateNew(context, maxEventCountInPool);
+    return std::nullopt;
+}
+
+void BcsSplit::Events::resetSet(size_t setIndex) {
+    this->marker[setIndex]->reset();
+    this->barrier[setIndex]->reset();
+    for (size_t j = 0; j < this->bcsSplit.cmdQs.size(); j++) {
+        this->subcopy[setIndex * this->bcsSplit.cmdQs.size() + j]->reset();
+    }
 }
 
 size_t BcsSplit::Events::allocateNew(Context *context, size_t maxEventCountInPool) {
@@ -180,6 +242,7 @@ size_t BcsSplit::Events::allocateNew(Context *context, size_t maxEventCountInPoo
 
     return this->marker.size() - 1;
 }
+
 void BcsSplit::Events::releaseResources() {
     for (auto &markerEvent : this->marker) {
         markerEvent->destroy();
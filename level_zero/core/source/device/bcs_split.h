@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <mutex>
+#include <optional>
 #include <vector>
 
 namespace NEO {
@@ -45,7 +46,10 @@ struct BcsSplit {
         size_t createdFromLatestPool = 0u;
 
         size_t obtainForSplit(Context *context, size_t maxEventCountInPool);
+        // Callers hold mtx, allocateNew may grow the event vectors concurrently otherwise.
+        std::optional<size_t> obtainCompleted();
         size_t allocateNew(Context *context, size_t maxEventCountInPool);
+        void resetSet(size_t setIndex);
 
         void releaseResources();
 
@@ -62,6 +66,9 @@ struct BcsSplit {
     NEO::BcsInfoMask h2dEngines = h2dEngineMask;
     NEO::BcsInfoMask d2hEngines = d2hEngineMask;
 
+    // Each engine gets at least this much of a split copy, smaller copies are spread over fewer engines.
+    inline static constexpr size_t minimalChunkSize = 2 * MemoryConstants::megaByte;
+
     template <GFXCORE_FAMILY gfxCoreFamily, typename T, typename K>
     ze_result_t appendSplitCall(CommandListCoreFamilyImmediate<gfxCoreFamily> *cmdList,
                                 T dstptr,
@@ -86,7 +93,8 @@ struct BcsSplit {
         auto subcopyEventIndex = markerEventIndex * this->cmdQs.size();
         StackVec<ze_event_handle_t, 4> eventHandles;
 
-        auto &cmdQsForSplit = this->getCmdQsForSplit(direction);
+        StackVec<CommandQueue *, 4> cmdQsForSplit;
+        this->selectCmdQsForSplit(direction, size, cmdQsForSplit);
 
         auto totalSize = size;
         auto engineCount = cmdQsForSplit.size();
@@ -120,7 +128,7 @@ struct BcsSplit {
             engineCount--;
         }
 
-        cmdList->addEventsToCmdList(static_cast<uint32_t>(cmdQsForSplit.size()), eventHandles.data(), hasRelaxedOrderingDependencies, false);
+        cmdList->addEventsToCmdList(static_cast<uint32_t>(eventHandles.size()), eventHandles.data(), hasRelaxedOrderingDependencies, false);
         if (hSignalEvent) {
             cmdList->appendEventForProfilingAllWalkers(Event::fromHandle(hSignalEvent), false, true);
         }
@@ -132,6 +140,9 @@ struct BcsSplit {
     bool setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr);
     void releaseResources();
     std::vector<CommandQueue *> &getCmdQsForSplit(NEO::TransferDirection direction);
+    size_t getEngineCountForSplit(size_t size, size_t availableEngines) const;
+    void selectCmdQsForSplit(NEO::TransferDirection direction, size_t size, StackVec<CommandQueue *, 4> &selectedCmdQs);
+    static TaskCountType getOutstandingTaskCount(CommandQueue *cmdQ);
 
     BcsSplit(DeviceImp &device) : device(device), events(*this){};
 };
@@ -37,6 +37,7 @@ class MetricDeviceContext;
 struct SysmanDevice;
 struct DebugSession;
 class L0GfxCoreHelper;
+class PrintfDrainer;
 
 enum class ModuleType;
 
@@ -143,6 +144,7 @@ struct Device : _ze_device_handle_t {
     virtual ze_result_t getFabricVertex(ze_fabric_vertex_handle_t *phVertex) = 0;
     virtual uint32_t getEventMaxPacketCount() const = 0;
     virtual uint32_t getEventMaxKernelCount() const = 0;
+    virtual PrintfDrainer *getPrintfDrainer() = 0;
 
   protected:
     NEO::Device *neoDevice = nullptr;
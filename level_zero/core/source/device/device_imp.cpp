@@ -49,6 +49,7 @@
 #include "level_zero/core/source/image/image.h"
 #include "level_zero/core/source/module/module.h"
 #include "level_zero/core/source/module/module_build_log.h"
+#include "level_zero/core/source/printf_handler/printf_drainer.h"
 #include "level_zero/core/source/printf_handler/printf_handler.h"
 #include "level_zero/core/source/sampler/sampler.h"
 #include "level_zero/tools/source/debug/debug_session.h"
@@ -64,7 +65,7 @@ bool releaseFP64Override();
 
 namespace L0 {
 
-DeviceImp::DeviceImp() : bcsSplit(*this){};
+DeviceImp::DeviceImp() : bcsSplit(*this), stagingBuffers(*this){};
 
 DriverHandle *DeviceImp::getDriverHandle() {
     return this->driverHandle;
@@ -1140,6 +1141,10 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, bool
     auto osInterface = rootDeviceEnvironment.osInterface.get();
     device->driverInfo.reset(NEO::DriverInfo::create(&hwInfo, osInterface));
 
+    if (NEO::DebugManager.flags.PrintfBackgroundDrainIntervalUs.get() > 0) {
+        device->printfDrainer = std::make_unique<PrintfDrainer>(std::chrono::microseconds{NEO::DebugManager.flags.PrintfBackgroundDrainIntervalUs.get()});
+    }
+
     auto debugSurfaceSize = gfxCoreHelper.getSipKernelMaxDbgSurfaceSize(hwInfo);
     std::vector<char> stateSaveAreaHeader;
 
@@ -1245,6 +1250,11 @@ void DeviceImp::releaseResources() {
     UNRECOVERABLE_IF(neoDevice == nullptr);
 
     this->bcsSplit.releaseResources();
+    this->stagingBuffers.releaseResources();
+
+    if (printfDrainer) {
+        printfDrainer->stop();
+    }
 
     if (neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->debugger.get() &&
         !neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->debugger->isLegacy()) {
@@ -1273,6 +1283,7 @@ void DeviceImp::releaseResources() {
     metricContext.reset();
     builtins.reset();
     cacheReservation.reset();
+    printfDrainer.reset();
 
     if (allocationsForReuse.get()) {
         allocationsForReuse->freeAllGraphicsAllocations(neoDevice);
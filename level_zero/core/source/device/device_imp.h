@@ -15,6 +15,7 @@
 
 #include "level_zero/core/source/device/bcs_split.h"
 #include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/device/staging_buffer_pool.h"
 
 #include <map>
 #include <mutex>
@@ -28,6 +29,7 @@ namespace L0 {
 struct SysmanDevice;
 struct FabricVertex;
 class CacheReservation;
+class PrintfDrainer;
 
 struct DeviceImp : public Device {
     DeviceImp();
@@ -128,6 +130,7 @@ struct DeviceImp : public Device {
     ze_pci_speed_ext_t pciMaxSpeed = {-1, -1, -1};
 
     BcsSplit bcsSplit;
+    StagingBufferPool stagingBuffers;
 
     bool resourcesReleased = false;
     void releaseResources();
@@ -139,6 +142,7 @@ struct DeviceImp : public Device {
     std::map<NEO::SvmAllocationData *, NEO::MemAdviseFlags> memAdviseSharedAllocations;
     std::unique_ptr<NEO::AllocationsList> allocationsForReuse;
     std::unique_ptr<NEO::DriverInfo> driverInfo;
+    std::unique_ptr<PrintfDrainer> printfDrainer;
     void createSysmanHandle(bool isSubDevice);
     void populateSubDeviceCopyEngineGroups();
     bool isQueueGroupOrdinalValid(uint32_t ordinal);
@@ -152,6 +156,7 @@ struct DeviceImp : public Device {
     ze_result_t setDeviceLuid(ze_device_luid_ext_properties_t *deviceLuidProperties);
     uint32_t getEventMaxPacketCount() const override;
     uint32_t getEventMaxKernelCount() const override;
+    PrintfDrainer *getPrintfDrainer() override { return printfDrainer.get(); }
     uint32_t queryDeviceNodeMask();
 
   protected:
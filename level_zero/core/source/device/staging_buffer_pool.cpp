@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/device/staging_buffer_pool.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/csr_definitions.h"
+#include "shared/source/command_stream/wait_status.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+
+#include "level_zero/core/source/device/device_imp.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
+
+namespace L0 {
+
+NEO::WaitStatus StagingBuffer::waitForCompletion() {
+    if (this->csr == nullptr) {
+        return NEO::WaitStatus::Ready;
+    }
+
+    const auto waitStatus = this->csr->waitForCompletionWithTimeout(NEO::WaitParams{false, false, NEO::TimeoutControls::maxTimeout}, this->taskCount);
+    if (waitStatus == NEO::WaitStatus::Ready) {
+        this->csr = nullptr;
+    }
+    return waitStatus;
+}
+
+StagingBuffer *StagingBufferPool::obtain() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+
+    if (!this->freeBuffers.empty()) {
+        auto buffer = this->freeBuffers.back();
+        this->freeBuffers.pop_back();
+        return buffer;
+    }
+
+    auto neoDevice = this->device.getNEODevice();
+    auto rootDeviceIndex = neoDevice->getRootDeviceIndex();
+    RootDeviceIndicesContainer rootDeviceIndices;
+    rootDeviceIndices.push_back(rootDeviceIndex);
+    std::map<uint32_t, NEO::DeviceBitfield> deviceBitfields;
+    deviceBitfields.insert({rootDeviceIndex, neoDevice->getDeviceBitfield()});
+
+    NEO::SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto driverHandle = static_cast<DriverHandleImp *>(this->device.getDriverHandle());
+    auto ptr = driverHandle->svmAllocsManager->createHostUnifiedMemoryAllocation(this->getChunkSize(), unifiedMemoryProperties);
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+
+    auto buffer = std::make_unique<StagingBuffer>();
+    buffer->ptr = ptr;
+    this->buffers.push_back(std::move(buffer));
+    return this->buffers.back().get();
+}
+
+void StagingBufferPool::release(StagingBuffer *buffer) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    this->freeBuffers.push_back(buffer);
+}
+
+void StagingBufferPool::releaseResources() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+
+    auto driverHandle = static_cast<DriverHandleImp *>(this->device.getDriverHandle());
+    for (auto &buffer : this->buffers) {
+        buffer->waitForCompletion();
+        driverHandle->svmAllocsManager->freeSVMAlloc(buffer->ptr, true);
+    }
+    this->buffers.clear();
+    this->freeBuffers.clear();
+}
+
+size_t StagingBufferPool::getChunkSize() const {
+    if (NEO::DebugManager.flags.StagingBufferChunkSize.get() > 0) {
+        return static_cast<size_t>(NEO::DebugManager.flags.StagingBufferChunkSize.get());
+    }
+    return defaultChunkSize;
+}
+
+size_t StagingBufferPool::getChunksPerCopy() const {
+    if (NEO::DebugManager.flags.StagingBufferChunksPerCopy.get() > 0) {
+        return static_cast<size_t>(NEO::DebugManager.flags.StagingBufferChunksPerCopy.get());
+    }
+    return defaultChunksPerCopy;
+}
+
+} // namespace L0
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/command_stream/wait_status.h"
+#include "shared/source/helpers/constants.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+}
+
+namespace L0 {
+struct DeviceImp;
+
+struct StagingBuffer {
+    void *ptr = nullptr;
+    NEO::CommandStreamReceiver *csr = nullptr;
+    TaskCountType taskCount = 0u;
+
+    NEO::WaitStatus waitForCompletion();
+};
+
+// Pinned host USM chunks used to stream copies from and to pageable host memory
+// without importing the user range as a userptr allocation on every call.
+class StagingBufferPool {
+  public:
+    inline static constexpr size_t defaultChunkSize = 2 * MemoryConstants::megaByte;
+    inline static constexpr size_t defaultChunksPerCopy = 3u;
+
+    StagingBufferPool(DeviceImp &device) : device(device){};
+
+    StagingBuffer *obtain();
+    void release(StagingBuffer *buffer);
+    void releaseResources();
+
+    size_t getChunkSize() const;
+    size_t getChunksPerCopy() const;
+    size_t getAllocatedCount() const { return buffers.size(); }
+
+  protected:
+    DeviceImp &device;
+
+    std::mutex mtx;
+    std::vector<std::unique_ptr<StagingBuffer>> buffers;
+    std::vector<StagingBuffer *> freeBuffers;
+};
+
+} // namespace L0
@@ -21,6 +21,7 @@
 #include "shared/source/os_interface/os_library.h"
 
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
+#include "level_zero/core/source/cmdlist/pending_commands_flusher.h"
 #include "level_zero/core/source/context/context_imp.h"
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_imp.h"
@@ -151,7 +152,18 @@ ze_result_t DriverHandleImp::getExtensionProperties(uint32_t *pCount,
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t DriverHandleImp::flushPendingCoalescedCommands() {
+    if (this->pendingCommandsFlusher == nullptr) {
+        return ZE_RESULT_SUCCESS;
+    }
+    return this->pendingCommandsFlusher->flush(false);
+}
+
 DriverHandleImp::~DriverHandleImp() {
+    if (this->pendingCommandsFlusher) {
+        this->pendingCommandsFlusher->stop();
+    }
+
     if (memoryManager != nullptr) {
         memoryManager->peekExecutionEnvironment().prepareForCleanup();
         if (this->svmAllocsManager) {
@@ -255,6 +267,14 @@ ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>
         createHostPointerManager();
     }
 
+    if (NEO::DebugManager.flags.EnableImmediateCmdListCoalescedFlush.get() == 1) {
+        int32_t flushIntervalUs = 100;
+        if (NEO::DebugManager.flags.ImmediateCmdListCoalescedFlushMaxDelayUs.get() != -1) {
+            flushIntervalUs = NEO::DebugManager.flags.ImmediateCmdListCoalescedFlushMaxDelayUs.get();
+        }
+        this->pendingCommandsFlusher = std::make_unique<PendingCommandsFlusher>(std::chrono::microseconds{flushIntervalUs});
+    }
+
     return ZE_RESULT_SUCCESS;
 }
 
@@ -19,6 +19,7 @@
 
 namespace L0 {
 class HostPointerManager;
+class PendingCommandsFlusher;
 struct FabricVertex;
 struct FabricEdge;
 struct Image;
@@ -91,7 +92,11 @@ struct DriverHandleImp : public DriverHandle {
     uint32_t getEventMaxPacketCount(uint32_t numDevices, ze_device_handle_t *deviceHandles) const override;
     uint32_t getEventMaxKernelCount(uint32_t numDevices, ze_device_handle_t *deviceHandles) const override;
 
+    PendingCommandsFlusher *getPendingCommandsFlusher() const { return pendingCommandsFlusher.get(); }
+    ze_result_t flushPendingCoalescedCommands();
+
     std::unique_ptr<HostPointerManager> hostPointerManager;
+    std::unique_ptr<PendingCommandsFlusher> pendingCommandsFlusher;
     // Experimental functions
     std::unordered_map<std::string, void *> extensionFunctionsLookupMap;
 
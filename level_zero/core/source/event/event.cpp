@@ -81,6 +81,10 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
 
     initializeSizeParameters(numDevices, deviceHandles, *driverHandleImp, rootDeviceEnvironment);
 
+    if (NEO::DebugManager.flags.EnableEventPacketPool.get() == 1) {
+        packetPool = std::make_shared<EventPacketPool>();
+    }
+
     NEO::AllocationType allocationType = isEventPoolTimestampFlagSet() ? NEO::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER
                                                                        : NEO::AllocationType::BUFFER_HOST_MEMORY;
     if (this->devices.size() > 1) {
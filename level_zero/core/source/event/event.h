@@ -9,6 +9,8 @@
 #include "shared/source/helpers/timestamp_packet_size_control.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 
+#include "level_zero/core/source/event/event_packet_pool.h"
+
 #include <level_zero/ze_api.h>
 
 #include <atomic>
@@ -64,6 +66,7 @@ struct Event : _ze_event_handle_t {
     virtual ze_result_t hostSignal() = 0;
     virtual ze_result_t hostSynchronize(uint64_t timeout) = 0;
     virtual ze_result_t queryStatus() = 0;
+    virtual ze_result_t queryStatusWithPacketScan() { return queryStatus(); }
     virtual ze_result_t reset() = 0;
     virtual ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) = 0;
     virtual ze_result_t queryTimestampsExp(Device *device, uint32_t *count, ze_kernel_timestamp_result_t *timestamps) = 0;
@@ -135,8 +138,11 @@ struct Event : _ze_event_handle_t {
     void setCsr(NEO::CommandStreamReceiver *csr) {
         this->csr = csr;
     }
+    NEO::CommandStreamReceiver *getCsr() const {
+        return csr;
+    }
 
-    void increaseKernelCount();
+    virtual void increaseKernelCount();
     uint32_t getKernelCount() const {
         return kernelCount;
     }
@@ -299,6 +305,8 @@ struct EventPool : _ze_event_pool_handle_t {
         return isImportedIpcPool;
     }
 
+    const std::shared_ptr<EventPacketPool> &getPacketPool() const { return packetPool; }
+
   protected:
     EventPool() = default;
     EventPool(size_t numEvents) : numEvents(numEvents) {}
@@ -306,6 +314,7 @@ struct EventPool : _ze_event_pool_handle_t {
     std::vector<Device *> devices;
 
     std::unique_ptr<NEO::MultiGraphicsAllocation> eventPoolAllocations;
+    std::shared_ptr<EventPacketPool> packetPool;
     void *eventPoolPtr = nullptr;
     ContextImp *context = nullptr;
 
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_batch_query.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+
+#include "level_zero/core/source/event/event.h"
+
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace L0 {
+
+namespace EventBatchQuery {
+
+template <typename TagSizeT>
+bool arePacketsSignaled(const void *packets, uint32_t packetCount, size_t packetSize, size_t completionFieldOffset) {
+    // Each packet is checked with a single 16-byte compare of the window holding its completion field.
+    constexpr size_t windowSize = sizeof(__m128i);
+    const auto windowOffset = alignDown(completionFieldOffset, windowSize);
+    const auto fieldOffsetInWindow = completionFieldOffset - windowOffset;
+    UNRECOVERABLE_IF(fieldOffsetInWindow + sizeof(TagSizeT) > windowSize || windowOffset + windowSize > packetSize);
+    const int fieldMask = static_cast<int>(maxNBitValue(sizeof(TagSizeT)) << fieldOffsetInWindow);
+
+    __m128i clearedValue;
+    if constexpr (sizeof(TagSizeT) == sizeof(uint64_t)) {
+        clearedValue = _mm_set1_epi64x(static_cast<int64_t>(static_cast<TagSizeT>(Event::STATE_CLEARED)));
+    } else {
+        clearedValue = _mm_set1_epi32(static_cast<int32_t>(Event::STATE_CLEARED));
+    }
+
+    auto window = ptrOffset(packets, windowOffset);
+    for (uint32_t packet = 0; packet < packetCount; packet++) {
+        auto packetWindow = _mm_loadu_si128(static_cast<const __m128i *>(window));
+        auto clearedBytes = _mm_movemask_epi8(_mm_cmpeq_epi8(packetWindow, clearedValue));
+        if ((clearedBytes & fieldMask) == fieldMask) {
+            return false;
+        }
+        window = ptrOffset(window, packetSize);
+    }
+    return true;
+}
+
+template bool arePacketsSignaled<uint32_t>(const void *, uint32_t, size_t, size_t);
+template bool arePacketsSignaled<uint64_t>(const void *, uint32_t, size_t, size_t);
+
+ze_result_t queryStatus(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t *completionBitmap) {
+    std::fill_n(completionBitmap, getBitmapWordCount(numEvents), 0u);
+
+    uint32_t signaledCount = 0;
+    for (uint32_t i = 0; i < numEvents; i++) {
+        if (Event::fromHandle(phEvents[i])->queryStatusWithPacketScan() == ZE_RESULT_SUCCESS) {
+            completionBitmap[i / 64u] |= (1ull << (i % 64u));
+            signaledCount++;
+        }
+    }
+    return signaledCount == numEvents ? ZE_RESULT_SUCCESS : ZE_RESULT_NOT_READY;
+}
+
+namespace {
+
+ze_result_t synchronize(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout, bool waitForAll, uint32_t *signaledEventIndex) {
+    constexpr std::chrono::microseconds gpuHangCheckPeriod{500'000};
+
+    if (NEO::DebugManager.flags.OverrideEventSynchronizeTimeout.get() != -1) {
+        timeout = NEO::DebugManager.flags.OverrideEventSynchronizeTimeout.get();
+    }
+
+    std::vector<uint64_t> completionBitmap(getBitmapWordCount(numEvents));
+    uint32_t signaledCount = 0;
+
+    const auto waitStartTime = std::chrono::steady_clock::now();
+    auto lastHangCheckTime = waitStartTime;
+    while (true) {
+        for (uint32_t i = 0; i < numEvents; i++) {
+            if (completionBitmap[i / 64u] & (1ull << (i % 64u))) {
+                continue;
+            }
+            auto event = Event::fromHandle(phEvents[i]);
+            bool signaled = event->getCsr()->getType() == NEO::CommandStreamReceiverType::CSR_AUB ||
+                            event->queryStatusWithPacketScan() == ZE_RESULT_SUCCESS;
+            if (!signaled) {
+                continue;
+            }
+
+            // Completed event is synchronized once to handle printf and assert output.
+            auto result = event->hostSynchronize(0u);
+            if (result != ZE_RESULT_SUCCESS) {
+                return result;
+            }
+            completionBitmap[i / 64u] |= (1ull << (i % 64u));
+            signaledCount++;
+
+            if (!waitForAll) {
+                if (signaledEventIndex) {
+                    *signaledEventIndex = i;
+                }
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+
+        if (signaledCount == numEvents) {
+            return ZE_RESULT_SUCCESS;
+        }
+
+        const auto currentTime = std::chrono::steady_clock::now();
+        if (currentTime - lastHangCheckTime >= gpuHangCheckPeriod) {
+            lastHangCheckTime = currentTime;
+            for (uint32_t i = 0; i < numEvents; i++) {
+                if (!(completionBitmap[i / 64u] & (1ull << (i % 64u))) && Event::fromHandle(phEvents[i])->getCsr()->isGpuHangDetected()) {
+                    return ZE_RESULT_ERROR_DEVICE_LOST;
+                }
+            }
+        }
+
+        if (timeout == 0) {
+            return ZE_RESULT_NOT_READY;
+        }
+        if (timeout != std::numeric_limits<uint64_t>::max() &&
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count()) >= timeout) {
+            return ZE_RESULT_NOT_READY;
+        }
+        std::this_thread::yield();
+    }
+}
+
+} // namespace
+
+ze_result_t hostSynchronizeAll(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout) {
+    return synchronize(numEvents, phEvents, timeout, true, nullptr);
+}
+
+ze_result_t hostSynchronizeAny(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout, uint32_t *signaledEventIndex) {
+    if (numEvents == 0) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return synchronize(numEvents, phEvents, timeout, false, signaledEventIndex);
+}
+
+} // namespace EventBatchQuery
+
+} // namespace L0
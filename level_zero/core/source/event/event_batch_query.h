@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <level_zero/ze_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace L0 {
+
+namespace EventBatchQuery {
+
+constexpr uint32_t getBitmapWordCount(uint32_t numEvents) {
+    return (numEvents + 63u) / 64u;
+}
+
+// Returns true when completion field of every packet differs from the cleared state.
+template <typename TagSizeT>
+bool arePacketsSignaled(const void *packets, uint32_t packetCount, size_t packetSize, size_t completionFieldOffset);
+
+// Sets bit i of completionBitmap when event i is signaled. Returns ZE_RESULT_SUCCESS when all events are signaled.
+ze_result_t queryStatus(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t *completionBitmap);
+
+ze_result_t hostSynchronizeAll(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout);
+
+// Waits until any event is signaled and stores index of the first signaled event found in signaledEventIndex.
+ze_result_t hostSynchronizeAny(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout, uint32_t *signaledEventIndex);
+
+} // namespace EventBatchQuery
+
+} // namespace L0
@@ -22,6 +22,28 @@ class KernelEventCompletionData : public NEO::TimestampPackets<TagSizeT> {
     uint32_t packetsUsed = 1;
 };
 
+template <typename TagSizeT>
+struct KernelEventCompletionDataDeleter {
+    KernelEventCompletionDataDeleter() = default;
+    KernelEventCompletionDataDeleter(std::default_delete<KernelEventCompletionData<TagSizeT>[]>) {}
+    KernelEventCompletionDataDeleter(std::shared_ptr<EventPacketPool> packetPool, const EventPacketPool::Blocks &blocks) : packetPool(std::move(packetPool)), blocks(blocks) {}
+
+    void operator()(KernelEventCompletionData<TagSizeT> *completionData) const {
+        if (packetPool) {
+            for (uint32_t i = 0; i < blocks.blockCount; i++) {
+                completionData[i].~KernelEventCompletionData<TagSizeT>();
+            }
+            packetPool->release(blocks);
+        } else {
+            delete[] completionData;
+        }
+    }
+
+    // Shared with the event pool, so completion data can outlive a pool destroyed before its events.
+    std::shared_ptr<EventPacketPool> packetPool;
+    EventPacketPool::Blocks blocks;
+};
+
 template <typename TagSizeT>
 struct EventImp : public Event {
 
@@ -43,6 +65,8 @@ struct EventImp : public Event {
 
     ze_result_t queryStatus() override;
 
+    ze_result_t queryStatusWithPacketScan() override;
+
     ze_result_t reset() override;
 
     ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) override;
@@ -55,18 +79,24 @@ struct EventImp : public Event {
     uint32_t getPacketsInUse() const override;
     uint32_t getPacketsUsedInLastKernel() override;
     void setPacketsInUse(uint32_t value) override;
+    void increaseKernelCount() override;
 
-    std::unique_ptr<KernelEventCompletionData<TagSizeT>[]> kernelEventCompletionData;
+    std::unique_ptr<KernelEventCompletionData<TagSizeT>[], KernelEventCompletionDataDeleter<TagSizeT>> kernelEventCompletionData;
 
     const bool downloadAllocationRequired = false;
 
   protected:
     ze_result_t calculateProfilingData();
     ze_result_t queryStatusEventPackets();
+    ze_result_t flushPendingCoalescedCommands();
+    void handleCompletion();
     MOCKABLE_VIRTUAL ze_result_t hostEventSetValue(TagSizeT eventValue);
     ze_result_t hostEventSetValueTimestamps(TagSizeT eventVal);
     MOCKABLE_VIRTUAL void assignKernelEventCompletionData(void *address);
     void setRemainingPackets(TagSizeT eventVal, void *nextPacketAddress, uint32_t packetsAlreadySet);
+    void allocateKernelEventCompletionData(std::shared_ptr<EventPacketPool> packetPool, uint32_t kernelCount);
+    void resetAllEventPackets();
+    void makeEventAllocationTbxWritable();
 };
 
 } // namespace L0
\ No newline at end of file
@@ -12,6 +12,8 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/os_interface/os_time.h"
 
+#include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/core/source/event/event_batch_query.h"
 #include "level_zero/core/source/event/event_imp.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/kernel/kernel.h"
@@ -48,8 +50,12 @@ Event *Event::create(EventPool *eventPool, const ze_event_desc_t *desc, Device *
     event->maxPacketCount = eventPool->getEventMaxPackets();
     event->isFromIpcPool = eventPool->getImportedIpcPool();
 
-    event->kernelEventCompletionData =
-        std::make_unique<KernelEventCompletionData<TagSizeT>[]>(event->maxKernelCount);
+    if (auto packetPool = eventPool->getPacketPool()) {
+        event->allocateKernelEventCompletionData(packetPool, 1u);
+    } else {
+        event->kernelEventCompletionData =
+            std::make_unique<KernelEventCompletionData<TagSizeT>[]>(event->maxKernelCount);
+    }
 
     bool useContextEndOffset = l0GfxCoreHelper.multiTileCapablePlatform();
     int32_t overrideUseContextEndOffset = NEO::DebugManager.flags.UseContextEndOffsetForEventCompletion.get();
@@ -167,16 +173,34 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
             }
         }
     }
+    handleCompletion();
+    return ZE_RESULT_SUCCESS;
+}
+
+template <typename TagSizeT>
+void EventImp<TagSizeT>::handleCompletion() {
     if (this->downloadAllocationRequired) {
         this->csr->downloadAllocations();
     }
     this->setIsCompleted();
     this->csr->getInternalAllocationStorage()->cleanAllocationList(this->csr->peekTaskCount(), NEO::AllocationUsage::TEMPORARY_ALLOCATION);
-    return ZE_RESULT_SUCCESS;
+}
+
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::flushPendingCoalescedCommands() {
+    auto driverHandle = static_cast<DriverHandleImp *>(this->device->getDriverHandle());
+    if (driverHandle == nullptr) {
+        return ZE_RESULT_SUCCESS;
+    }
+    return driverHandle->flushPendingCoalescedCommands();
 }
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::queryStatus() {
+    auto ret = flushPendingCoalescedCommands();
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
     if (metricStreamer != nullptr) {
         hostEventSetValue(metricStreamer->getNotificationState());
     }
@@ -191,6 +215,32 @@ ze_result_t EventImp<TagSizeT>::queryStatus() {
     }
 }
 
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::queryStatusWithPacketScan() {
+    if (metricStreamer != nullptr || this->downloadAllocationRequired) {
+        return queryStatus();
+    }
+    auto ret = flushPendingCoalescedCommands();
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+    if (!this->isFromIpcPool && isAlreadyCompleted()) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    uint32_t packetsToCheck = getPacketsInUse();
+    if (this->signalAllEventPackets) {
+        packetsToCheck = std::max(packetsToCheck, getMaxPacketsCount());
+    }
+    packetsToCheck = std::min(packetsToCheck, static_cast<uint32_t>(totalEventSize / singlePacketSize));
+
+    if (!EventBatchQuery::arePacketsSignaled<TagSizeT>(this->hostAddress, packetsToCheck, singlePacketSize, getCompletionFieldOffset())) {
+        return ZE_RESULT_NOT_READY;
+    }
+    handleCompletion();
+    return ZE_RESULT_SUCCESS;
+}
+
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::hostEventSetValueTimestamps(TagSizeT eventVal) {
 
@@ -229,7 +279,12 @@ ze_result_t EventImp<TagSizeT>::hostEventSetValueTimestamps(TagSizeT eventVal) {
     const auto dataSize = 4u * EventPacketsCount::maxKernelSplit * NEO::TimestampPacketSizeControl::preferredPacketCount;
     TagSizeT tagValues[dataSize];
 
-    for (uint32_t index = 0u; index < dataSize; index++) {
+    // Pooled completion data is sized for the kernels in use, so only their packets are copied back.
+    auto usedDataSize = dataSize;
+    if (kernelEventCompletionData.get_deleter().packetPool) {
+        usedDataSize = std::min(dataSize, 4u * getPacketsInUse());
+    }
+    for (uint32_t index = 0u; index < usedDataSize; index++) {
         tagValues[index] = eventVal;
     }
 
@@ -264,18 +319,23 @@ ze_result_t EventImp<TagSizeT>::hostEventSetValue(TagSizeT eventVal) {
     }
 
     if (this->downloadAllocationRequired) {
-        auto memoryIface = this->device->getNEODevice()->getRootDeviceEnvironment().memoryOperationsInterface.get();
-
-        auto eventAllocation = &this->getAllocation(device);
-        ArrayRef<NEO::GraphicsAllocation *> allocationArray(&eventAllocation, 1);
-        memoryIface->makeResident(nullptr, allocationArray);
-
-        constexpr uint32_t allBanks = std::numeric_limits<uint32_t>::max();
-        eventAllocation->setTbxWritable(true, allBanks);
+        makeEventAllocationTbxWritable();
     }
     return ZE_RESULT_SUCCESS;
 }
 
+template <typename TagSizeT>
+void EventImp<TagSizeT>::makeEventAllocationTbxWritable() {
+    auto memoryIface = this->device->getNEODevice()->getRootDeviceEnvironment().memoryOperationsInterface.get();
+
+    auto eventAllocation = &this->getAllocation(device);
+    ArrayRef<NEO::GraphicsAllocation *> allocationArray(&eventAllocation, 1);
+    memoryIface->makeResident(nullptr, allocationArray);
+
+    constexpr uint32_t allBanks = std::numeric_limits<uint32_t>::max();
+    eventAllocation->setTbxWritable(true, allBanks);
+}
+
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::hostSignal() {
     auto status = hostEventSetValue(Event::STATE_SIGNALED);
@@ -356,6 +416,12 @@ ze_result_t EventImp<TagSizeT>::reset() {
 template <typename TagSizeT>
 void EventImp<TagSizeT>::resetDeviceCompletionData(bool resetAllPackets) {
 
+    if (resetAllPackets && kernelEventCompletionData.get_deleter().packetPool) {
+        resetAllEventPackets();
+        this->resetPackets(true);
+        return;
+    }
+
     if (resetAllPackets) {
         this->kernelCount = this->maxKernelCount;
         for (uint32_t i = 0; i < kernelCount; i++) {
@@ -470,6 +536,48 @@ void EventImp<TagSizeT>::setPacketsInUse(uint32_t value) {
     kernelEventCompletionData[getCurrKernelDataIndex()].setPacketsUsed(value);
 }
 
+template <typename TagSizeT>
+void EventImp<TagSizeT>::resetAllEventPackets() {
+    // Completion data is kept only for kernels in use, so whole event storage is cleared directly.
+    const TagSizeT initialValue = Event::STATE_INITIAL;
+    for (size_t offset = 0; offset + sizeof(TagSizeT) <= totalEventSize; offset += sizeof(TagSizeT)) {
+        memcpy_s(ptrOffset(this->hostAddress, offset), sizeof(TagSizeT), &initialValue, sizeof(TagSizeT));
+    }
+    if (this->downloadAllocationRequired) {
+        makeEventAllocationTbxWritable();
+    }
+    this->kernelCount = 1;
+    this->kernelEventCompletionData[0].setPacketsUsed(1);
+    assignKernelEventCompletionData(this->hostAddress);
+}
+
+template <typename TagSizeT>
+void EventImp<TagSizeT>::increaseKernelCount() {
+    Event::increaseKernelCount();
+
+    auto &deleter = kernelEventCompletionData.get_deleter();
+    if (deleter.packetPool && this->kernelCount > deleter.blocks.blockCount) {
+        allocateKernelEventCompletionData(deleter.packetPool, this->kernelCount);
+    }
+}
+
+template <typename TagSizeT>
+void EventImp<TagSizeT>::allocateKernelEventCompletionData(std::shared_ptr<EventPacketPool> packetPool, uint32_t kernelCount) {
+    auto blocks = packetPool->acquire(sizeof(KernelEventCompletionData<TagSizeT>), kernelCount);
+    auto completionData = static_cast<KernelEventCompletionData<TagSizeT> *>(blocks.address);
+
+    uint32_t previousCount = kernelEventCompletionData ? kernelEventCompletionData.get_deleter().blocks.blockCount : 0u;
+    for (uint32_t i = 0; i < kernelCount; i++) {
+        new (&completionData[i]) KernelEventCompletionData<TagSizeT>();
+        if (i < previousCount) {
+            completionData[i] = kernelEventCompletionData[i];
+        }
+    }
+
+    kernelEventCompletionData = std::unique_ptr<KernelEventCompletionData<TagSizeT>[], KernelEventCompletionDataDeleter<TagSizeT>>(
+        completionData, KernelEventCompletionDataDeleter<TagSizeT>(std::move(packetPool), blocks));
+}
+
 template <typename TagSizeT>
 void EventImp<TagSizeT>::resetKernelCountAndPacketUsedCount() {
     for (auto i = 0u; i < this->kernelCount; i++) {
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_packet_pool.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+
+namespace L0 {
+
+EventPacketPool::Blocks EventPacketPool::acquire(size_t blockSize, uint32_t blockCount) {
+    UNRECOVERABLE_IF(blockSize == 0 || blockCount == 0 || blockCount > blocksPerChunk);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (this->blockSize == 0) {
+        this->blockSize = blockSize;
+    }
+    UNRECOVERABLE_IF(this->blockSize != blockSize);
+
+    Blocks blocks;
+    blocks.blockCount = blockCount;
+
+    bool found = false;
+    for (uint32_t wordIndex = 0; wordIndex < chunksWithFreeBlocks.size() && !found; wordIndex++) {
+        auto candidates = chunksWithFreeBlocks[wordIndex];
+        while (candidates != 0 && !found) {
+            auto bitIndex = static_cast<uint32_t>(Math::ffs(candidates));
+            candidates &= ~(1ull << bitIndex);
+            blocks.chunkIndex = wordIndex * 64u + bitIndex;
+            found = findFreeRun(chunks[blocks.chunkIndex].freeBlocks, blockCount, blocks.firstBlock);
+        }
+    }
+
+    if (!found) {
+        addChunk();
+        blocks.chunkIndex = static_cast<uint32_t>(chunks.size() - 1);
+        blocks.firstBlock = 0u;
+    }
+
+    auto &chunk = chunks[blocks.chunkIndex];
+    auto runMask = maxNBitValue(blockCount) << blocks.firstBlock;
+    chunk.freeBlocks &= ~runMask;
+    updateChunkState(blocks.chunkIndex);
+    usedBlockCount += blockCount;
+
+    blocks.address = ptrOffset(chunk.storage.get(), blocks.firstBlock * this->blockSize);
+    return blocks;
+}
+
+void EventPacketPool::release(const Blocks &blocks) {
+    std::lock_guard<std::mutex> lock(mutex);
+    UNRECOVERABLE_IF(blocks.chunkIndex >= chunks.size());
+
+    auto runMask = maxNBitValue(blocks.blockCount) << blocks.firstBlock;
+    auto &chunk = chunks[blocks.chunkIndex];
+    DEBUG_BREAK_IF((chunk.freeBlocks & runMask) != 0);
+    chunk.freeBlocks |= runMask;
+    updateChunkState(blocks.chunkIndex);
+    usedBlockCount -= blocks.blockCount;
+}
+
+bool EventPacketPool::findFreeRun(uint64_t freeBlocks, uint32_t blockCount, uint32_t &firstBlock) {
+    // A bit stays set only if it starts a run of blockCount free blocks.
+    auto runStarts = freeBlocks;
+    for (uint32_t shift = 1; shift < blockCount && runStarts != 0; shift++) {
+        runStarts &= freeBlocks >> shift;
+    }
+    if (runStarts == 0) {
+        return false;
+    }
+    firstBlock = static_cast<uint32_t>(Math::ffs(runStarts));
+    return true;
+}
+
+void EventPacketPool::addChunk() {
+    Chunk chunk;
+    chunk.storage = std::make_unique<uint8_t[]>(blocksPerChunk * blockSize);
+    chunks.push_back(std::move(chunk));
+
+    auto chunkIndex = static_cast<uint32_t>(chunks.size() - 1);
+    if (chunkIndex / 64u >= chunksWithFreeBlocks.size()) {
+        chunksWithFreeBlocks.push_back(0u);
+    }
+    updateChunkState(chunkIndex);
+}
+
+void EventPacketPool::updateChunkState(uint32_t chunkIndex) {
+    auto &word = chunksWithFreeBlocks[chunkIndex / 64u];
+    auto bit = 1ull << (chunkIndex % 64u);
+    if (chunks[chunkIndex].freeBlocks != 0) {
+        word |= bit;
+    } else {
+        word &= ~bit;
+    }
+}
+
+} // namespace L0
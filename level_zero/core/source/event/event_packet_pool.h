@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace L0 {
+
+// Host-side storage for per-kernel event completion data, shared by all events of an event pool.
+// Blocks are grouped in chunks of 64 tracked by a free-block bitmap each, and a second-level
+// bitmap marks chunks that still have free blocks. Chunks are added on demand.
+class EventPacketPool : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t blocksPerChunk = 64u;
+
+    struct Blocks {
+        void *address = nullptr;
+        uint32_t chunkIndex = 0u;
+        uint32_t firstBlock = 0u;
+        uint32_t blockCount = 0u;
+    };
+
+    Blocks acquire(size_t blockSize, uint32_t blockCount);
+    void release(const Blocks &blocks);
+
+    size_t getBlockSize() const { return blockSize; }
+    size_t getChunkCount() const { return chunks.size(); }
+    size_t getReservedSize() const { return chunks.size() * blocksPerChunk * blockSize; }
+    uint32_t getUsedBlockCount() const { return usedBlockCount; }
+
+  protected:
+    struct Chunk {
+        std::unique_ptr<uint8_t[]> storage;
+        uint64_t freeBlocks = std::numeric_limits<uint64_t>::max();
+    };
+
+    static bool findFreeRun(uint64_t freeBlocks, uint32_t blockCount, uint32_t &firstBlock);
+    void addChunk();
+    void updateChunkState(uint32_t chunkIndex);
+
+    std::vector<Chunk> chunks;
+    std::vector<uint64_t> chunksWithFreeBlocks;
+    std::mutex mutex;
+    size_t blockSize = 0u;
+    uint32_t usedBlockCount = 0u;
+};
+
+} // namespace L0
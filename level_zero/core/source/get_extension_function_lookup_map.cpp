@@ -25,6 +25,13 @@ std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
 
     addToMap(lookupMap, zexCommandListAppendWaitOnMemory);
     addToMap(lookupMap, zexCommandListAppendWriteToMemory);
+    addToMap(lookupMap, zexCommandListFlushPendingCommands);
+
+    addToMap(lookupMap, zexMetricStreamerStartStreaming);
+    addToMap(lookupMap, zexMetricStreamerStopStreaming);
+    addToMap(lookupMap, zexMetricStreamerGetStreamedBatches);
+    addToMap(lookupMap, zexMetricStreamerGetReportTimestamps);
+    addToMap(lookupMap, zexMetricStreamerReleaseStreamedBatches);
 #undef addToMap
 
     return lookupMap;
@@ -21,9 +21,11 @@
 struct _ze_kernel_handle_t {};
 
 namespace NEO {
+class CommandStreamReceiver;
 class Device;
 struct KernelInfo;
 class MemoryManager;
+class PrintfFormatCache;
 } // namespace NEO
 
 namespace L0 {
@@ -63,6 +65,8 @@ struct KernelImmutableData {
 
     const NEO::KernelInfo *getKernelInfo() const { return kernelInfo; }
 
+    NEO::PrintfFormatCache *getPrintfFormatCache() const { return printfFormatCache.get(); }
+
     void setIsaCopiedToAllocation() {
         isaCopiedToAllocation = true;
     }
@@ -90,6 +94,7 @@ struct KernelImmutableData {
     std::unique_ptr<uint8_t[]> dynamicStateHeapTemplate = nullptr;
 
     std::vector<NEO::GraphicsAllocation *> residencyContainer;
+    std::unique_ptr<NEO::PrintfFormatCache> printfFormatCache;
 
     bool isaCopiedToAllocation = false;
 };
@@ -142,6 +147,8 @@ struct Kernel : _ze_kernel_handle_t, virtual NEO::DispatchKernelEncoderI {
 
     virtual NEO::GraphicsAllocation *getPrintfBufferAllocation() = 0;
     virtual void printPrintfOutput(bool hangDetected) = 0;
+    virtual void drainPrintfOutput() = 0;
+    virtual void setPrintfTaskCountToWait(NEO::CommandStreamReceiver *csr, TaskCountType taskCount) = 0;
 
     virtual bool usesSyncBuffer() = 0;
     virtual void patchSyncBuffer(NEO::GraphicsAllocation *gfxAllocation, size_t bufferOffset) = 0;
@@ -8,6 +8,7 @@
 #include "level_zero/core/source/kernel/kernel_imp.h"
 
 #include "shared/source/assert_handler/assert_handler.h"
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
@@ -31,6 +32,7 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/kernel_info.h"
+#include "shared/source/program/print_formatter.h"
 #include "shared/source/program/work_size_info.h"
 #include "shared/source/utilities/arrayref.h"
 
@@ -42,6 +44,7 @@
 #include "level_zero/core/source/kernel/sampler_patch_values.h"
 #include "level_zero/core/source/module/module.h"
 #include "level_zero/core/source/module/module_imp.h"
+#include "level_zero/core/source/printf_handler/printf_drainer.h"
 #include "level_zero/core/source/printf_handler/printf_handler.h"
 #include "level_zero/core/source/sampler/sampler.h"
 
@@ -154,6 +157,10 @@ ze_result_t KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device
         this->residencyContainer.push_back(globalVarBuffer);
     }
 
+    if (kernelDescriptor->kernelAttributes.flags.usesPrintf) {
+        printfFormatCache = std::make_unique<NEO::PrintfFormatCache>();
+    }
+
     return ZE_RESULT_SUCCESS;
 }
 
@@ -209,6 +216,8 @@ uint32_t KernelImmutableData::getIsaSize() const {
 KernelImp::KernelImp(Module *module) : module(module) {}
 
 KernelImp::~KernelImp() {
+    unregisterFromPrintfDrainer();
+
     if (nullptr != privateMemoryGraphicsAllocation) {
         module->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(privateMemoryGraphicsAllocation);
     }
@@ -218,7 +227,7 @@ KernelImp::~KernelImp() {
     }
     if (printfBuffer != nullptr) {
         // not allowed to call virtual function on destructor, so calling printOutput directly
-        PrintfHandler::printOutput(kernelImmData, this->printfBuffer, module->getDevice(), false);
+        PrintfHandler::printOutput(kernelImmData, this->printfBuffer, module->getDevice(), false, printfDrainedOffset);
         module->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(printfBuffer);
     }
 
@@ -238,6 +247,7 @@ ze_result_t KernelImp::setArgumentValue(uint32_t argIndex, size_t argSize,
     if (argIndex >= kernelArgHandlers.size()) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    updateStateVersion();
     return (this->*kernelArgHandlers[argIndex])(argIndex, argSize, pArgValue);
 }
 
@@ -287,6 +297,7 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
         this->groupSize[2] == groupSizeZ) {
         return ZE_RESULT_SUCCESS;
     }
+    updateStateVersion();
 
     auto numChannels = kernelImmData->getDescriptor().kernelAttributes.numLocalIdChannels;
     Vec3<size_t> groupSize{groupSizeX, groupSizeY, groupSizeZ};
@@ -358,6 +369,24 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
     return ZE_RESULT_SUCCESS;
 }
 
+namespace {
+struct GroupSizeSuggestion {
+    uint64_t kernelId;
+    uint32_t globalSize[3];
+    uint32_t maxWorkGroupSize;
+    uint32_t slmTotalSize;
+    uint32_t groupSize[3];
+};
+
+// Every thread has its own direct-mapped table, so lookups need neither locks nor atomics.
+// Kernel ids are never reused, so entries of destroyed kernels are never hit again.
+constexpr size_t groupSizeSuggestionCacheSize = 64;
+thread_local GroupSizeSuggestion groupSizeSuggestionCache[groupSizeSuggestionCacheSize] = {};
+} // namespace
+
+std::atomic<uint64_t> KernelImp::groupSizeSuggestionCacheIdCounter{1};
+std::atomic<uint64_t> KernelImp::stateVersionCounter{1};
+
 ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSizeY,
                                         uint32_t globalSizeZ, uint32_t *groupSizeX,
                                         uint32_t *groupSizeY, uint32_t *groupSizeZ) {
@@ -365,6 +394,24 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
     const auto &kernelDescriptor = this->getImmutableData()->getDescriptor();
     auto maxWorkGroupSize = module->getMaxGroupSize(kernelDescriptor);
     auto simd = kernelDescriptor.kernelAttributes.simdSize;
+
+    GroupSizeSuggestion *cacheEntry = nullptr;
+    if (NEO::DebugManager.flags.EnableKernelGroupSizeSuggestionCache.get() == 1) {
+        const auto slmTotalSize = this->getSlmTotalSize();
+        const uint64_t hash = (groupSizeSuggestionCacheId * 0x9e3779b97f4a7c15ull) ^
+                              (globalSizeX * 0x85ebca77ull) ^ (globalSizeY * 0xc2b2ae3dull) ^ (globalSizeZ * 0x27d4eb2full);
+        cacheEntry = &groupSizeSuggestionCache[(hash >> 32) % groupSizeSuggestionCacheSize];
+
+        if (cacheEntry->kernelId == groupSizeSuggestionCacheId &&
+            cacheEntry->globalSize[0] == globalSizeX && cacheEntry->globalSize[1] == globalSizeY && cacheEntry->globalSize[2] == globalSizeZ &&
+            cacheEntry->maxWorkGroupSize == maxWorkGroupSize && cacheEntry->slmTotalSize == slmTotalSize) {
+            *groupSizeX = cacheEntry->groupSize[0];
+            *groupSizeY = cacheEntry->groupSize[1];
+            *groupSizeZ = cacheEntry->groupSize[2];
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     size_t workItems[3] = {globalSizeX, globalSizeY, globalSizeZ};
     uint32_t dim = (globalSizeY > 1U) ? 2 : 1U;
     dim = (globalSizeZ > 1U) ? 3 : dim;
@@ -398,6 +445,14 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
     *groupSizeY = static_cast<uint32_t>(retGroupSize[1]);
     *groupSizeZ = static_cast<uint32_t>(retGroupSize[2]);
 
+    if (cacheEntry) {
+        *cacheEntry = {groupSizeSuggestionCacheId,
+                       {globalSizeX, globalSizeY, globalSizeZ},
+                       maxWorkGroupSize,
+                       this->getSlmTotalSize(),
+                       {*groupSizeX, *groupSizeY, *groupSizeZ}};
+    }
+
     return ZE_RESULT_SUCCESS;
 }
 
@@ -443,6 +498,7 @@ ze_result_t KernelImp::setIndirectAccess(ze_kernel_indirect_access_flags_t flags
     if (NEO::DebugManager.flags.DisableIndirectAccess.get() == 1) {
         return ZE_RESULT_SUCCESS;
     }
+    updateStateVersion();
 
     if (flags & ZE_KERNEL_INDIRECT_ACCESS_FLAG_DEVICE) {
         this->unifiedMemoryControls.indirectDeviceAllocationsAllowed = true;
@@ -514,6 +570,7 @@ ze_result_t KernelImp::setArgImmediate(uint32_t argIndex, size_t argSize, const
 
 ze_result_t KernelImp::setArgRedescribedImage(uint32_t argIndex, ze_image_handle_t argVal) {
     const auto &arg = kernelImmData->getDescriptor().payloadMappings.explicitArgs[argIndex].as<NEO::ArgDescImage>();
+    updateStateVersion();
     if (argVal == nullptr) {
         residencyContainer[argIndex] = nullptr;
         return ZE_RESULT_SUCCESS;
@@ -529,6 +586,7 @@ ze_result_t KernelImp::setArgRedescribedImage(uint32_t argIndex, ze_image_handle
 ze_result_t KernelImp::setArgBufferWithAlloc(uint32_t argIndex, uintptr_t argVal, NEO::GraphicsAllocation *allocation) {
     const auto &arg = kernelImmData->getDescriptor().payloadMappings.explicitArgs[argIndex].as<NEO::ArgDescPointer>();
     const auto val = argVal;
+    updateStateVersion();
 
     NEO::patchPointer(ArrayRef<uint8_t>(crossThreadData.get(), crossThreadDataSize), arg, val);
     if (NEO::isValidOffset(arg.bindful) || NEO::isValidOffset(arg.bindless)) {
@@ -994,12 +1052,69 @@ void KernelImp::createPrintfBuffer() {
         if (pImplicitArgs) {
             pImplicitArgs->printfBufferPtr = printfBuffer->getGpuAddress();
         }
+        if (this->kernelImmData->getDescriptor().kernelAttributes.flags.usesPrintf) {
+            this->printfDrainer = this->module->getDevice()->getPrintfDrainer();
+            if (this->printfDrainer) {
+                this->printfDrainer->registerKernel(this);
+            }
+        }
     }
 }
 
 void KernelImp::printPrintfOutput(bool hangDetected) {
     std::lock_guard<std::mutex> lock(this->printfLock);
-    PrintfHandler::printOutput(kernelImmData, this->printfBuffer, module->getDevice(), hangDetected);
+    PrintfHandler::printOutput(kernelImmData, this->printfBuffer, module->getDevice(), hangDetected, printfDrainedOffset);
+    resetPrintfDrainState();
+}
+
+void KernelImp::drainPrintfOutput() {
+    std::lock_guard<std::mutex> lock(this->printfLock);
+    if (this->printfBuffer == nullptr) {
+        return;
+    }
+
+    if (printfCsr != nullptr && printfCsr->testTaskCountReady(printfCsr->getTagAddress(), printfTaskCountToWait)) {
+        // submission has completed, so every reserved record is fully written
+        PrintfHandler::printOutput(kernelImmData, this->printfBuffer, module->getDevice(), false, printfDrainedOffset);
+        resetPrintfDrainState();
+        return;
+    }
+
+    // Kernel may still be executing. Space for a record is reserved before its data is written, so only
+    // records reserved before the previous drain are printed, giving them a full drain interval to complete.
+    auto writeOffset = PrintfHandler::getWriteOffset(this->printfBuffer);
+    auto drainEndOffset = std::min(writeOffset, printfObservedOffset);
+    printfDrainedOffset = PrintfHandler::drainOutput(kernelImmData, this->printfBuffer, printfDrainedOffset, drainEndOffset);
+    printfObservedOffset = writeOffset;
+}
+
+void KernelImp::resetPrintfDrainState() {
+    printfCsr = nullptr;
+    printfDrainedOffset = 0u;
+    printfObservedOffset = 0u;
+}
+
+void KernelImp::unregisterFromPrintfDrainer() {
+    if (printfDrainer != nullptr) {
+        printfDrainer->unregisterKernel(this);
+        printfDrainer = nullptr;
+    }
+}
+
+void KernelImp::flushPendingCoalescedCommands() {
+    if (this->module == nullptr) {
+        return;
+    }
+    auto driverHandle = static_cast<DriverHandleImp *>(this->module->getDevice()->getDriverHandle());
+    if (driverHandle != nullptr) {
+        driverHandle->flushPendingCoalescedCommands();
+    }
+}
+
+void KernelImp::setPrintfTaskCountToWait(NEO::CommandStreamReceiver *csr, TaskCountType taskCount) {
+    std::lock_guard<std::mutex> lock(this->printfLock);
+    printfCsr = csr;
+    printfTaskCountToWait = taskCount;
 }
 
 bool KernelImp::usesSyncBuffer() {
@@ -1056,6 +1171,7 @@ ze_result_t KernelImp::setGlobalOffsetExp(uint32_t offsetX,
     this->globalOffsets[0] = offsetX;
     this->globalOffsets[1] = offsetY;
     this->globalOffsets[2] = offsetZ;
+    updateStateVersion();
 
     return ZE_RESULT_SUCCESS;
 }
@@ -1096,6 +1212,7 @@ uint32_t KernelImp::getSlmTotalSize() const {
 
 ze_result_t KernelImp::setCacheConfig(ze_cache_config_flags_t flags) {
     cacheConfigFlags = flags;
+    updateStateVersion();
     return ZE_RESULT_SUCCESS;
 }
 
@@ -1118,6 +1235,7 @@ ze_result_t KernelImp::setSchedulingHintExp(ze_scheduling_hint_exp_desc_t *pHint
     } else {
         threadArbitrationPolicy = NEO::ThreadArbitrationPolicy::RoundRobinAfterDependency;
     }
+    updateStateVersion();
     return ZE_RESULT_SUCCESS;
 }
 
@@ -13,10 +13,12 @@
 
 #include "level_zero/core/source/kernel/kernel.h"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 
 namespace L0 {
+class PrintfDrainer;
 
 struct KernelExt {
     virtual ~KernelExt() = default;
@@ -35,6 +37,9 @@ struct KernelImp : Kernel {
     ~KernelImp() override;
 
     ze_result_t destroy() override {
+        // background printf drain calls virtual functions, so it must stop before destruction starts
+        unregisterFromPrintfDrainer();
+        flushPendingCoalescedCommands();
         delete this;
         return ZE_RESULT_SUCCESS;
     }
@@ -98,6 +103,8 @@ struct KernelImp : Kernel {
 
     NEO::GraphicsAllocation *getPrintfBufferAllocation() override { return this->printfBuffer; }
     void printPrintfOutput(bool hangDetected) override;
+    void drainPrintfOutput() override;
+    void setPrintfTaskCountToWait(NEO::CommandStreamReceiver *csr, TaskCountType taskCount) override;
 
     bool usesSyncBuffer() override;
     void patchSyncBuffer(NEO::GraphicsAllocation *gfxAllocation, size_t bufferOffset) override;
@@ -174,14 +181,22 @@ struct KernelImp : Kernel {
 
     void getExtendedKernelProperties(ze_base_desc_t *pExtendedProperties);
 
+    // Changes whenever arguments or launch properties set by the application change.
+    uint64_t getStateVersion() const { return stateVersion; }
+
   protected:
     KernelImp() = default;
 
+    void updateStateVersion() { stateVersion = stateVersionCounter++; }
+
     void patchWorkgroupSizeInCrossThreadData(uint32_t x, uint32_t y, uint32_t z);
 
     NEO::GraphicsAllocation *privateMemoryGraphicsAllocation = nullptr;
 
     void createPrintfBuffer();
+    void resetPrintfDrainState();
+    void unregisterFromPrintfDrainer();
+    void flushPendingCoalescedCommands();
     void setDebugSurface();
     void setAssertBuffer();
     virtual void evaluateIfRequiresGenerationOfLocalIdsByRuntime(const NEO::KernelDescriptor &kernelDescriptor) = 0;
@@ -196,6 +211,11 @@ struct KernelImp : Kernel {
     std::vector<NEO::GraphicsAllocation *> residencyContainer;
 
     NEO::GraphicsAllocation *printfBuffer = nullptr;
+    PrintfDrainer *printfDrainer = nullptr;
+    NEO::CommandStreamReceiver *printfCsr = nullptr; // submission whose printf output is not printed yet
+    TaskCountType printfTaskCountToWait = 0u;
+    uint32_t printfDrainedOffset = 0u;  // end of records already printed by drainer
+    uint32_t printfObservedOffset = 0u; // write offset seen by previous drain
 
     uint32_t groupSize[3] = {0u, 0u, 0u};
     uint32_t numThreadsPerThreadGroup = 1u;
@@ -233,6 +253,12 @@ struct KernelImp : Kernel {
 
     std::unique_ptr<NEO::ImplicitArgs> pImplicitArgs;
 
+    static std::atomic<uint64_t> groupSizeSuggestionCacheIdCounter;
+    uint64_t groupSizeSuggestionCacheId = groupSizeSuggestionCacheIdCounter++;
+
+    static std::atomic<uint64_t> stateVersionCounter;
+    uint64_t stateVersion = stateVersionCounter++;
+
     std::unique_ptr<KernelExt> pExtension;
     std::mutex printfLock;
 };
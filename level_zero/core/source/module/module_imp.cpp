@@ -40,7 +40,7 @@
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 
 #include "level_zero/core/source/device/device.h"
-#include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module_build_log.h"
@@ -1288,6 +1288,11 @@ bool ModuleImp::populateHostGlobalSymbolsMap(std::unordered_map<std::string, std
 ze_result_t ModuleImp::destroy() {
     notifyModuleDestroy();
 
+    auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
+    if (driverHandle != nullptr) {
+        driverHandle->flushPendingCoalescedCommands();
+    }
+
     auto tempHandle = debugModuleHandle;
     auto tempDevice = device;
     delete this;
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/printf_handler/printf_drainer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include "level_zero/core/source/kernel/kernel.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace L0 {
+
+PrintfDrainer::PrintfDrainer(std::chrono::microseconds drainInterval) : drainInterval(drainInterval) {}
+
+PrintfDrainer::~PrintfDrainer() {
+    stop();
+}
+
+void PrintfDrainer::registerKernel(Kernel *kernel) {
+    std::lock_guard<std::mutex> lock(kernelsMutex);
+    if (std::find(kernels.begin(), kernels.end(), kernel) == kernels.end()) {
+        kernels.push_back(kernel);
+    }
+
+    if (!drainerThread) {
+        keepRunning.store(true);
+        drainerThread = NEO::Thread::create(drainerThreadFunction, reinterpret_cast<void *>(this));
+    }
+}
+
+void PrintfDrainer::unregisterKernel(Kernel *kernel) {
+    std::lock_guard<std::mutex> lock(kernelsMutex);
+    kernels.erase(std::remove(kernels.begin(), kernels.end(), kernel), kernels.end());
+}
+
+void PrintfDrainer::drain() {
+    std::lock_guard<std::mutex> lock(kernelsMutex);
+    for (auto kernel : kernels) {
+        kernel->drainPrintfOutput();
+    }
+}
+
+void PrintfDrainer::stop() {
+    keepRunning.store(false);
+    if (drainerThread) {
+        drainerThread->join();
+        drainerThread.reset();
+    }
+}
+
+void *PrintfDrainer::drainerThreadFunction(void *arg) {
+    auto drainer = reinterpret_cast<PrintfDrainer *>(arg);
+
+    while (drainer->keepRunning.load()) {
+        drainer->drain();
+        drainer->sleep();
+    }
+    return nullptr;
+}
+
+void PrintfDrainer::sleep() {
+    std::this_thread::sleep_for(drainInterval);
+}
+
+} // namespace L0
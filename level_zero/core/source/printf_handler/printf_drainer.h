@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace L0 {
+struct Kernel;
+
+// Periodically prints printf output of registered kernels on a background thread, so output of
+// long-running kernels shows up while they execute, without host synchronization.
+class PrintfDrainer {
+  public:
+    PrintfDrainer(std::chrono::microseconds drainInterval);
+    virtual ~PrintfDrainer();
+
+    void registerKernel(Kernel *kernel);
+    void unregisterKernel(Kernel *kernel);
+    void drain();
+    void stop();
+
+  protected:
+    static void *drainerThreadFunction(void *arg);
+
+    MOCKABLE_VIRTUAL void sleep();
+
+    std::vector<Kernel *> kernels;
+    std::mutex kernelsMutex;
+
+    std::unique_ptr<NEO::Thread> drainerThread;
+    std::atomic_bool keepRunning{false};
+    std::chrono::microseconds drainInterval;
+};
+
+} // namespace L0
@@ -31,7 +31,8 @@ NEO::GraphicsAllocation *PrintfHandler::createPrintfBuffer(Device *device) {
 }
 
 void PrintfHandler::printOutput(const KernelImmutableData *kernelData,
-                                NEO::GraphicsAllocation *printfBuffer, Device *device, bool useInternalBlitter) {
+                                NEO::GraphicsAllocation *printfBuffer, Device *device, bool useInternalBlitter,
+                                uint32_t drainedOffset) {
     bool using32BitGpuPointers = kernelData->getDescriptor().kernelAttributes.gpuPointerSize == 4u;
     auto usesStringMap = kernelData->getDescriptor().kernelAttributes.usesStringMap();
 
@@ -72,13 +73,43 @@ void PrintfHandler::printOutput(const KernelImmutableData *kernelData,
         printfOutputBuffer,
         printfOutputSize,
         using32BitGpuPointers,
-        usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr};
-    printfFormatter.printKernelOutput();
+        usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr,
+        kernelData->getPrintfFormatCache()};
+
+    if (drainedOffset > PrintfHandler::printfSurfaceInitialDataSize) {
+        // records up to drained offset were already printed while the kernel was executing
+        auto writeOffset = *reinterpret_cast<uint32_t *>(printfOutputBuffer);
+        printfFormatter.printKernelOutputRange(drainedOffset, writeOffset);
+    } else {
+        printfFormatter.printKernelOutput();
+    }
 
     *reinterpret_cast<uint32_t *>(printfBuffer->getUnderlyingBuffer()) =
         PrintfHandler::printfSurfaceInitialDataSize;
 }
 
+uint32_t PrintfHandler::drainOutput(const KernelImmutableData *kernelData,
+                                   NEO::GraphicsAllocation *printfBuffer, uint32_t drainedOffset, uint32_t drainEndOffset) {
+    drainedOffset = std::max(drainedOffset, PrintfHandler::printfSurfaceInitialDataSize);
+    if (drainEndOffset <= drainedOffset) {
+        return drainedOffset;
+    }
+
+    auto usesStringMap = kernelData->getDescriptor().kernelAttributes.usesStringMap();
+    NEO::PrintFormatter printfFormatter{
+        static_cast<uint8_t *>(printfBuffer->getUnderlyingBuffer()),
+        static_cast<uint32_t>(printfBuffer->getUnderlyingBufferSize()),
+        kernelData->getDescriptor().kernelAttributes.gpuPointerSize == 4u,
+        usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr,
+        kernelData->getPrintfFormatCache()};
+    return printfFormatter.printKernelOutputRange(drainedOffset, drainEndOffset);
+}
+
+uint32_t PrintfHandler::getWriteOffset(NEO::GraphicsAllocation *printfBuffer) {
+    auto writeOffset = reinterpret_cast<volatile uint32_t *>(printfBuffer->getUnderlyingBuffer());
+    return *writeOffset;
+}
+
 size_t PrintfHandler::getPrintBufferSize() {
     return PrintfHandler::printfBufferSize;
 }
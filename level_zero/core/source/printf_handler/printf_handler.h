@@ -24,7 +24,11 @@ struct Device;
 struct PrintfHandler {
     static NEO::GraphicsAllocation *createPrintfBuffer(Device *device);
     static void printOutput(const KernelImmutableData *kernelData,
-                            NEO::GraphicsAllocation *printfBuffer, Device *device, bool useInternalBlitter);
+                            NEO::GraphicsAllocation *printfBuffer, Device *device, bool useInternalBlitter,
+                            uint32_t drainedOffset = 0u);
+    static uint32_t drainOutput(const KernelImmutableData *kernelData,
+                                NEO::GraphicsAllocation *printfBuffer, uint32_t drainedOffset, uint32_t drainEndOffset);
+    static uint32_t getWriteOffset(NEO::GraphicsAllocation *printfBuffer);
     static size_t getPrintBufferSize();
 
   protected:
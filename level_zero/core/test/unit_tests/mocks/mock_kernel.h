@@ -60,6 +60,8 @@ struct WhiteBox<::L0::Kernel> : public ::L0::KernelImp {
     using ::L0::KernelImp::perThreadDataSizeForWholeThreadGroup;
     using ::L0::KernelImp::pImplicitArgs;
     using ::L0::KernelImp::printfBuffer;
+    using ::L0::KernelImp::printfCsr;
+    using ::L0::KernelImp::printfTaskCountToWait;
     using ::L0::KernelImp::requiredWorkgroupOrder;
     using ::L0::KernelImp::residencyContainer;
     using ::L0::KernelImp::setAssertBuffer;
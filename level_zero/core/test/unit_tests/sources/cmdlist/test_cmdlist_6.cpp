@@ -11,18 +11,28 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_gmm_resource_info.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_cmdlist.h"
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
+#include "level_zero/core/source/cmdlist/pending_commands_flusher.h"
+#include "level_zero/core/source/event/event_batch_query.h"
 #include "level_zero/core/test/unit_tests/fixtures/cmdlist_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_event.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_image.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_module.h"
+
+#include <atomic>
+#include <numeric>
+#include <thread>
 
 namespace L0 {
 namespace ult {
@@ -2334,5 +2344,733 @@ HWTEST2_F(CommandListStateBaseAddressGlobalStatelessTest,
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, result);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+struct PendingSubmissionMockCommandListImmediateHw : public MockCommandListImmediateHw<gfxCoreFamily> {
+    using BaseClass = MockCommandListImmediateHw<gfxCoreFamily>;
+    using BaseClass::coalescedCommandCount;
+    using BaseClass::coalescedCommandsMutex;
+    using BaseClass::pendingCommandsFlusher;
+    using BaseClass::pendingReplayedLaunches;
+    using BaseClass::performCpuImageCopyFromMemory;
+    using BaseClass::preferCpuImageCopy;
+    using BaseClass::recordedLaunches;
+    using BaseClass::releaseCompletedRetiredLaunches;
+    using BaseClass::retiredLaunches;
+};
+
+struct ImmediateCommandListPendingSubmissionTest : public CommandListTest {
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    std::unique_ptr<PendingSubmissionMockCommandListImmediateHw<gfxCoreFamily>> createCommandList(bool syncMode) {
+        auto cmdList = std::make_unique<PendingSubmissionMockCommandListImmediateHw<gfxCoreFamily>>();
+        cmdList->isFlushTaskSubmissionEnabled = true;
+        cmdList->cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+        cmdList->isSyncModeQueue = syncMode;
+        cmdList->initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+        auto csr = device->getNEODevice()->getDefaultEngine().commandStreamReceiver;
+        cmdList->setCsr(csr);
+        cmdList->getCmdContainer().setImmediateCmdListCsr(csr);
+        return cmdList;
+    }
+
+    DebugManagerStateRestore restorer;
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+};
+
+struct ImmediateCommandListCoalescedFlushTest : public ImmediateCommandListPendingSubmissionTest {
+    ImmediateCommandListCoalescedFlushTest() {
+        DebugManager.flags.EnableImmediateCmdListCoalescedFlush.set(1);
+        DebugManager.flags.ImmediateCmdListCoalescedFlushMaxDelayUs.set(std::numeric_limits<int32_t>::max());
+    }
+};
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenCoalescedFlushEnabledWhenLaunchingKernelsWithoutEventsThenSubmissionIsDeferredUntilOtherAppend, IsAtLeastSkl) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    }
+    EXPECT_EQ(0u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(3u, cmdList->coalescedCommandCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(2u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList->coalescedCommandCount);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenCoalescedFlushEnabledWhenLaunchingKernelWithSignalEventThenPendingKernelsAreSubmittedWithIt, IsAtLeastSkl) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 1;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(0u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, event->toHandle(), 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList->coalescedCommandCount);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenCoalescedFlushEnabledWhenKernelRequiresDifferentStateThenPendingKernelsAreSubmittedFirst, IsAtLeastSkl) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+    Mock<Kernel> largeGrfKernel;
+    largeGrfKernel.descriptor.kernelAttributes.numGrfRequired = GrfConfig::LargeGrfNumber;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(largeGrfKernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, cmdList->coalescedCommandCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->flushCoalescedCommands());
+    EXPECT_EQ(2u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->flushCoalescedCommands());
+    EXPECT_EQ(2u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenCoalescedFlushEnabledWhenSizeThresholdIsReachedThenKernelsAreSubmitted, IsAtLeastSkl) {
+    DebugManager.flags.ImmediateCmdListCoalescedFlushMaxSize.set(1);
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList->coalescedCommandCount);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenCoalescedFlushEnabledWhenDelayThresholdIsReachedThenKernelsAreSubmitted, IsAtLeastSkl) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    DebugManager.flags.ImmediateCmdListCoalescedFlushMaxDelayUs.set(0);
+    Mock<Kernel> kernel;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenCoalescedFlushDisabledOrSynchronousListWhenLaunchingKernelsThenEachKernelIsSubmitted, IsAtLeastSkl) {
+    Mock<Kernel> kernel;
+    {
+        auto cmdList = createCommandList<gfxCoreFamily>(true);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+        EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    }
+    {
+        auto cmdList = createCommandList<gfxCoreFamily>(false);
+        DebugManager.flags.EnableImmediateCmdListCoalescedFlush.set(0);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+        EXPECT_EQ(2u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    }
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenChainOfTinyKernelLaunchesWhenCoalescedFlushEnabledThenSubmissionCountIsReduced, IsAtLeastSkl) {
+    DebugManager.flags.ImmediateCmdListCoalescedFlushMaxSize.set(std::numeric_limits<int32_t>::max());
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    constexpr uint32_t launchCount = 1000;
+    for (uint32_t i = 0; i < launchCount; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->flushCoalescedCommands());
+
+    EXPECT_NE(0u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_GT(launchCount / 4, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenPendingCoalescedKernelsWhenFlushPendingCommandsExtensionIsCalledThenKernelsAreSubmitted, IsAtLeastSkl) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(0u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, L0::zexCommandListFlushPendingCommands(nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexCommandListFlushPendingCommands(cmdList->toHandle()));
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList->coalescedCommandCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexCommandListFlushPendingCommands(cmdList->toHandle()));
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenPendingCoalescedKernelsWhenTheirSubmissionFailsOnNextAppendThenErrorIsReturned, IsAtLeastSkl) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    cmdList->executeCommandListImmediateWithFlushTaskReturnValue = ZE_RESULT_ERROR_DEVICE_LOST;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, cmdList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList->coalescedCommandCount);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenPendingCoalescedKernelsWhenTheyAreSubmittedOrListIsDestroyedThenListIsUnregisteredFromFlusher, IsAtLeastSkl) {
+    auto flusher = driverHandle->getPendingCommandsFlusher();
+    ASSERT_NE(nullptr, flusher);
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, flusher->getRegisteredCommandListCount());
+    EXPECT_EQ(flusher, cmdList->pendingCommandsFlusher);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->flushCoalescedCommands());
+    EXPECT_EQ(0u, flusher->getRegisteredCommandListCount());
+    EXPECT_EQ(nullptr, cmdList->pendingCommandsFlusher);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, flusher->getRegisteredCommandListCount());
+    cmdList.reset();
+    EXPECT_EQ(0u, flusher->getRegisteredCommandListCount());
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenPendingCoalescedKernelsWhenEventIsQueriedOrSynchronizedThenKernelsAreSubmitted, IsAtLeastSkl) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 1;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList->coalescedCommandCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->hostSynchronize(0));
+    EXPECT_EQ(2u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    auto hEvent = event->toHandle();
+    EXPECT_EQ(ZE_RESULT_NOT_READY, L0::EventBatchQuery::hostSynchronizeAll(1, &hEvent, 0));
+    EXPECT_EQ(3u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, driverHandle->getPendingCommandsFlusher()->getRegisteredCommandListCount());
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenPendingCoalescedKernelsWhenTheirSubmissionFailsOnEventQueryThenErrorIsReturned, IsAtLeastSkl) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 1;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    cmdList->executeCommandListImmediateWithFlushTaskReturnValue = ZE_RESULT_ERROR_DEVICE_LOST;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, event->queryStatus());
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, driverHandle->getPendingCommandsFlusher()->getRegisteredCommandListCount());
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenPendingCoalescedKernelsWhenMemoryIsFreedThenKernelsAreSubmittedFirst, IsAtLeastSkl) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    void *buffers[2] = {};
+    for (auto &buffer : buffers) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocHostMem(&hostDesc, 4096u, 4096u, &buffer));
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(buffers[0]));
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    ze_memory_free_ext_desc_t memFreeDesc = {};
+    memFreeDesc.freePolicy = ZE_DRIVER_MEMORY_FREE_POLICY_EXT_FLAG_DEFER_FREE;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMemExt(&memFreeDesc, buffers[1]));
+    EXPECT_EQ(2u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList->coalescedCommandCount);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenPendingCoalescedKernelsWhenKernelOrModuleIsDestroyedThenKernelsAreSubmittedFirst, IsAtLeastSkl) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+    Mock<Module> module(device, nullptr);
+
+    auto destroyedKernel = new Mock<Kernel>();
+    destroyedKernel->module = &module;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, destroyedKernel->destroy());
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+
+    auto destroyedModule = new L0::ModuleImp(device, nullptr, ModuleType::User);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, destroyedModule->destroy());
+    EXPECT_EQ(2u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList->coalescedCommandCount);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenPendingCoalescedKernelsWhenFlusherFlushesExpiredListsThenKernelsAreSubmittedOnlyAfterDelayExpires, IsAtLeastSkl) {
+    auto flusher = driverHandle->getPendingCommandsFlusher();
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, flusher->flush(true));
+    EXPECT_EQ(0u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, flusher->getRegisteredCommandListCount());
+
+    DebugManager.flags.ImmediateCmdListCoalescedFlushMaxDelayUs.set(0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, flusher->flush(true));
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList->coalescedCommandCount);
+    EXPECT_EQ(0u, flusher->getRegisteredCommandListCount());
+    EXPECT_EQ(nullptr, cmdList->pendingCommandsFlusher);
+}
+
+HWTEST2_F(ImmediateCommandListCoalescedFlushTest, givenListLockedByAnotherThreadWhenFlusherFlushesThenListStaysRegisteredUntilItIsReleased, IsAtLeastSkl) {
+    auto flusher = driverHandle->getPendingCommandsFlusher();
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    Mock<Kernel> kernel;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    std::atomic_bool locked{false};
+    std::atomic_bool release{false};
+    std::thread appendingThread([&]() {
+        std::lock_guard<std::recursive_mutex> lock(cmdList->coalescedCommandsMutex);
+        locked.store(true);
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+    while (!locked.load()) {
+        std::this_thread::yield();
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, flusher->flush(false));
+    EXPECT_EQ(0u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, flusher->getRegisteredCommandListCount());
+
+    release.store(true);
+    appendingThread.join();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, flusher->flush(false));
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, flusher->getRegisteredCommandListCount());
+}
+
+struct PendingCommandsMockCommandList : public MockCommandList {
+    ze_result_t flushRegisteredPendingCommands(bool expiredOnly) override {
+        if (!expiredOnly) {
+            nonExpiredFlushCalled = true;
+        }
+        return ++flushCalledCount < 3u ? ZE_RESULT_NOT_READY : ZE_RESULT_SUCCESS;
+    }
+
+    std::atomic<uint32_t> flushCalledCount{0u};
+    std::atomic_bool nonExpiredFlushCalled{false};
+};
+
+TEST(PendingCommandsFlusherTest, givenRegisteredCommandListWhenFlusherThreadRunsThenExpiredCommandsAreFlushedInBackgroundAndListIsUnregistered) {
+    PendingCommandsMockCommandList commandList;
+    PendingCommandsFlusher flusher(std::chrono::microseconds{1});
+    EXPECT_EQ(0u, flusher.getRegisteredCommandListCount());
+
+    flusher.registerCommandList(&commandList);
+    flusher.registerCommandList(&commandList);
+
+    auto waitStart = std::chrono::steady_clock::now();
+    while (flusher.getRegisteredCommandListCount() != 0u && std::chrono::steady_clock::now() - waitStart < std::chrono::seconds{10}) {
+        std::this_thread::yield();
+    }
+    flusher.stop();
+
+    EXPECT_EQ(0u, flusher.getRegisteredCommandListCount());
+    EXPECT_EQ(3u, commandList.flushCalledCount.load());
+    EXPECT_FALSE(commandList.nonExpiredFlushCalled.load());
+}
+
+struct LaunchReplayMockCommandQueue : public Mock<CommandQueue> {
+    using Mock<CommandQueue>::Mock;
+
+    ze_result_t executeCommandLists(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists, ze_fence_handle_t hFence, bool performMigration) override {
+        executedCommandListCount += numCommandLists;
+        return Mock<CommandQueue>::executeCommandLists(numCommandLists, phCommandLists, hFence, performMigration);
+    }
+
+    uint32_t executedCommandListCount = 0;
+};
+
+struct ImmediateCommandListLaunchReplayTest : public ImmediateCommandListPendingSubmissionTest {
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    std::unique_ptr<PendingSubmissionMockCommandListImmediateHw<gfxCoreFamily>> createCommandListWithMockQueue() {
+        auto cmdList = createCommandList<gfxCoreFamily>(false);
+        cmdList->cmdQImmediate = &commandQueue;
+        return cmdList;
+    }
+
+    ImmediateCommandListLaunchReplayTest() {
+        DebugManager.flags.EnableImmediateCmdListLaunchReplay.set(1);
+    }
+
+    LaunchReplayMockCommandQueue commandQueue;
+    Mock<Kernel> kernel;
+};
+
+HWTEST2_F(ImmediateCommandListLaunchReplayTest, givenLaunchReplayEnabledWhenSameLaunchIsRepeatedThenRecordedCommandListIsReplayed, IsAtLeastSkl) {
+    auto cmdList = createCommandListWithMockQueue<gfxCoreFamily>();
+
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    }
+    EXPECT_EQ(1u, cmdList->recordedLaunches.size());
+    EXPECT_EQ(3u, cmdList->pendingReplayedLaunches.size());
+    EXPECT_EQ(0u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+
+    auto &statistics = cmdList->getLaunchReplayStatistics();
+    EXPECT_EQ(1u, statistics.missCount);
+    EXPECT_EQ(2u, statistics.hitCount);
+    EXPECT_EQ(0u, statistics.reencodeCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->flushReplayedLaunches());
+    EXPECT_EQ(1u, commandQueue.executeCommandListsCalled);
+    EXPECT_EQ(3u, commandQueue.executedCommandListCount);
+    EXPECT_TRUE(cmdList->pendingReplayedLaunches.empty());
+}
+
+HWTEST2_F(ImmediateCommandListLaunchReplayTest, givenLaunchReplayEnabledWhenKernelArgumentsChangeThenLaunchIsReencoded, IsAtLeastSkl) {
+    auto cmdList = createCommandListWithMockQueue<gfxCoreFamily>();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.setGlobalOffsetExp(1, 0, 0));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    ze_group_count_t otherGroupCount{2, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &otherGroupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &otherGroupCount, nullptr, 0, nullptr, launchParams, false));
+
+    auto &statistics = cmdList->getLaunchReplayStatistics();
+    EXPECT_EQ(3u, statistics.missCount);
+    EXPECT_EQ(2u, statistics.reencodeCount);
+    EXPECT_EQ(1u, statistics.hitCount);
+    EXPECT_EQ(3u, cmdList->recordedLaunches.size());
+}
+
+HWTEST2_F(ImmediateCommandListLaunchReplayTest, givenPendingReplayedLaunchesWhenOtherCommandIsAppendedThenReplayedLaunchesAreSubmittedFirst, IsAtLeastSkl) {
+    auto cmdList = createCommandListWithMockQueue<gfxCoreFamily>();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(0u, commandQueue.executeCommandListsCalled);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(1u, commandQueue.executeCommandListsCalled);
+    EXPECT_TRUE(cmdList->pendingReplayedLaunches.empty());
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(ImmediateCommandListLaunchReplayTest, givenLaunchWithSignalEventWhenLaunchReplayEnabledThenLaunchIsEncodedInPlace, IsAtLeastSkl) {
+    auto cmdList = createCommandListWithMockQueue<gfxCoreFamily>();
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 1;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, event->toHandle(), 0, nullptr, launchParams, false));
+
+    EXPECT_EQ(1u, commandQueue.executedCommandListCount);
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, cmdList->getLaunchReplayStatistics().missCount);
+}
+
+HWTEST2_F(ImmediateCommandListLaunchReplayTest, givenFullReplayCacheWhenNewLaunchIsRecordedThenLeastRecentlyUsedLaunchIsEvicted, IsAtLeastSkl) {
+    DebugManager.flags.ImmediateCmdListLaunchReplayCacheSize.set(2);
+    auto cmdList = createCommandListWithMockQueue<gfxCoreFamily>();
+    ze_group_count_t groupCounts[] = {{1, 1, 1}, {2, 1, 1}, {3, 1, 1}};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCounts[0], nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCounts[1], nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCounts[0], nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCounts[2], nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(2u, cmdList->recordedLaunches.size());
+    EXPECT_EQ(1u, cmdList->retiredLaunches.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCounts[0], nullptr, 0, nullptr, launchParams, false));
+    auto &statistics = cmdList->getLaunchReplayStatistics();
+    EXPECT_EQ(3u, statistics.missCount);
+    EXPECT_EQ(2u, statistics.hitCount);
+}
+
+HWTEST2_F(ImmediateCommandListLaunchReplayTest, givenEvictedLaunchWhenItIsStillPendingOrExecutingThenItIsRetiredWithoutSubmissionOrWait, IsAtLeastSkl) {
+    DebugManager.flags.ImmediateCmdListLaunchReplayCacheSize.set(1);
+    auto cmdList = createCommandListWithMockQueue<gfxCoreFamily>();
+    ze_group_count_t otherGroupCount{2, 1, 1};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &otherGroupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(0u, commandQueue.executeCommandListsCalled);
+    EXPECT_EQ(1u, cmdList->recordedLaunches.size());
+    ASSERT_EQ(1u, cmdList->retiredLaunches.size());
+
+    cmdList->releaseCompletedRetiredLaunches();
+    EXPECT_EQ(1u, cmdList->retiredLaunches.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->flushReplayedLaunches());
+    EXPECT_EQ(2u, commandQueue.executedCommandListCount);
+
+    auto tagAddress = cmdList->csr->getTagAddress();
+    cmdList->retiredLaunches[0]->lastUsedTaskCount = *tagAddress + 1;
+    cmdList->releaseCompletedRetiredLaunches();
+    EXPECT_EQ(1u, cmdList->retiredLaunches.size());
+
+    *tagAddress = cmdList->retiredLaunches[0]->lastUsedTaskCount;
+    cmdList->releaseCompletedRetiredLaunches();
+    EXPECT_TRUE(cmdList->retiredLaunches.empty());
+}
+
+HWTEST2_F(ImmediateCommandListLaunchReplayTest, givenPendingReplayedLaunchesWhenFlushPendingCommandsExtensionIsCalledThenTheyAreSubmitted, IsAtLeastSkl) {
+    auto cmdList = createCommandListWithMockQueue<gfxCoreFamily>();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(0u, commandQueue.executeCommandListsCalled);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexCommandListFlushPendingCommands(cmdList->toHandle()));
+    EXPECT_EQ(1u, commandQueue.executeCommandListsCalled);
+    EXPECT_TRUE(cmdList->pendingReplayedLaunches.empty());
+}
+
+HWTEST2_F(ImmediateCommandListLaunchReplayTest, givenPendingReplayedLaunchesWhenTheirSubmissionFailsOnNextAppendThenErrorIsReturned, IsAtLeastSkl) {
+    auto cmdList = createCommandListWithMockQueue<gfxCoreFamily>();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    commandQueue.executeCommandListsResult = ZE_RESULT_ERROR_DEVICE_LOST;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, cmdList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_TRUE(cmdList->pendingReplayedLaunches.empty());
+    EXPECT_EQ(0u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(ImmediateCommandListPendingSubmissionTest, givenLaunchReplayEnabledOnImmediateListWithItsOwnQueueWhenPendingCommandsAreFlushedThenReplayedLaunchesAreSubmittedToCsrOnce, IsAtLeastSkl) {
+    DebugManager.flags.EnableFlushTaskSubmission.set(1);
+    DebugManager.flags.EnableImmediateCmdListLaunchReplay.set(1);
+
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    auto &commandListImmediate = static_cast<MockCommandListImmediate<gfxCoreFamily> &>(*commandList);
+    auto csr = commandListImmediate.csr;
+    auto taskCountBeforeLaunches = csr->peekTaskCount();
+
+    Mock<Kernel> kernel;
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    }
+    EXPECT_EQ(taskCountBeforeLaunches, csr->peekTaskCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexCommandListFlushPendingCommands(commandList->toHandle()));
+    EXPECT_EQ(taskCountBeforeLaunches + 1, csr->peekTaskCount());
+
+    auto &statistics = commandListImmediate.getLaunchReplayStatistics();
+    EXPECT_EQ(1u, statistics.missCount);
+    EXPECT_EQ(2u, statistics.hitCount);
+}
+
+HWTEST2_F(ImmediateCommandListLaunchReplayTest, givenLaunchReplayDisabledWhenLaunchingKernelsThenEachKernelIsSubmittedWithFlushTask, IsAtLeastSkl) {
+    DebugManager.flags.EnableImmediateCmdListLaunchReplay.set(0);
+    auto cmdList = createCommandListWithMockQueue<gfxCoreFamily>();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(2u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, commandQueue.executeCommandListsCalled);
+    EXPECT_TRUE(cmdList->recordedLaunches.empty());
+}
+
+HWTEST2_F(ImmediateCommandListLaunchReplayTest, givenRepeatedInferenceLoopWhenLaunchReplayEnabledThenLaunchesAreEncodedOnceAndSubmittedInBatches, IsAtLeastSkl) {
+    DebugManager.flags.ImmediateCmdListLaunchReplayMaxBatch.set(8);
+    auto cmdList = createCommandListWithMockQueue<gfxCoreFamily>();
+    ze_group_count_t groupCounts[] = {{1, 1, 1}, {4, 1, 1}, {16, 1, 1}, {64, 1, 1}};
+
+    constexpr uint32_t iterationCount = 100;
+    for (uint32_t iteration = 0; iteration < iterationCount; iteration++) {
+        for (auto &launchGroupCount : groupCounts) {
+            EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel.toHandle(), &launchGroupCount, nullptr, 0, nullptr, launchParams, false));
+        }
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->flushReplayedLaunches());
+
+    auto &statistics = cmdList->getLaunchReplayStatistics();
+    EXPECT_EQ(4u, statistics.missCount);
+    EXPECT_EQ(iterationCount * 4 - 4, statistics.hitCount);
+    EXPECT_EQ(iterationCount * 4, commandQueue.executedCommandListCount);
+    EXPECT_EQ(iterationCount * 4 / 8, commandQueue.executeCommandListsCalled);
+    EXPECT_EQ(0u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+struct ImmediateCommandListCpuImageCopyTest : public ImmediateCommandListPendingSubmissionTest {
+    ImmediateCommandListCpuImageCopyTest() {
+        DebugManager.flags.EnableCpuTiledImageCopy.set(1);
+    }
+
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    std::unique_ptr<WhiteBox<::L0::ImageCoreFamily<gfxCoreFamily>>> createLinearImage(ze_image_type_t type, uint32_t width, uint32_t height) {
+        ze_image_desc_t zeDesc = {};
+        zeDesc.stype = ZE_STRUCTURE_TYPE_IMAGE_DESC;
+        zeDesc.type = type;
+        zeDesc.format = {ZE_IMAGE_FORMAT_LAYOUT_8_8_8_8, ZE_IMAGE_FORMAT_TYPE_UINT,
+                         ZE_IMAGE_FORMAT_SWIZZLE_R, ZE_IMAGE_FORMAT_SWIZZLE_G, ZE_IMAGE_FORMAT_SWIZZLE_B, ZE_IMAGE_FORMAT_SWIZZLE_A};
+        zeDesc.width = width;
+        zeDesc.height = height;
+        zeDesc.depth = 1;
+        auto image = std::make_unique<WhiteBox<::L0::ImageCoreFamily<gfxCoreFamily>>>();
+        EXPECT_EQ(ZE_RESULT_SUCCESS, image->initialize(device, &zeDesc));
+
+        auto gmm = image->getAllocation()->getDefaultGmm();
+        if (gmm) {
+            auto &resourceFlags = static_cast<NEO::MockGmmResourceInfo *>(gmm->gmmResourceInfo.get())->getResourceFlags()->Info;
+            resourceFlags = {};
+            resourceFlags.Linear = 1;
+        }
+        return image;
+    }
+};
+
+HWTEST2_F(ImmediateCommandListCpuImageCopyTest, givenCpuTiledImageCopyEnabledWhenCopyingWholeSmall2dImageThenCpuCopyIsPreferredForFullImageRegion, ImageSupport) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    auto image = createLinearImage<gfxCoreFamily>(ZE_IMAGE_TYPE_2D, 8, 4);
+
+    ze_image_region_t cpuCopyRegion = {};
+    EXPECT_TRUE(cmdList->preferCpuImageCopy(image.get(), nullptr, cpuCopyRegion));
+    EXPECT_EQ(0u, cpuCopyRegion.originX);
+    EXPECT_EQ(0u, cpuCopyRegion.originY);
+    EXPECT_EQ(0u, cpuCopyRegion.originZ);
+    EXPECT_EQ(8u, cpuCopyRegion.width);
+    EXPECT_EQ(4u, cpuCopyRegion.height);
+    EXPECT_EQ(1u, cpuCopyRegion.depth);
+}
+
+HWTEST2_F(ImmediateCommandListCpuImageCopyTest, givenCpuTiledImageCopyDisabledOrRegionAboveMaxSizeWhenCheckingCpuCopyThenItIsNotPreferred, ImageSupport) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    auto image = createLinearImage<gfxCoreFamily>(ZE_IMAGE_TYPE_2D, 8, 4);
+    ze_image_region_t region = {0, 0, 0, 2, 2, 1};
+    ze_image_region_t cpuCopyRegion = {};
+
+    DebugManager.flags.EnableCpuTiledImageCopy.set(0);
+    EXPECT_FALSE(cmdList->preferCpuImageCopy(image.get(), &region, cpuCopyRegion));
+
+    DebugManager.flags.EnableCpuTiledImageCopy.set(1);
+    const auto bytesPerPixel = image->getImageInfo().surfaceFormat->ImageElementSizeInBytes;
+    DebugManager.flags.CpuTiledImageCopyMaxSize.set(static_cast<int32_t>(4 * bytesPerPixel - 1));
+    EXPECT_FALSE(cmdList->preferCpuImageCopy(image.get(), &region, cpuCopyRegion));
+
+    DebugManager.flags.CpuTiledImageCopyMaxSize.set(static_cast<int32_t>(4 * bytesPerPixel));
+    EXPECT_TRUE(cmdList->preferCpuImageCopy(image.get(), &region, cpuCopyRegion));
+}
+
+HWTEST2_F(ImmediateCommandListCpuImageCopyTest, given1dImageWhenCheckingCpuCopyThenItIsNotPreferred, ImageSupport) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    auto image = createLinearImage<gfxCoreFamily>(ZE_IMAGE_TYPE_1D, 8, 1);
+
+    ze_image_region_t cpuCopyRegion = {};
+    EXPECT_FALSE(cmdList->preferCpuImageCopy(image.get(), nullptr, cpuCopyRegion));
+}
+
+HWTEST2_F(ImmediateCommandListCpuImageCopyTest, givenCompressedImageWhenCheckingCpuCopyThenItIsNotPreferred, ImageSupport) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    auto image = createLinearImage<gfxCoreFamily>(ZE_IMAGE_TYPE_2D, 8, 4);
+    auto gmm = image->getAllocation()->getDefaultGmm();
+    if (gmm == nullptr) {
+        GTEST_SKIP();
+    }
+    gmm->isCompressionEnabled = true;
+
+    ze_image_region_t cpuCopyRegion = {};
+    EXPECT_FALSE(cmdList->preferCpuImageCopy(image.get(), nullptr, cpuCopyRegion));
+}
+
+HWTEST2_F(ImmediateCommandListCpuImageCopyTest, givenCpuCopyPreferredWhenAppendingImageCopyFromMemoryThenRegionIsWrittenOnCpuAndSignalEventIsSignaled, ImageSupport) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    auto image = createLinearImage<gfxCoreFamily>(ZE_IMAGE_TYPE_2D, 8, 4);
+    const auto &imageInfo = image->getImageInfo();
+    const size_t bytesPerPixel = imageInfo.surfaceFormat->ImageElementSizeInBytes;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 1;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    ze_image_region_t region = {1, 2, 0, 3, 2, 1};
+    std::vector<uint8_t> srcData(region.width * region.height * bytesPerPixel);
+    std::iota(srcData.begin(), srcData.end(), static_cast<uint8_t>(1));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendImageCopyFromMemory(image->toHandle(), srcData.data(), &region, event->toHandle(), 0, nullptr, false));
+    EXPECT_EQ(0u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+
+    auto allocation = image->getAllocation();
+    auto imageStorage = static_cast<uint8_t *>(allocation->isLocked() ? allocation->getLockedPtr() : allocation->getUnderlyingBuffer());
+    for (uint32_t y = 0; y < region.height; y++) {
+        auto imageRow = imageStorage + (region.originY + y) * imageInfo.rowPitch + region.originX * bytesPerPixel;
+        auto srcRow = srcData.data() + y * region.width * bytesPerPixel;
+        EXPECT_EQ(0, memcmp(imageRow, srcRow, region.width * bytesPerPixel)) << "row: " << y;
+    }
+}
+
+HWTEST2_F(ImmediateCommandListCpuImageCopyTest, givenDependenciesPresentWhenPerformingCpuImageCopyFromMemoryThenImageIsWrittenOnlyAfterGpuWorkCompletes, ImageSupport) {
+    auto cmdList = createCommandList<gfxCoreFamily>(false);
+    auto image = createLinearImage<gfxCoreFamily>(ZE_IMAGE_TYPE_2D, 4, 4);
+    const auto &imageInfo = image->getImageInfo();
+    const size_t bytesPerPixel = imageInfo.surfaceFormat->ImageElementSizeInBytes;
+    auto &csr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.callBaseWaitForCompletionWithTimeout = false;
+    ze_image_region_t region = {0, 3, 0, 4, 1, 1};
+    std::vector<uint8_t> srcData(region.width * bytesPerPixel, 0x5a);
+
+    cmdList->dependenciesPresent = true;
+    csr.returnWaitForCompletionWithTimeout = NEO::WaitStatus::GpuHang;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, cmdList->performCpuImageCopyFromMemory(image.get(), srcData.data(), region, nullptr, 0, nullptr));
+    EXPECT_TRUE(cmdList->dependenciesPresent);
+
+    csr.flushTagUpdateCalled = false;
+    csr.returnWaitForCompletionWithTimeout = NEO::WaitStatus::Ready;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->performCpuImageCopyFromMemory(image.get(), srcData.data(), region, nullptr, 0, nullptr));
+    EXPECT_TRUE(csr.flushTagUpdateCalled);
+    EXPECT_FALSE(cmdList->dependenciesPresent);
+
+    auto allocation = image->getAllocation();
+    auto imageStorage = static_cast<uint8_t *>(allocation->isLocked() ? allocation->getLockedPtr() : allocation->getUnderlyingBuffer());
+    EXPECT_EQ(0, memcmp(imageStorage + region.originY * imageInfo.rowPitch, srcData.data(), srcData.size()));
+}
+
 } // namespace ult
 } // namespace L0
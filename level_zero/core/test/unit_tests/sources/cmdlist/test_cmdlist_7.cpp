@@ -15,6 +15,7 @@
 #include "shared/test/common/test_macros/hw_test.h"
 
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
+#include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/event/event_imp.h"
 #include "level_zero/core/test/unit_tests/fixtures/cmdlist_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
@@ -2556,6 +2557,115 @@ HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndNonUsmDstHostP
     EXPECT_GE(cmdList.appendMemoryCopyKernelWithGACalled, 1u);
 }
 
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndStagingCopyEnabledWhenPreferStagingCopyCalledThenReturnTrueOnlyForLargePageableCopies, IsAtLeastSkl) {
+    DebugManager.flags.StagingBufferChunkSize.set(static_cast<int32_t>(MemoryConstants::megaByte));
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+
+    auto getCopyInfo = [&](void *dstPtr, const void *srcPtr, size_t size) {
+        CpuMemCopyInfo cpuMemCopyInfo(dstPtr, srcPtr, size);
+        device->getDriverHandle()->findAllocationDataForRange(const_cast<void *>(srcPtr), size, &cpuMemCopyInfo.srcAllocData);
+        device->getDriverHandle()->findAllocationDataForRange(dstPtr, size, &cpuMemCopyInfo.dstAllocData);
+        return cpuMemCopyInfo;
+    };
+
+    EXPECT_FALSE(cmdList.preferStagingCopy(getCopyInfo(devicePtr, nonUsmHostPtr, sz)));
+
+    DebugManager.flags.EnableStagingBufferCopy.set(1);
+    EXPECT_FALSE(cmdList.preferStagingCopy(getCopyInfo(devicePtr, nonUsmHostPtr, sz)));
+    EXPECT_TRUE(cmdList.preferStagingCopy(getCopyInfo(nonUsmHostPtr, devicePtr, sz)));
+    EXPECT_FALSE(cmdList.preferStagingCopy(getCopyInfo(nonUsmHostPtr, devicePtr, MemoryConstants::megaByte)));
+
+    DebugManager.flags.ExperimentalH2DCpuCopyThreshold.set(static_cast<int32_t>(2 * MemoryConstants::megaByte));
+    EXPECT_TRUE(cmdList.preferStagingCopy(getCopyInfo(devicePtr, nonUsmHostPtr, sz)));
+    EXPECT_FALSE(cmdList.preferStagingCopy(getCopyInfo(devicePtr, nonUsmHostPtr, 2 * MemoryConstants::megaByte)));
+    EXPECT_FALSE(cmdList.preferStagingCopy(getCopyInfo(devicePtr, hostPtr, sz)));
+    EXPECT_FALSE(cmdList.preferStagingCopy(getCopyInfo(sharedPtr, nonUsmHostPtr, sz)));
+}
+
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndStagingCopyEnabledWhenCopyH2DThenCopyIsPipelinedThroughStagingBuffers, IsAtLeastSkl) {
+    DebugManager.flags.ExperimentalCopyThroughLock.set(0);
+    DebugManager.flags.EnableStagingBufferCopy.set(1);
+    DebugManager.flags.StagingBufferChunkSize.set(static_cast<int32_t>(MemoryConstants::megaByte));
+    DebugManager.flags.StagingBufferChunksPerCopy.set(3);
+    DebugManager.flags.ExperimentalH2DCpuCopyThreshold.set(static_cast<int32_t>(MemoryConstants::megaByte));
+
+    MockAppendMemoryLockedCopyTestImmediateCmdList<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    cmdList.csr = device->getNEODevice()->getInternalEngine().commandStreamReceiver;
+
+    auto &stagingBuffers = static_cast<DeviceImp *>(device)->stagingBuffers;
+    EXPECT_EQ(0u, stagingBuffers.getAllocatedCount());
+
+    auto res = cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, sz, nullptr, 0, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(4u, cmdList.executeCommandListImmediateCalledCount + cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_GE(cmdList.appendMemoryCopyKernelWithGACalled, 4u);
+    EXPECT_EQ(3u, stagingBuffers.getAllocatedCount());
+
+    res = cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, sz, nullptr, 0, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(3u, stagingBuffers.getAllocatedCount());
+}
+
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndStagingCopyEnabledWhenCopyH2DWithWaitEventThenEventIsSynchronizedOnHostBeforeCopy, IsAtLeastSkl) {
+    DebugManager.flags.ExperimentalCopyThroughLock.set(0);
+    DebugManager.flags.EnableStagingBufferCopy.set(1);
+    DebugManager.flags.StagingBufferChunkSize.set(static_cast<int32_t>(MemoryConstants::megaByte));
+    DebugManager.flags.ExperimentalH2DCpuCopyThreshold.set(static_cast<int32_t>(MemoryConstants::megaByte));
+
+    MockAppendMemoryLockedCopyTestImmediateCmdList<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    cmdList.csr = device->getNEODevice()->getInternalEngine().commandStreamReceiver;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 1;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, returnValue));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
+    auto event = std::unique_ptr<L0::Event>(Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    event->hostSignal();
+    auto hEvent = event->toHandle();
+
+    auto res = cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, sz, nullptr, 1, &hEvent, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(1u, cmdList.synchronizeEventListCalled);
+    EXPECT_EQ(0u, cmdList.appendBarrierCalled);
+}
+
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndStagingCopyEnabledWhenCopyD2HWithSignalEventThenEventIsSignaledAfterLastChunkIsDrained, IsAtLeastSkl) {
+    DebugManager.flags.ExperimentalCopyThroughLock.set(0);
+    DebugManager.flags.EnableStagingBufferCopy.set(1);
+    DebugManager.flags.StagingBufferChunkSize.set(static_cast<int32_t>(MemoryConstants::megaByte));
+    DebugManager.flags.StagingBufferChunksPerCopy.set(2);
+
+    MockAppendMemoryLockedCopyTestImmediateCmdList<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    cmdList.csr = device->getNEODevice()->getInternalEngine().commandStreamReceiver;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 1;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, returnValue));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
+    auto event = std::unique_ptr<L0::Event>(Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    auto res = cmdList.appendMemoryCopy(nonUsmHostPtr, devicePtr, sz, event->toHandle(), 0, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(4u, cmdList.executeCommandListImmediateCalledCount + cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(2u, static_cast<DeviceImp *>(device)->stagingBuffers.getAllocatedCount());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+}
+
 HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndFailedToLockPtrThenUseGpuMemcpy, IsAtLeastSkl) {
     MockAppendMemoryLockedCopyTestImmediateCmdList<gfxCoreFamily> cmdList;
     cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
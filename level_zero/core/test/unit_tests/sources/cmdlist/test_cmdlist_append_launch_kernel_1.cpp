@@ -304,6 +304,27 @@ HWTEST_F(CommandListAppendLaunchKernel, givenKernelWithPrintfWhenAppendedToAsync
     EXPECT_EQ(0u, commandList->getPrintfKernelContainer().size());
 }
 
+HWTEST_F(CommandListAppendLaunchKernel, givenKernelWithPrintfWhenAppendedToImmCommandListThenKernelWaitsForSubmittedTaskCountBeforePrintfDrain) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableFlushTaskSubmission.set(1);
+
+    ze_result_t returnValue;
+    ze_command_queue_desc_t queueDesc = {};
+    queueDesc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    auto csr = reinterpret_cast<CommandQueueImp *>(commandList->cmdQImmediate)->getCsr();
+
+    Mock<Kernel> kernel;
+    kernel.descriptor.kernelAttributes.flags.usesPrintf = true;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(csr, kernel.printfCsr);
+    EXPECT_EQ(csr->peekTaskCount(), kernel.printfTaskCountToWait);
+}
+
 HWTEST_F(CommandListAppendLaunchKernel, givenKernelWithPrintfWhenAppendToSynchronousImmCommandListHangsThenPrintfBufferIsPrinted) {
     DebugManagerStateRestore dbgRestorer;
     DebugManager.flags.EnableFlushTaskSubmission.set(1);
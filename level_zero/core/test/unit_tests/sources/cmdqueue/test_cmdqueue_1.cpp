@@ -152,6 +152,35 @@ HWTEST_F(CommandQueueCreate, givenPrintfKernelAndDetectedHangWhenSynchronizingTh
     commandQueue->destroy();
 }
 
+HWTEST_F(CommandQueueCreate, givenCommandListWithPrintfKernelWhenExecutingThenKernelWaitsForSubmittedTaskCountBeforePrintfDrain) {
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue;
+    auto csr = neoDevice->getDefaultEngine().commandStreamReceiver;
+    auto commandQueue = whiteboxCast(CommandQueue::create(productFamily,
+                                                          device,
+                                                          csr,
+                                                          &desc,
+                                                          false,
+                                                          false,
+                                                          returnValue));
+
+    auto commandList = std::unique_ptr<CommandList>(whiteboxCast(
+        CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue)));
+    ASSERT_NE(nullptr, commandList);
+
+    Mock<Kernel> kernel;
+    commandList->storePrintfKernel(&kernel);
+    commandList->close();
+
+    ze_command_list_handle_t cmdListHandle = commandList->toHandle();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandQueue->executeCommandLists(1, &cmdListHandle, nullptr, false));
+
+    EXPECT_EQ(csr, kernel.printfCsr);
+    EXPECT_EQ(commandQueue->taskCount, kernel.printfTaskCountToWait);
+
+    commandQueue->destroy();
+}
+
 HWTEST_F(CommandQueueCreate, givenGpuHangOnSecondReserveWhenReservingLinearStreamThenReturnGpuHang) {
     const ze_command_queue_desc_t desc{};
     ze_result_t returnValue;
@@ -95,6 +95,24 @@ TEST(L0DeviceTest, GivenCreatedDeviceHandleWhenCallingdeviceReinitThenNewDeviceH
     delete device;
 }
 
+TEST(L0DeviceTest, GivenPrintfBackgroundDrainIntervalSetWhenCreatingDeviceThenPrintfDrainerIsCreated) {
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<DriverHandleImp> driverHandle(new DriverHandleImp);
+    auto hwInfo = *NEO::defaultHwInfo;
+
+    auto neoDevice = std::unique_ptr<NEO::Device>(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    auto device = std::unique_ptr<L0::Device>(Device::create(driverHandle.get(), neoDevice.release(), false, &returnValue));
+    ASSERT_NE(nullptr, device);
+    EXPECT_EQ(nullptr, device->getPrintfDrainer());
+
+    NEO::DebugManager.flags.PrintfBackgroundDrainIntervalUs.set(100);
+    neoDevice.reset(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    device.reset(Device::create(driverHandle.get(), neoDevice.release(), false, &returnValue));
+    ASSERT_NE(nullptr, device);
+    EXPECT_NE(nullptr, device->getPrintfDrainer());
+}
+
 TEST(L0DeviceTest, GivenDualStorageSharedMemorySupportedWhenCreatingDeviceThenPageFaultCmdListImmediateWithInitializedCmdQIsCreated) {
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
     DebugManagerStateRestore restorer;
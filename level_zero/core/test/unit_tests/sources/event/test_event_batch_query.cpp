@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/timestamp_packet.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/event/event_batch_query.h"
+#include "level_zero/core/source/event/event_imp.h"
+#include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
+
+#include <limits>
+#include <vector>
+
+namespace L0 {
+namespace ult {
+
+template <typename TagSizeT>
+struct EventBatchQueryPacketsTest : public ::testing::Test {
+    static constexpr uint32_t packetCount = 8;
+    using Packets = NEO::TimestampPackets<TagSizeT>;
+
+    void SetUp() override {
+        auto initialValue = static_cast<TagSizeT>(Event::STATE_CLEARED);
+        std::fill_n(reinterpret_cast<TagSizeT *>(&packets), sizeof(packets) / sizeof(TagSizeT), initialValue);
+    }
+
+    void setCompletionField(uint32_t packet, size_t fieldOffset, TagSizeT value) {
+        auto address = ptrOffset(&packets, packet * Packets::getSinglePacketSize() + fieldOffset);
+        *reinterpret_cast<TagSizeT *>(address) = value;
+    }
+
+    void verify() {
+        for (auto fieldOffset : {Packets::getContextStartOffset(), Packets::getContextEndOffset()}) {
+            SetUp();
+            EXPECT_FALSE(EventBatchQuery::arePacketsSignaled<TagSizeT>(&packets, packetCount, Packets::getSinglePacketSize(), fieldOffset));
+
+            for (uint32_t packet = 0; packet < packetCount; packet++) {
+                setCompletionField(packet, fieldOffset, Event::STATE_SIGNALED);
+            }
+            EXPECT_TRUE(EventBatchQuery::arePacketsSignaled<TagSizeT>(&packets, packetCount, Packets::getSinglePacketSize(), fieldOffset));
+
+            setCompletionField(packetCount - 1, fieldOffset, static_cast<TagSizeT>(Event::STATE_CLEARED));
+            EXPECT_FALSE(EventBatchQuery::arePacketsSignaled<TagSizeT>(&packets, packetCount, Packets::getSinglePacketSize(), fieldOffset));
+            EXPECT_TRUE(EventBatchQuery::arePacketsSignaled<TagSizeT>(&packets, packetCount - 1, Packets::getSinglePacketSize(), fieldOffset));
+        }
+    }
+
+    Packets packets;
+};
+
+using EventBatchQueryPackets32Test = EventBatchQueryPacketsTest<uint32_t>;
+using EventBatchQueryPackets64Test = EventBatchQueryPacketsTest<uint64_t>;
+
+TEST_F(EventBatchQueryPackets32Test, givenPacketsWhenScanningCompletionFieldThenClearedPacketIsDetected) {
+    verify();
+}
+
+TEST_F(EventBatchQueryPackets64Test, givenPacketsWhenScanningCompletionFieldThenClearedPacketIsDetected) {
+    verify();
+}
+
+TEST_F(EventBatchQueryPackets64Test, givenCompletionFieldWithOnlyLowerHalfMatchingClearedStateWhenScanningThenPacketIsSignaled) {
+    for (uint32_t packet = 0; packet < packetCount; packet++) {
+        setCompletionField(packet, Packets::getContextEndOffset(), 0xFFFFFFFF00000000ull | Event::STATE_CLEARED);
+    }
+    EXPECT_TRUE(EventBatchQuery::arePacketsSignaled<uint64_t>(&packets, packetCount, Packets::getSinglePacketSize(), Packets::getContextEndOffset()));
+}
+
+struct EventBatchQueryFixture : public DeviceFixture {
+    void setUp() {
+        DebugManager.flags.SignalAllEventPackets.set(0);
+        DeviceFixture::setUp();
+        createEvents(eventCount);
+    }
+
+    void tearDown() {
+        events.clear();
+        eventPool.reset();
+        DeviceFixture::tearDown();
+    }
+
+    void createEvents(uint32_t count) {
+        events.clear();
+        eventHandles.clear();
+
+        ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+        eventPoolDesc.count = count;
+        eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        eventPool.reset(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+        ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+        for (uint32_t i = 0; i < count; i++) {
+            ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+            eventDesc.index = i;
+            events.emplace_back(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+            eventHandles.push_back(events.back()->toHandle());
+        }
+    }
+
+    static constexpr uint32_t eventCount = 70;
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<L0::EventPool> eventPool;
+    std::vector<std::unique_ptr<L0::Event>> events;
+    std::vector<ze_event_handle_t> eventHandles;
+};
+
+using EventBatchQueryTest = Test<EventBatchQueryFixture>;
+
+struct MockCommandListSynchronizeEventList : public MockCommandList {
+    using MockCommandList::MockCommandList;
+    using MockCommandList::synchronizeEventList;
+};
+
+TEST_F(EventBatchQueryTest, givenSomeSignaledEventsWhenQueryingStatusThenCompletionBitmapIsReturned) {
+    std::vector<uint64_t> completionBitmap(EventBatchQuery::getBitmapWordCount(eventCount), std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(2u, completionBitmap.size());
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, EventBatchQuery::queryStatus(eventCount, eventHandles.data(), completionBitmap.data()));
+    EXPECT_EQ(0u, completionBitmap[0]);
+    EXPECT_EQ(0u, completionBitmap[1]);
+
+    events[3]->hostSignal();
+    events[64]->hostSignal();
+    events[69]->hostSignal();
+    EXPECT_EQ(ZE_RESULT_NOT_READY, EventBatchQuery::queryStatus(eventCount, eventHandles.data(), completionBitmap.data()));
+    EXPECT_EQ(1ull << 3, completionBitmap[0]);
+    EXPECT_EQ((1ull << 0) | (1ull << 5), completionBitmap[1]);
+
+    for (auto &event : events) {
+        event->hostSignal();
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, EventBatchQuery::queryStatus(eventCount, eventHandles.data(), completionBitmap.data()));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), completionBitmap[0]);
+    EXPECT_EQ(maxNBitValue(eventCount - 64), completionBitmap[1]);
+}
+
+TEST_F(EventBatchQueryTest, givenEventSignaledThroughMemoryWhenQueryingWithPacketScanThenEventIsCompleted) {
+    auto event = events[1].get();
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatusWithPacketScan());
+    EXPECT_FALSE(event->isAlreadyCompleted());
+
+    auto completionField = static_cast<uint32_t *>(event->getCompletionFieldHostAddress());
+    *completionField = Event::STATE_SIGNALED;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatusWithPacketScan());
+    EXPECT_TRUE(event->isAlreadyCompleted());
+
+    event->reset();
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatusWithPacketScan());
+}
+
+TEST_F(EventBatchQueryTest, givenNoSignaledEventWhenSynchronizingAnyWithZeroTimeoutThenNotReadyIsReturned) {
+    uint32_t signaledEventIndex = std::numeric_limits<uint32_t>::max();
+    EXPECT_EQ(ZE_RESULT_NOT_READY, EventBatchQuery::hostSynchronizeAny(eventCount, eventHandles.data(), 0u, &signaledEventIndex));
+    EXPECT_EQ(std::numeric_limits<uint32_t>::max(), signaledEventIndex);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, EventBatchQuery::hostSynchronizeAny(0u, eventHandles.data(), 0u, &signaledEventIndex));
+}
+
+TEST_F(EventBatchQueryTest, givenNonFirstEventSignaledWhenSynchronizingAnyThenItsIndexIsReturned) {
+    events[42]->hostSignal();
+
+    uint32_t signaledEventIndex = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, EventBatchQuery::hostSynchronizeAny(eventCount, eventHandles.data(), std::numeric_limits<uint64_t>::max(), &signaledEventIndex));
+    EXPECT_EQ(42u, signaledEventIndex);
+}
+
+TEST_F(EventBatchQueryTest, givenNotAllEventsSignaledWhenSynchronizingAllThenNotReadyIsReturnedAfterTimeout) {
+    for (uint32_t i = 1; i < eventCount; i++) {
+        events[i]->hostSignal();
+    }
+    EXPECT_EQ(ZE_RESULT_NOT_READY, EventBatchQuery::hostSynchronizeAll(eventCount, eventHandles.data(), 0u));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, EventBatchQuery::hostSynchronizeAll(eventCount, eventHandles.data(), 1000u));
+
+    events[0]->hostSignal();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, EventBatchQuery::hostSynchronizeAll(eventCount, eventHandles.data(), std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, EventBatchQuery::hostSynchronizeAll(0u, eventHandles.data(), 0u));
+}
+
+TEST_F(EventBatchQueryTest, givenBatchedSynchronizationEnabledWhenSynchronizingEventListThenAllEventsAreCompleted) {
+    DebugManager.flags.EnableBatchedEventSynchronization.set(1);
+    for (auto &event : events) {
+        event->hostSignal();
+        event->resetCompletionStatus();
+    }
+
+    MockCommandListSynchronizeEventList commandList(device);
+    commandList.synchronizeEventList(eventCount, eventHandles.data());
+
+    for (auto &event : events) {
+        EXPECT_TRUE(event->isAlreadyCompleted());
+    }
+}
+
+} // namespace ult
+} // namespace L0
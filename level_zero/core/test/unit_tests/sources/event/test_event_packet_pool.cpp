@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/event/event_imp.h"
+#include "level_zero/core/source/event/event_packet_pool.h"
+#include "level_zero/core/test/unit_tests/fixtures/event_fixture.h"
+
+#include <memory>
+#include <vector>
+
+namespace L0 {
+namespace ult {
+
+TEST(EventPacketPoolTest, givenEmptyPoolWhenBlockIsAcquiredThenChunkIsAddedOnDemand) {
+    EventPacketPool packetPool;
+    EXPECT_EQ(0u, packetPool.getChunkCount());
+    EXPECT_EQ(0u, packetPool.getReservedSize());
+
+    auto blocks = packetPool.acquire(64u, 1u);
+    ASSERT_NE(nullptr, blocks.address);
+    EXPECT_EQ(1u, packetPool.getChunkCount());
+    EXPECT_EQ(1u, packetPool.getUsedBlockCount());
+    EXPECT_EQ(64u, packetPool.getBlockSize());
+    EXPECT_EQ(EventPacketPool::blocksPerChunk * 64u, packetPool.getReservedSize());
+
+    packetPool.release(blocks);
+    EXPECT_EQ(0u, packetPool.getUsedBlockCount());
+    EXPECT_EQ(1u, packetPool.getChunkCount());
+}
+
+TEST(EventPacketPoolTest, givenReleasedBlockWhenAcquiringAgainThenBlockIsReused) {
+    EventPacketPool packetPool;
+    auto first = packetPool.acquire(64u, 1u);
+    auto second = packetPool.acquire(64u, 1u);
+    EXPECT_EQ(ptrOffset(first.address, 64u), second.address);
+
+    packetPool.release(first);
+    auto third = packetPool.acquire(64u, 1u);
+    EXPECT_EQ(first.address, third.address);
+
+    packetPool.release(second);
+    packetPool.release(third);
+}
+
+TEST(EventPacketPoolTest, givenFullChunkWhenBlockIsAcquiredThenNextChunkIsUsed) {
+    EventPacketPool packetPool;
+    std::vector<EventPacketPool::Blocks> acquired;
+    for (uint32_t i = 0; i < EventPacketPool::blocksPerChunk; i++) {
+        acquired.push_back(packetPool.acquire(32u, 1u));
+    }
+    EXPECT_EQ(1u, packetPool.getChunkCount());
+
+    auto next = packetPool.acquire(32u, 1u);
+    EXPECT_EQ(2u, packetPool.getChunkCount());
+    EXPECT_EQ(1u, next.chunkIndex);
+    EXPECT_EQ(0u, next.firstBlock);
+
+    packetPool.release(acquired[5]);
+    auto reused = packetPool.acquire(32u, 1u);
+    EXPECT_EQ(0u, reused.chunkIndex);
+    EXPECT_EQ(5u, reused.firstBlock);
+
+    acquired[5] = reused;
+    acquired.push_back(next);
+    for (auto &blocks : acquired) {
+        packetPool.release(blocks);
+    }
+    EXPECT_EQ(0u, packetPool.getUsedBlockCount());
+}
+
+TEST(EventPacketPoolTest, givenFragmentedChunkWhenRunOfBlocksIsAcquiredThenContiguousFreeBlocksAreReturned) {
+    EventPacketPool packetPool;
+    std::vector<EventPacketPool::Blocks> acquired;
+    for (uint32_t i = 0; i < 8; i++) {
+        acquired.push_back(packetPool.acquire(16u, 1u));
+    }
+    packetPool.release(acquired[1]);
+    packetPool.release(acquired[4]);
+    packetPool.release(acquired[5]);
+    packetPool.release(acquired[6]);
+
+    auto run = packetPool.acquire(16u, 3u);
+    EXPECT_EQ(0u, run.chunkIndex);
+    EXPECT_EQ(4u, run.firstBlock);
+    EXPECT_EQ(ptrOffset(acquired[0].address, 4u * 16u), run.address);
+    EXPECT_EQ(8u, packetPool.getUsedBlockCount());
+
+    auto single = packetPool.acquire(16u, 1u);
+    EXPECT_EQ(1u, single.firstBlock);
+
+    packetPool.release(run);
+    packetPool.release(single);
+}
+
+struct EventPacketPoolFixture : public EventFixture<1, 1> {
+    void setUp() {
+        DebugManager.flags.EnableEventPacketPool.set(1);
+        DebugManager.flags.UsePipeControlMultiKernelEventSync.set(0);
+        DebugManager.flags.SignalAllEventPackets.set(0);
+        EventFixture<1, 1>::setUp();
+    }
+};
+
+using EventPacketPoolEventTest = Test<EventPacketPoolFixture>;
+
+TEST_F(EventPacketPoolEventTest, givenPacketPoolEnabledWhenEventIsCreatedThenCompletionDataForSingleKernelIsAcquired) {
+    auto packetPool = eventPool->getPacketPool();
+    ASSERT_NE(nullptr, packetPool);
+    EXPECT_EQ(1u, packetPool->getUsedBlockCount());
+    EXPECT_EQ(sizeof(KernelEventCompletionData<uint32_t>), packetPool->getBlockSize());
+
+    EXPECT_EQ(packetPool, event->kernelEventCompletionData.get_deleter().packetPool);
+    EXPECT_EQ(1u, event->kernelEventCompletionData.get_deleter().blocks.blockCount);
+    EXPECT_EQ(1u, event->getKernelCount());
+    EXPECT_EQ(1u, event->getPacketsInUse());
+
+    auto eventStorage = static_cast<uint32_t *>(event->getHostAddress());
+    for (uint32_t i = 0; i < eventPool->getEventSize() / sizeof(uint32_t); i++) {
+        EXPECT_EQ(static_cast<uint32_t>(Event::STATE_INITIAL), eventStorage[i]);
+    }
+    EXPECT_EQ(static_cast<uint64_t>(Event::STATE_INITIAL), event->kernelEventCompletionData[0].getContextEndValue(0));
+
+    event.reset();
+    EXPECT_EQ(0u, packetPool->getUsedBlockCount());
+}
+
+TEST_F(EventPacketPoolEventTest, givenPacketPoolEnabledWhenKernelCountIncreasesThenCompletionDataGrowsAndKeepsPacketsUsed) {
+    auto packetPool = eventPool->getPacketPool();
+    event->setPacketsInUse(2u);
+    event->increaseKernelCount();
+    EXPECT_EQ(2u, event->kernelEventCompletionData.get_deleter().blocks.blockCount);
+    EXPECT_EQ(2u, packetPool->getUsedBlockCount());
+    EXPECT_EQ(2u, event->kernelEventCompletionData[0].getPacketsUsed());
+
+    event->setPacketsInUse(3u);
+    EXPECT_EQ(5u, event->getPacketsInUse());
+    EXPECT_EQ(event->getGpuAddress(device) + 2u * event->getSinglePacketSize(), event->getPacketAddress(device));
+
+    event->resetKernelCountAndPacketUsedCount();
+    event->increaseKernelCount();
+    EXPECT_EQ(2u, event->kernelEventCompletionData.get_deleter().blocks.blockCount);
+    EXPECT_EQ(2u, packetPool->getUsedBlockCount());
+}
+
+TEST_F(EventPacketPoolEventTest, givenPacketPoolEnabledWhenEventIsSignaledAndResetThenUsedPacketsAreCleared) {
+    event->setPacketsInUse(2u);
+    event->increaseKernelCount();
+    event->setPacketsInUse(1u);
+
+    event->hostSignal();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+
+    event->reset();
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    for (uint32_t kernel = 0; kernel < event->getKernelCount(); kernel++) {
+        for (uint32_t packet = 0; packet < event->kernelEventCompletionData[kernel].getPacketsUsed(); packet++) {
+            EXPECT_EQ(static_cast<uint64_t>(Event::STATE_INITIAL), event->kernelEventCompletionData[kernel].getContextStartValue(packet));
+            EXPECT_EQ(static_cast<uint64_t>(Event::STATE_INITIAL), event->kernelEventCompletionData[kernel].getGlobalEndValue(packet));
+        }
+    }
+}
+
+TEST_F(EventPacketPoolEventTest, givenPacketPoolEnabledAndTimestampEventWithTwoKernelsWhenEventIsHostSignaledThenCompletionDataOfUsedPacketsIsSignaled) {
+    event->setPacketsInUse(2u);
+    event->increaseKernelCount();
+    event->setPacketsInUse(1u);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSignal());
+
+    EXPECT_EQ(2u, event->getKernelCount());
+    for (uint32_t kernel = 0; kernel < event->getKernelCount(); kernel++) {
+        for (uint32_t packet = 0; packet < event->kernelEventCompletionData[kernel].getPacketsUsed(); packet++) {
+            EXPECT_EQ(static_cast<uint64_t>(Event::STATE_SIGNALED), event->kernelEventCompletionData[kernel].getContextEndValue(packet));
+            EXPECT_EQ(static_cast<uint64_t>(Event::STATE_SIGNALED), event->kernelEventCompletionData[kernel].getGlobalEndValue(packet));
+        }
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+}
+
+TEST_F(EventPacketPoolEventTest, givenPacketPoolEnabledWhenEventPoolIsDestroyedBeforeEventThenPacketPoolIsReleasedWithLastEvent) {
+    std::weak_ptr<EventPacketPool> packetPool = eventPool->getPacketPool();
+    ASSERT_FALSE(packetPool.expired());
+
+    auto pooledEvent = std::move(event);
+    eventPool.reset();
+
+    EXPECT_FALSE(packetPool.expired());
+    EXPECT_EQ(1u, packetPool.lock()->getUsedBlockCount());
+
+    pooledEvent.reset();
+    EXPECT_TRUE(packetPool.expired());
+}
+
+TEST_F(EventPacketPoolEventTest, givenManyEventsWhenPacketPoolIsUsedThenCompletionDataIsPackedIntoSharedChunksAndReleasedWithEvents) {
+    constexpr uint32_t eventCount = 3 * EventPacketPool::blocksPerChunk + 1;
+
+    ze_event_pool_desc_t desc = eventPoolDesc;
+    desc.count = eventCount;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> pool(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &desc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto packetPool = pool->getPacketPool();
+    ASSERT_NE(nullptr, packetPool);
+
+    std::vector<std::unique_ptr<EventImp<uint32_t>>> events;
+    for (uint32_t i = 0; i < eventCount; i++) {
+        ze_event_desc_t indexedEventDesc = eventDesc;
+        indexedEventDesc.index = i;
+        events.emplace_back(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(pool.get(), &indexedEventDesc, device)));
+    }
+
+    constexpr size_t blockSize = sizeof(KernelEventCompletionData<uint32_t>);
+    EXPECT_EQ(eventCount, packetPool->getUsedBlockCount());
+    EXPECT_EQ(4u, packetPool->getChunkCount());
+    EXPECT_EQ(4u * EventPacketPool::blocksPerChunk * blockSize, packetPool->getReservedSize());
+
+    for (auto &event : events) {
+        event->reset();
+    }
+    EXPECT_EQ(eventCount, packetPool->getUsedBlockCount());
+
+    events.clear();
+    EXPECT_EQ(0u, packetPool->getUsedBlockCount());
+    EXPECT_EQ(4u, packetPool->getChunkCount());
+}
+
+struct EventPacketPoolDisabledFixture : public EventFixture<1, 1> {
+    void setUp() {
+        DebugManager.flags.EnableEventPacketPool.set(0);
+        DebugManager.flags.UsePipeControlMultiKernelEventSync.set(0);
+        DebugManager.flags.SignalAllEventPackets.set(0);
+        EventFixture<1, 1>::setUp();
+    }
+};
+
+using EventPacketPoolDisabledEventTest = Test<EventPacketPoolDisabledFixture>;
+
+TEST_F(EventPacketPoolDisabledEventTest, givenPacketPoolDisabledAndTimestampEventWithTwoKernelsWhenEventIsHostSignaledThenCompletionDataOfUsedPacketsIsSignaled) {
+    EXPECT_EQ(nullptr, eventPool->getPacketPool());
+    EXPECT_EQ(nullptr, event->kernelEventCompletionData.get_deleter().packetPool);
+
+    event->setPacketsInUse(2u);
+    event->increaseKernelCount();
+    event->setPacketsInUse(1u);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSignal());
+
+    EXPECT_EQ(2u, event->getKernelCount());
+    for (uint32_t kernel = 0; kernel < event->getKernelCount(); kernel++) {
+        for (uint32_t packet = 0; packet < event->kernelEventCompletionData[kernel].getPacketsUsed(); packet++) {
+            EXPECT_EQ(static_cast<uint64_t>(Event::STATE_SIGNALED), event->kernelEventCompletionData[kernel].getContextEndValue(packet));
+            EXPECT_EQ(static_cast<uint64_t>(Event::STATE_SIGNALED), event->kernelEventCompletionData[kernel].getGlobalEndValue(packet));
+        }
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+}
+
+} // namespace ult
+} // namespace L0
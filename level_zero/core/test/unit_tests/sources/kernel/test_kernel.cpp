@@ -16,6 +16,7 @@
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/kernel_info_from_patchtokens.h"
+#include "shared/source/program/print_formatter.h"
 #include "shared/source/utilities/stackvec.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
@@ -33,6 +34,7 @@
 #include "level_zero/core/source/kernel/kernel_hw.h"
 #include "level_zero/core/source/kernel/sampler_patch_values.h"
 #include "level_zero/core/source/module/module_imp.h"
+#include "level_zero/core/source/printf_handler/printf_drainer.h"
 #include "level_zero/core/source/printf_handler/printf_handler.h"
 #include "level_zero/core/source/sampler/sampler_hw.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
@@ -1830,6 +1832,25 @@ TEST_F(KernelPropertiesTests, givenValidKernelAndLargeDataIsSetThenForceLargeDat
     EXPECT_EQ(NEO::SlmPolicy::SlmPolicyLargeData, kernel->getSlmPolicy());
 }
 
+TEST_F(KernelPropertiesTests, givenKernelWhenArgumentsOrPropertiesAreSetThenStateVersionChangesOnlyWhenStateChanges) {
+    auto stateVersion = kernel->getStateVersion();
+
+    auto groupSize = kernel->getGroupSize();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setGroupSize(groupSize[0], groupSize[1], groupSize[2]));
+    EXPECT_EQ(stateVersion, kernel->getStateVersion());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setGlobalOffsetExp(1, 2, 3));
+    EXPECT_NE(stateVersion, kernel->getStateVersion());
+    stateVersion = kernel->getStateVersion();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setCacheConfig(ZE_CACHE_CONFIG_FLAG_LARGE_SLM));
+    EXPECT_NE(stateVersion, kernel->getStateVersion());
+    stateVersion = kernel->getStateVersion();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setIndirectAccess(ZE_KERNEL_INDIRECT_ACCESS_FLAG_DEVICE));
+    EXPECT_NE(stateVersion, kernel->getStateVersion());
+}
+
 TEST_F(KernelPropertiesTests, WhenGetExtensionIsCalledWithUnknownExtensionTypeThenReturnNullptr) {
     EXPECT_EQ(nullptr, kernel->getExtension(0U));
 }
@@ -2717,6 +2738,153 @@ TEST_F(PrintfTest, WhenCreatingPrintfBufferThenCrossThreadDataIsPatched) {
     mockKernel.crossThreadData.release();
 }
 
+TEST_F(PrintfTest, givenKernelStillExecutingWhenDrainingPrintfOutputThenRecordsReservedBeforePreviousDrainArePrintedAndRestIsPrintedOnCompletion) {
+    Mock<Module> mockModule(this->device, nullptr);
+    Mock<Kernel> mockKernel;
+    mockKernel.descriptor.kernelAttributes.flags.usesPrintf = true;
+    mockKernel.descriptor.kernelAttributes.flags.usesStringMapForPrintf = true;
+    mockKernel.descriptor.kernelAttributes.binaryFormat = DeviceBinaryFormat::Patchtokens;
+    mockKernel.descriptor.kernelMetadata.printfStringsMap.insert(std::make_pair(0u, std::string("record %d\n")));
+    mockKernel.module = &mockModule;
+    mockKernel.createPrintfBuffer();
+    ASSERT_NE(nullptr, mockKernel.getPrintfBufferAllocation());
+
+    auto printfBuffer = static_cast<uint32_t *>(mockKernel.getPrintfBufferAllocation()->getUnderlyingBuffer());
+    auto writeRecord = [printfBuffer](int value) {
+        auto index = printfBuffer[0] / sizeof(uint32_t);
+        printfBuffer[index] = 0u;
+        printfBuffer[index + 1] = static_cast<uint32_t>(NEO::PRINTF_DATA_TYPE::INT);
+        printfBuffer[index + 2] = static_cast<uint32_t>(value);
+        printfBuffer[0] += 3 * sizeof(uint32_t);
+    };
+
+    auto csr = this->neoDevice->getDefaultEngine().commandStreamReceiver;
+    auto tagAddress = csr->getTagAddress();
+    *tagAddress = 4u;
+    mockKernel.setPrintfTaskCountToWait(csr, 5u);
+
+    writeRecord(1);
+    testing::internal::CaptureStdout();
+    mockKernel.drainPrintfOutput();
+    EXPECT_STREQ("", testing::internal::GetCapturedStdout().c_str());
+
+    writeRecord(2);
+    testing::internal::CaptureStdout();
+    mockKernel.drainPrintfOutput();
+    EXPECT_STREQ("record 1\n", testing::internal::GetCapturedStdout().c_str());
+
+    testing::internal::CaptureStdout();
+    mockKernel.drainPrintfOutput();
+    EXPECT_STREQ("record 2\n", testing::internal::GetCapturedStdout().c_str());
+    EXPECT_EQ(csr, mockKernel.printfCsr);
+
+    writeRecord(3);
+    *tagAddress = 5u;
+    testing::internal::CaptureStdout();
+    mockKernel.drainPrintfOutput();
+    EXPECT_STREQ("record 3\n", testing::internal::GetCapturedStdout().c_str());
+    EXPECT_EQ(nullptr, mockKernel.printfCsr);
+    EXPECT_EQ(sizeof(uint32_t), printfBuffer[0]);
+
+    testing::internal::CaptureStdout();
+    mockKernel.drainPrintfOutput();
+    EXPECT_STREQ("", testing::internal::GetCapturedStdout().c_str());
+}
+
+TEST_F(PrintfTest, givenPartiallyDrainedPrintfOutputWhenPrintingPrintfOutputThenOnlyRecordsNotDrainedArePrinted) {
+    Mock<Module> mockModule(this->device, nullptr);
+    Mock<Kernel> mockKernel;
+    mockKernel.descriptor.kernelAttributes.flags.usesPrintf = true;
+    mockKernel.descriptor.kernelAttributes.flags.usesStringMapForPrintf = true;
+    mockKernel.descriptor.kernelAttributes.binaryFormat = DeviceBinaryFormat::Patchtokens;
+    mockKernel.descriptor.kernelMetadata.printfStringsMap.insert(std::make_pair(0u, std::string("record %d\n")));
+    mockKernel.module = &mockModule;
+    mockKernel.createPrintfBuffer();
+    ASSERT_NE(nullptr, mockKernel.getPrintfBufferAllocation());
+
+    auto printfBuffer = static_cast<uint32_t *>(mockKernel.getPrintfBufferAllocation()->getUnderlyingBuffer());
+    auto writeRecord = [printfBuffer](int value) {
+        auto index = printfBuffer[0] / sizeof(uint32_t);
+        printfBuffer[index] = 0u;
+        printfBuffer[index + 1] = static_cast<uint32_t>(NEO::PRINTF_DATA_TYPE::INT);
+        printfBuffer[index + 2] = static_cast<uint32_t>(value);
+        printfBuffer[0] += 3 * sizeof(uint32_t);
+    };
+
+    writeRecord(1);
+    mockKernel.drainPrintfOutput();
+    writeRecord(2);
+    testing::internal::CaptureStdout();
+    mockKernel.drainPrintfOutput();
+    EXPECT_STREQ("record 1\n", testing::internal::GetCapturedStdout().c_str());
+
+    testing::internal::CaptureStdout();
+    mockKernel.::L0::KernelImp::printPrintfOutput(false);
+    EXPECT_STREQ("record 2\n", testing::internal::GetCapturedStdout().c_str());
+    EXPECT_EQ(sizeof(uint32_t), printfBuffer[0]);
+
+    writeRecord(3);
+    testing::internal::CaptureStdout();
+    mockKernel.::L0::KernelImp::printPrintfOutput(false);
+    EXPECT_STREQ("record 3\n", testing::internal::GetCapturedStdout().c_str());
+}
+
+struct MockPrintfDrainer : public PrintfDrainer {
+    using PrintfDrainer::kernels;
+    using PrintfDrainer::kernelsMutex;
+    using PrintfDrainer::PrintfDrainer;
+};
+
+TEST_F(PrintfTest, givenDeviceWithPrintfDrainerWhenCreatingPrintfBufferThenKernelIsRegisteredUntilDestroyed) {
+    auto deviceImp = static_cast<DeviceImp *>(this->device);
+    deviceImp->printfDrainer = std::make_unique<MockPrintfDrainer>(std::chrono::microseconds{100});
+    auto drainer = static_cast<MockPrintfDrainer *>(deviceImp->printfDrainer.get());
+
+    Mock<Module> mockModule(this->device, nullptr);
+    {
+        Mock<Kernel> mockKernel;
+        mockKernel.descriptor.kernelAttributes.flags.usesPrintf = true;
+        mockKernel.module = &mockModule;
+        mockKernel.createPrintfBuffer();
+        drainer->stop();
+
+        std::lock_guard<std::mutex> lock(drainer->kernelsMutex);
+        ASSERT_EQ(1u, drainer->kernels.size());
+        EXPECT_EQ(&mockKernel, drainer->kernels[0]);
+    }
+
+    std::lock_guard<std::mutex> lock(drainer->kernelsMutex);
+    EXPECT_TRUE(drainer->kernels.empty());
+}
+
+TEST_F(PrintfTest, givenKernelRegisteredInPrintfDrainerWhenDestroyingKernelThenItIsUnregisteredBeforeDestructionStarts) {
+    auto deviceImp = static_cast<DeviceImp *>(this->device);
+    deviceImp->printfDrainer = std::make_unique<MockPrintfDrainer>(std::chrono::microseconds{100});
+    auto drainer = static_cast<MockPrintfDrainer *>(deviceImp->printfDrainer.get());
+
+    struct KernelCheckingDrainerOnDestruction : public Mock<Kernel> {
+        ~KernelCheckingDrainerOnDestruction() override {
+            std::lock_guard<std::mutex> lock(drainer->kernelsMutex);
+            *registeredOnDestruction = !drainer->kernels.empty();
+        }
+        MockPrintfDrainer *drainer = nullptr;
+        bool *registeredOnDestruction = nullptr;
+    };
+
+    Mock<Module> mockModule(this->device, nullptr);
+    bool registeredOnDestruction = true;
+    auto mockKernel = new KernelCheckingDrainerOnDestruction;
+    mockKernel->drainer = drainer;
+    mockKernel->registeredOnDestruction = &registeredOnDestruction;
+    mockKernel->descriptor.kernelAttributes.flags.usesPrintf = true;
+    mockKernel->module = &mockModule;
+    mockKernel->createPrintfBuffer();
+    drainer->stop();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockKernel->destroy());
+    EXPECT_FALSE(registeredOnDestruction);
+}
+
 using PrintfHandlerTests = ::testing::Test;
 
 HWTEST_F(PrintfHandlerTests, givenKernelWithPrintfWhenPrintingOutputWithBlitterUsedThenBlitterCopiesBuffer) {
@@ -126,6 +126,77 @@ class KernelImpSuggestGroupSize : public DeviceFixture, public ::testing::TestWi
 INSTANTIATE_TEST_CASE_P(, KernelImpSuggestGroupSize,
                         ::testing::Values(4, 7, 8, 16, 32, 192, 1024, 4097, 16000));
 
+TEST_F(KernelImp, GivenGroupSizeSuggestionCacheEnabledWhenSuggestingGroupSizeThenCachedResultIsReusedOnlyForMatchingInputs) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableComputeWorkSizeND.set(false);
+    NEO::DebugManager.flags.EnableKernelGroupSizeSuggestionCache.set(1);
+
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    kernelInfo.kernelDescriptor = &descriptor;
+
+    Mock<Module> module(device, nullptr);
+    module.getMaxGroupSizeResult = 8;
+
+    Mock<Kernel> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    uint32_t groupSize[3] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(8u, groupSize[0]);
+
+    uint32_t cachedGroupSize[3] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(256, 1, 1, cachedGroupSize, cachedGroupSize + 1, cachedGroupSize + 2));
+    EXPECT_EQ(groupSize[0], cachedGroupSize[0]);
+    EXPECT_EQ(groupSize[1], cachedGroupSize[1]);
+    EXPECT_EQ(groupSize[2], cachedGroupSize[2]);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(6, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(6u, groupSize[0]);
+
+    module.getMaxGroupSizeResult = 4;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(4u, groupSize[0]);
+
+    Mock<Kernel> otherKernel;
+    otherKernel.kernelImmData = &kernelInfo;
+    otherKernel.module = &module;
+    module.getMaxGroupSizeResult = 2;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, otherKernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(2u, groupSize[0]);
+}
+
+TEST_P(KernelImpSuggestGroupSize, GivenGroupSizeSuggestionCacheEnabledWhenSlmSizeExceedsLocalMemorySizeThenErrorIsNotCached) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableKernelGroupSizeSuggestionCache.set(1);
+
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    kernelInfo.kernelDescriptor = &descriptor;
+
+    Mock<Module> module(device, nullptr);
+
+    Mock<Kernel> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    uint32_t size = GetParam();
+    uint32_t groupSize[3];
+    auto localMemSize = static_cast<uint32_t>(device->getNEODevice()->getDeviceInfo().localMemSize);
+
+    kernelInfo.kernelDescriptor->kernelAttributes.slmInlineSize = localMemSize + 10u;
+    EXPECT_EQ(ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY, kernel.KernelImp::suggestGroupSize(size, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY, kernel.KernelImp::suggestGroupSize(size, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+
+    kernelInfo.kernelDescriptor->kernelAttributes.slmInlineSize = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(size, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(0u, size % groupSize[0]);
+
+    kernelInfo.kernelDescriptor->kernelAttributes.slmInlineSize = localMemSize + 10u;
+    EXPECT_EQ(ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY, kernel.KernelImp::suggestGroupSize(size, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+}
+
 TEST_P(KernelImpSuggestGroupSize, WhenSuggestingGroupThenProperGroupSizeChosen) {
     DebugManagerStateRestore restorer;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,8 +8,13 @@
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include "level_zero/core/source/printf_handler/printf_drainer.h"
 #include "level_zero/core/source/printf_handler/printf_handler.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_device.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
+
+#include <atomic>
+#include <thread>
 
 namespace L0 {
 namespace ult {
@@ -23,5 +28,56 @@ TEST(PrintfHandler, whenPrintfBufferIscreatedThenCorrectAllocationTypeIsUsed) {
     neoDevice->getMemoryManager()->freeGraphicsMemory(allocation);
 }
 
+struct MockPrintfDrainer : public PrintfDrainer {
+    using PrintfDrainer::drainerThread;
+    using PrintfDrainer::kernels;
+    using PrintfDrainer::PrintfDrainer;
+};
+
+struct DrainCountingKernel : public Mock<::L0::Kernel> {
+    void drainPrintfOutput() override {
+        drainCalls++;
+    }
+    std::atomic<uint32_t> drainCalls{0};
+};
+
+TEST(PrintfDrainerTest, givenRegisteredKernelWhenDrainerThreadRunsThenKernelIsDrainedUntilUnregistered) {
+    MockPrintfDrainer drainer(std::chrono::microseconds{1});
+    DrainCountingKernel kernel;
+    EXPECT_EQ(nullptr, drainer.drainerThread.get());
+
+    drainer.registerKernel(&kernel);
+    drainer.registerKernel(&kernel);
+    EXPECT_NE(nullptr, drainer.drainerThread.get());
+
+    while (kernel.drainCalls.load() == 0) {
+        std::this_thread::yield();
+    }
+
+    drainer.unregisterKernel(&kernel);
+    drainer.stop();
+    EXPECT_EQ(nullptr, drainer.drainerThread.get());
+    EXPECT_TRUE(drainer.kernels.empty());
+
+    auto drainCalls = kernel.drainCalls.load();
+    drainer.drain();
+    EXPECT_EQ(drainCalls, kernel.drainCalls.load());
+}
+
+TEST(PrintfDrainerTest, givenKernelRegisteredTwiceWhenDrainingThenKernelIsDrainedOnce) {
+    MockPrintfDrainer drainer(std::chrono::microseconds{1});
+    DrainCountingKernel kernel;
+
+    drainer.registerKernel(&kernel);
+    drainer.registerKernel(&kernel);
+    drainer.stop();
+    EXPECT_EQ(1u, drainer.kernels.size());
+
+    auto drainCalls = kernel.drainCalls.load();
+    drainer.drain();
+    EXPECT_EQ(drainCalls + 1, kernel.drainCalls.load());
+    drainer.unregisterKernel(&kernel);
+}
+
 } // namespace ult
 } // namespace L0
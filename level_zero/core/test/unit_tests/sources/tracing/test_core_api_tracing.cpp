@@ -343,5 +343,64 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     L0::tracingInProgress = 0;
 }
 
+TEST_F(ZeApiTracingCoreTests, GivenEnabledTracersWhenGeneratingPerApiCallbackStateThenOnlyTracersHookingThatApiAreReturned) {
+    int closeUserData = 5;
+    int deviceGetUserData = 6;
+    zet_tracer_exp_desc_t closeTracerDesc = {};
+    zet_tracer_exp_desc_t deviceGetTracerDesc = {};
+    closeTracerDesc.pUserData = &closeUserData;
+    deviceGetTracerDesc.pUserData = &deviceGetUserData;
+
+    zet_tracer_exp_handle_t closeTracer = nullptr;
+    zet_tracer_exp_handle_t deviceGetTracer = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetTracerExpCreate(nullptr, &closeTracerDesc, &closeTracer));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetTracerExpCreate(nullptr, &deviceGetTracerDesc, &deviceGetTracer));
+
+    zet_core_callbacks_t closeCbs = {};
+    closeCbs.CommandList.pfnCloseCb = onEnterCommandListCloseWithUserData;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetTracerExpSetPrologues(closeTracer, &closeCbs));
+
+    zet_core_callbacks_t deviceGetCbs = {};
+    deviceGetCbs.Device.pfnGetCb = [](ze_device_get_params_t *params, ze_result_t result, void *pTracerUserData, void **ppTracerInstanceUserData) {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetTracerExpSetEpilogues(deviceGetTracer, &deviceGetCbs));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetTracerExpSetEnabled(closeTracer, true));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetTracerExpSetEnabled(deviceGetTracer, true));
+
+    {
+        L0::APITracerCallbackDataImp<ze_pfnCommandListCloseCb_t> apiCallbackData;
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListCloseCb_t, CommandList, pfnCloseCb);
+
+        ASSERT_EQ(1u, apiCallbackData.prologCallbacks.size());
+        ASSERT_EQ(1u, apiCallbackData.epilogCallbacks.size());
+        EXPECT_EQ(closeCbs.CommandList.pfnCloseCb, apiCallbackData.prologCallbacks[0].current_api_callback);
+        EXPECT_EQ(&closeUserData, apiCallbackData.prologCallbacks[0].pUserData);
+        EXPECT_EQ(nullptr, apiCallbackData.epilogCallbacks[0].current_api_callback);
+        L0::pGlobalAPITracerContextImp->releaseActivetracersList();
+    }
+    {
+        L0::APITracerCallbackDataImp<ze_pfnDeviceGetCb_t> apiCallbackData;
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetCb_t, Device, pfnGetCb);
+
+        ASSERT_EQ(1u, apiCallbackData.epilogCallbacks.size());
+        EXPECT_EQ(deviceGetCbs.Device.pfnGetCb, apiCallbackData.epilogCallbacks[0].current_api_callback);
+        EXPECT_EQ(&deviceGetUserData, apiCallbackData.epilogCallbacks[0].pUserData);
+        L0::pGlobalAPITracerContextImp->releaseActivetracersList();
+    }
+    {
+        L0::APITracerCallbackDataImp<ze_pfnDeviceGetPropertiesCb_t> apiCallbackData;
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetPropertiesCb_t, Device, pfnGetPropertiesCb);
+
+        EXPECT_EQ(0u, apiCallbackData.prologCallbacks.size());
+        EXPECT_EQ(0u, apiCallbackData.epilogCallbacks.size());
+        L0::pGlobalAPITracerContextImp->releaseActivetracersList();
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetTracerExpSetEnabled(closeTracer, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetTracerExpSetEnabled(deviceGetTracer, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetTracerExpDestroy(closeTracer));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetTracerExpDestroy(deviceGetTracer));
+}
+
 } // namespace ult
 } // namespace L0
@@ -1225,5 +1225,184 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhe
     context->freeMem(dstPtr);
 }
 
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyWhenSweepingCopySizesThenEngineCountGrowsWithSizeUpToAvailableEngines, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+    DebugManager.flags.SplitBcsMaskD2H.set(0b010101010);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_EQ(bcsSplit.d2hCmdQs.size(), 4u);
+
+    const std::pair<size_t, size_t> expectedEngineCounts[] = {{MemoryConstants::megaByte, 1u},
+                                                              {4 * MemoryConstants::megaByte, 2u},
+                                                              {6 * MemoryConstants::megaByte, 3u},
+                                                              {8 * MemoryConstants::megaByte, 4u},
+                                                              {64 * MemoryConstants::megaByte, 4u},
+                                                              {MemoryConstants::gigaByte, 4u}};
+
+    for (const auto &[size, engineCount] : expectedEngineCounts) {
+        EXPECT_EQ(engineCount, bcsSplit.getEngineCountForSplit(size, bcsSplit.d2hCmdQs.size()));
+
+        StackVec<CommandQueue *, 4> selectedCmdQs;
+        bcsSplit.selectCmdQsForSplit(NEO::TransferDirection::LocalToHost, size, selectedCmdQs);
+        ASSERT_EQ(engineCount, selectedCmdQs.size());
+        for (size_t i = 0; i < engineCount; i++) {
+            EXPECT_EQ(bcsSplit.d2hCmdQs[i], selectedCmdQs[i]);
+        }
+    }
+
+    DebugManager.flags.SplitBcsMinChunkSize.set(static_cast<int32_t>(4 * MemoryConstants::megaByte));
+    EXPECT_EQ(1u, bcsSplit.getEngineCountForSplit(4 * MemoryConstants::megaByte, bcsSplit.d2hCmdQs.size()));
+    EXPECT_EQ(2u, bcsSplit.getEngineCountForSplit(8 * MemoryConstants::megaByte, bcsSplit.d2hCmdQs.size()));
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndBusyEnginesWhenSelectingCmdQsForSplitThenLeastLoadedEnginesAreUsed, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+    DebugManager.flags.SplitBcsMaskD2H.set(0b010101010);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    ASSERT_EQ(bcsSplit.d2hCmdQs.size(), 4u);
+
+    auto getUltCsr = [&](size_t index) {
+        return static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(static_cast<CommandQueueImp *>(bcsSplit.d2hCmdQs[index])->getCsr());
+    };
+    getUltCsr(0)->taskCount = *getUltCsr(0)->tagAddress + 5;
+    getUltCsr(2)->taskCount = *getUltCsr(2)->tagAddress + 3;
+
+    EXPECT_EQ(5u, BcsSplit::getOutstandingTaskCount(bcsSplit.d2hCmdQs[0]));
+    EXPECT_EQ(0u, BcsSplit::getOutstandingTaskCount(bcsSplit.d2hCmdQs[1]));
+    EXPECT_EQ(3u, BcsSplit::getOutstandingTaskCount(bcsSplit.d2hCmdQs[2]));
+
+    StackVec<CommandQueue *, 4> selectedCmdQs;
+    bcsSplit.selectCmdQsForSplit(NEO::TransferDirection::LocalToHost, 4 * MemoryConstants::megaByte, selectedCmdQs);
+    ASSERT_EQ(2u, selectedCmdQs.size());
+    EXPECT_EQ(bcsSplit.d2hCmdQs[1], selectedCmdQs[0]);
+    EXPECT_EQ(bcsSplit.d2hCmdQs[3], selectedCmdQs[1]);
+
+    selectedCmdQs.clear();
+    bcsSplit.selectCmdQsForSplit(NEO::TransferDirection::LocalToHost, 6 * MemoryConstants::megaByte, selectedCmdQs);
+    ASSERT_EQ(3u, selectedCmdQs.size());
+    EXPECT_EQ(bcsSplit.d2hCmdQs[1], selectedCmdQs[0]);
+    EXPECT_EQ(bcsSplit.d2hCmdQs[2], selectedCmdQs[1]);
+    EXPECT_EQ(bcsSplit.d2hCmdQs[3], selectedCmdQs[2]);
+
+    getUltCsr(0)->taskCount = *getUltCsr(0)->tagAddress;
+    getUltCsr(2)->taskCount = *getUltCsr(2)->tagAddress;
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndManyEventSetsInFlightWhenObtainEventsForSplitThenNewSetIsAllocatedWithoutWaiting, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+
+    auto &events = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit.events;
+    auto context = Context::fromHandle(commandList0->getCmdListContext());
+    constexpr size_t maxEventCountInPool = 4096u;
+    constexpr size_t setsInFlight = 300u;
+
+    for (size_t i = 0; i < setsInFlight; i++) {
+        EXPECT_EQ(i, events.obtainForSplit(context, maxEventCountInPool));
+    }
+
+    EXPECT_EQ(setsInFlight, events.obtainForSplit(context, maxEventCountInPool));
+    EXPECT_EQ(setsInFlight + 1, events.marker.size());
+    EXPECT_EQ(setsInFlight + 1, events.barrier.size());
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndCompletedEventSetWhenObtainEventsForSplitThenCompletedSetIsResetAndReused, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+
+    auto &events = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit.events;
+    auto context = Context::fromHandle(commandList0->getCmdListContext());
+
+    EXPECT_EQ(0u, events.allocateNew(context, 12));
+    EXPECT_EQ(1u, events.allocateNew(context, 12));
+    events.marker[1]->hostSignal();
+    events.barrier[1]->hostSignal();
+
+    EXPECT_EQ(1u, events.obtainForSplit(context, 12));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events.marker[1]->queryStatus());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events.barrier[1]->queryStatus());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events.marker[0]->queryStatus());
+    EXPECT_EQ(2u, events.marker.size());
+}
+
 } // namespace ult
 } // namespace L0
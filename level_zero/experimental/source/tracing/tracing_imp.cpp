@@ -10,6 +10,8 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/sleep.h"
 
+#include <cstring>
+
 namespace L0 {
 
 thread_local ze_bool_t tracingInProgress = 0;
@@ -167,33 +169,76 @@ size_t APITracerContextImp::testAndFreeRetiredTracers() {
         if (testForTracerArrayReferences(retiringTracerArray))
             continue;
         this->retiringTracerArrayList.remove(retiringTracerArray);
-        delete[] retiringTracerArray->tracerArrayEntries;
-        delete retiringTracerArray;
+        freeTracerArray(retiringTracerArray);
     }
     return this->retiringTracerArrayList.size();
 }
 
+static tracer_callback_t getTracerCallback(const zet_core_callbacks_t &callbacks, size_t slot) {
+    tracer_callback_t callback;
+    memcpy(&callback, reinterpret_cast<const uint8_t *>(&callbacks) + slot * sizeof(tracer_callback_t), sizeof(tracer_callback_t));
+    return callback;
+}
+
+tracer_array_t *APITracerContextImp::createTracerArray(const std::list<struct APITracerImp *> &tracers) {
+    tracer_array_t *newTracerArray = new tracer_array_t;
+
+    newTracerArray->tracerArrayCount = tracers.size();
+    newTracerArray->tracerArrayEntries = new tracer_array_entry_t[tracers.size()];
+    //
+    // iterate over the list of enabled tracers, copying their entries into the
+    // new tracer array
+    //
+    size_t i = 0;
+    for (auto tracer : tracers) {
+        newTracerArray->tracerArrayEntries[i] = tracer->tracerFunctions;
+        i++;
+    }
+
+    //
+    // flatten the entries per API slot, skipping tracers that do not
+    // hook the given API at all
+    //
+    newTracerArray->apiCallbacksOffsets = new size_t[tracerApiSlotCount + 1];
+    size_t callbackCount = 0;
+    for (size_t slot = 0; slot < tracerApiSlotCount; slot++) {
+        newTracerArray->apiCallbacksOffsets[slot] = callbackCount;
+        for (i = 0; i < newTracerArray->tracerArrayCount; i++) {
+            const auto &entry = newTracerArray->tracerArrayEntries[i];
+            if (getTracerCallback(entry.corePrologues, slot) != nullptr || getTracerCallback(entry.coreEpilogues, slot) != nullptr) {
+                callbackCount++;
+            }
+        }
+    }
+    newTracerArray->apiCallbacksOffsets[tracerApiSlotCount] = callbackCount;
+
+    newTracerArray->apiCallbacks = new tracer_api_callbacks_t[callbackCount];
+    size_t callbackIndex = 0;
+    for (size_t slot = 0; slot < tracerApiSlotCount; slot++) {
+        for (i = 0; i < newTracerArray->tracerArrayCount; i++) {
+            const auto &entry = newTracerArray->tracerArrayEntries[i];
+            tracer_api_callbacks_t callbacks = {getTracerCallback(entry.corePrologues, slot), getTracerCallback(entry.coreEpilogues, slot), entry.pUserData};
+            if (callbacks.prologue != nullptr || callbacks.epilogue != nullptr) {
+                newTracerArray->apiCallbacks[callbackIndex++] = callbacks;
+            }
+        }
+    }
+
+    return newTracerArray;
+}
+
+void APITracerContextImp::freeTracerArray(tracer_array_t *tracerArray) {
+    delete[] tracerArray->apiCallbacks;
+    delete[] tracerArray->apiCallbacksOffsets;
+    delete[] tracerArray->tracerArrayEntries;
+    delete tracerArray;
+}
+
 size_t APITracerContextImp::updateTracerArrays() {
     tracer_array_t *newTracerArray;
-    size_t newTracerArrayCount = this->enabledTracerImpList.size();
-
-    if (newTracerArrayCount != 0) {
-
-        newTracerArray = new tracer_array_t;
-
-        newTracerArray->tracerArrayCount = newTracerArrayCount;
-        newTracerArray->tracerArrayEntries = new tracer_array_entry_t[newTracerArrayCount];
-        //
-        // iterate over the list of enabled tracers, copying their entries into the
-        // new tracer array
-        //
-        size_t i = 0;
-        std::list<struct APITracerImp *>::iterator itr;
-        for (itr = enabledTracerImpList.begin(); itr != enabledTracerImpList.end(); itr++) {
-            newTracerArray->tracerArrayEntries[i] = (*itr)->tracerFunctions;
-            i++;
-        }
 
+    if (!this->enabledTracerImpList.empty()) {
+        newTracerArray = createTracerArray(this->enabledTracerImpList);
     } else {
         newTracerArray = &emptyTracerArray;
     }
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/stackvec.h"
+
 #include "level_zero/experimental/source/tracing/tracing.h"
 #include "level_zero/experimental/source/tracing/tracing_barrier_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_cmdlist_imp.h"
@@ -26,8 +28,10 @@
 
 #include "ze_ddi_tables.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <list>
 #include <mutex>
 #include <vector>
@@ -46,11 +50,28 @@ typedef struct tracer_array_entry {
     void *pUserData;
 } tracer_array_entry_t;
 
+typedef void (*tracer_callback_t)();
+
+typedef struct tracer_api_callbacks {
+    tracer_callback_t prologue;
+    tracer_callback_t epilogue;
+    void *pUserData;
+} tracer_api_callbacks_t;
+
+//
+// Callbacks of all enabled tracers are also kept flattened per API, so that
+// a traced call only has to look up its own slot. Tracers that registered
+// neither a prologue nor an epilogue for a given API are left out of its slot.
+//
 typedef struct tracerArray {
     size_t tracerArrayCount;
     tracer_array_entry_t *tracerArrayEntries;
+    tracer_api_callbacks_t *apiCallbacks;
+    size_t *apiCallbacksOffsets;
 } tracer_array_t;
 
+constexpr size_t tracerApiSlotCount = sizeof(zet_core_callbacks_t) / sizeof(tracer_callback_t);
+
 typedef enum tracingState {
     disabledState,        // tracing has never been enabled
     enabledState,         // tracing is enabled.
@@ -109,7 +130,7 @@ struct APITracerContextImp : APITracerContext {
 
   private:
     std::mutex traceTableMutex;
-    tracer_array_t emptyTracerArray = {0, NULL};
+    tracer_array_t emptyTracerArray = {0, NULL, NULL, NULL};
     std::atomic<tracer_array_t *> activeTracerArray;
 
     //
@@ -124,6 +145,8 @@ struct APITracerContextImp : APITracerContext {
     std::list<struct APITracerImp *> enabledTracerImpList;
 
     ze_bool_t testForTracerArrayReferences(tracer_array_t *tracerArray);
+    static tracer_array_t *createTracerArray(const std::list<struct APITracerImp *> &tracers);
+    static void freeTracerArray(tracer_array_t *tracerArray);
     size_t testAndFreeRetiredTracers();
     size_t updateTracerArrays();
 
@@ -140,12 +163,36 @@ class APITracerCallbackStateImp {
     void *pUserData;
 };
 
+template <class T>
+class APITracerCallbackTableImp {
+  public:
+    size_t size() const { return count; }
+    APITracerCallbackStateImp<T> operator[](size_t index) const {
+        return {reinterpret_cast<T>(entries[index].*callback), entries[index].pUserData};
+    }
+
+    tracer_callback_t tracer_api_callbacks_t::*callback;
+    const tracer_api_callbacks_t *entries = nullptr;
+    size_t count = 0;
+};
+
 template <class T>
 class APITracerCallbackDataImp {
   public:
+    void setCallbacks(const tracer_array_t *tracerArray, size_t callbackOffset) {
+        if (tracerArray->apiCallbacks == nullptr) {
+            return;
+        }
+        const size_t slot = callbackOffset / sizeof(tracer_callback_t);
+        const auto first = tracerArray->apiCallbacksOffsets[slot];
+        const auto count = tracerArray->apiCallbacksOffsets[slot + 1] - first;
+        prologCallbacks.entries = epilogCallbacks.entries = tracerArray->apiCallbacks + first;
+        prologCallbacks.count = epilogCallbacks.count = count;
+    }
+
     T apiOrdinal = {};
-    std::vector<L0::APITracerCallbackStateImp<T>> prologCallbacks;
-    std::vector<L0::APITracerCallbackStateImp<T>> epilogCallbacks;
+    APITracerCallbackTableImp<T> prologCallbacks{&tracer_api_callbacks_t::prologue};
+    APITracerCallbackTableImp<T> epilogCallbacks{&tracer_api_callbacks_t::epilogue};
 };
 
 #define ZE_HANDLE_TRACER_RECURSION(ze_api_ptr, ...) \
@@ -156,55 +203,35 @@ class APITracerCallbackDataImp {
         L0::tracingInProgress = 1;                  \
     } while (0)
 
-#define ZE_GEN_TRACER_ARRAY_ENTRY(callbackPtr, tracerArray, tracerArrayIndex, callbackType, callbackCategory, callbackFunction) \
-    do {                                                                                                                        \
-        callbackPtr = tracerArray->tracerArrayEntries[tracerArrayIndex].callbackType.callbackCategory.callbackFunction;         \
-    } while (0)
-
-#define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType, callbackCategory, callbackFunctionType)                               \
-    L0::tracer_array_t *currentTracerArray;                                                                                                 \
-    currentTracerArray = (L0::tracer_array_t *)L0::pGlobalAPITracerContextImp->getActiveTracersList();                                      \
-    if (currentTracerArray) {                                                                                                               \
-        for (size_t i = 0; i < currentTracerArray->tracerArrayCount; i++) {                                                                 \
-            tracerType prologueCallbackPtr;                                                                                                 \
-            tracerType epilogue_callback_ptr;                                                                                               \
-            ZE_GEN_TRACER_ARRAY_ENTRY(prologueCallbackPtr, currentTracerArray, i, corePrologues, callbackCategory, callbackFunctionType);   \
-            ZE_GEN_TRACER_ARRAY_ENTRY(epilogue_callback_ptr, currentTracerArray, i, coreEpilogues, callbackCategory, callbackFunctionType); \
-                                                                                                                                            \
-            L0::APITracerCallbackStateImp<tracerType> prologCallback;                                                                       \
-            prologCallback.current_api_callback = prologueCallbackPtr;                                                                      \
-            prologCallback.pUserData = currentTracerArray->tracerArrayEntries[i].pUserData;                                                 \
-            perApiCallbackData.prologCallbacks.push_back(prologCallback);                                                                   \
-                                                                                                                                            \
-            L0::APITracerCallbackStateImp<tracerType> epilogCallback;                                                                       \
-            epilogCallback.current_api_callback = epilogue_callback_ptr;                                                                    \
-            epilogCallback.pUserData = currentTracerArray->tracerArrayEntries[i].pUserData;                                                 \
-            perApiCallbackData.epilogCallbacks.push_back(epilogCallback);                                                                   \
-        }                                                                                                                                   \
+#define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType, callbackCategory, callbackFunctionType)                   \
+    L0::tracer_array_t *currentTracerArray;                                                                                     \
+    currentTracerArray = (L0::tracer_array_t *)L0::pGlobalAPITracerContextImp->getActiveTracersList();                          \
+    if (currentTracerArray) {                                                                                                   \
+        perApiCallbackData.setCallbacks(currentTracerArray, offsetof(zet_core_callbacks_t, callbackCategory.callbackFunctionType)); \
     }
 
 template <typename TFunction_pointer, typename TParams, typename TTracer, typename TTracerPrologCallbacks, typename TTracerEpilogCallbacks, typename... Args>
 ze_result_t apiTracerWrapperImp(TFunction_pointer zeApiPtr,
                                 TParams paramsStruct,
                                 TTracer apiOrdinal,
-                                TTracerPrologCallbacks prologCallbacks,
-                                TTracerEpilogCallbacks epilogCallbacks,
+                                const TTracerPrologCallbacks &prologCallbacks,
+                                const TTracerEpilogCallbacks &epilogCallbacks,
                                 Args &&...args) {
     ze_result_t ret = ZE_RESULT_SUCCESS;
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksPrologs = &prologCallbacks;
 
-    std::vector<void *> ppTracerInstanceUserData;
-    ppTracerInstanceUserData.resize(callbacksPrologs->size());
+    StackVec<void *, 8> ppTracerInstanceUserData;
+    ppTracerInstanceUserData.resize(std::max(prologCallbacks.size(), epilogCallbacks.size()));
 
-    for (size_t i = 0; i < callbacksPrologs->size(); i++) {
-        if (callbacksPrologs->at(i).current_api_callback != nullptr)
-            callbacksPrologs->at(i).current_api_callback(paramsStruct, ret, callbacksPrologs->at(i).pUserData, &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < prologCallbacks.size(); i++) {
+        auto prologCallback = prologCallbacks[i];
+        if (prologCallback.current_api_callback != nullptr)
+            prologCallback.current_api_callback(paramsStruct, ret, prologCallback.pUserData, &ppTracerInstanceUserData[i]);
     }
     ret = zeApiPtr(args...);
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs = &epilogCallbacks;
-    for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
-        if (callbacksEpilogs->at(i).current_api_callback != nullptr)
-            callbacksEpilogs->at(i).current_api_callback(paramsStruct, ret, callbacksEpilogs->at(i).pUserData, &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < epilogCallbacks.size(); i++) {
+        auto epilogCallback = epilogCallbacks[i];
+        if (epilogCallback.current_api_callback != nullptr)
+            epilogCallback.current_api_callback(paramsStruct, ret, epilogCallback.pUserData, &ppTracerInstanceUserData[i]);
     }
     L0::tracingInProgress = 0;
     L0::pGlobalAPITracerContextImp->releaseActivetracersList();
@@ -399,6 +399,7 @@ DebugSessionImp::Error DebugSessionImp::resumeThreadsWithinDevice(uint32_t devic
     [[maybe_unused]] auto sipCommandResult = writeResumeCommand(resumeThreadIds);
     DEBUG_BREAK_IF(sipCommandResult != true);
 
+    invalidateStateSaveAreaCache();
     auto result = resumeImp(resumeThreadIds, deviceIndex);
 
     // For resume(ALL) and multiple threads to resume - read whole state save area
@@ -895,6 +896,7 @@ void DebugSessionImp::resumeAccidentallyStoppedThreads(const std::vector<EuThrea
         if (threadIdsPerDevice[i].size() > 0) {
             [[maybe_unused]] auto writeSipCommandResult = writeResumeCommand(threadIdsPerDevice[i]);
             DEBUG_BREAK_IF(writeSipCommandResult != true);
+            invalidateStateSaveAreaCache();
             resumeImp(threadIdsPerDevice[i], i);
         }
 
@@ -1095,9 +1097,22 @@ ze_result_t DebugSessionImp::readSbaRegisters(EuThread::ThreadId threadId, uint3
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     NEO::SbaTrackedAddresses sbaBuffer;
-    ret = readSbaBuffer(threadId, sbaBuffer);
-    if (ret != ZE_RESULT_SUCCESS) {
-        return ret;
+    {
+        std::lock_guard<std::mutex> lock(stateSaveAreaCacheMutex);
+        const auto memoryHandle = allThreads[threadId]->getMemoryHandle();
+        auto cachedSbaBuffer = stateSaveAreaCache.sbaBuffers.find(memoryHandle);
+
+        if (stateSaveAreaCache.valid && cachedSbaBuffer != stateSaveAreaCache.sbaBuffers.end()) {
+            sbaBuffer = cachedSbaBuffer->second;
+        } else {
+            ret = readSbaBuffer(threadId, sbaBuffer);
+            if (ret != ZE_RESULT_SUCCESS) {
+                return ret;
+            }
+            if (stateSaveAreaCache.valid) {
+                stateSaveAreaCache.sbaBuffers[memoryHandle] = sbaBuffer;
+            }
+        }
     }
 
     const auto &hwInfo = connectedDevice->getHwInfo();
@@ -1238,17 +1253,62 @@ ze_result_t DebugSessionImp::registersAccessHelper(const EuThread *thread, const
 
     auto threadSlotOffset = calculateThreadSlotOffset(thread->getThreadId());
     auto startRegOffset = threadSlotOffset + calculateRegisterOffsetInThreadSlot(regdesc, start);
+    const size_t accessSize = count * regdesc->bytes;
+
+    // SIP command register is updated by the GPU asynchronously and is never served from the snapshot.
+    auto stateSaveAreaHeader = getStateSaveAreaHeader();
+    const bool isSipCommandRegister = stateSaveAreaHeader != nullptr && regdesc == &stateSaveAreaHeader->regHeader.cmd;
+
+    std::lock_guard<std::mutex> lock(stateSaveAreaCacheMutex);
+    const bool useCache = !isSipCommandRegister &&
+                          stateSaveAreaCache.valid &&
+                          stateSaveAreaCache.memoryHandle == thread->getMemoryHandle() &&
+                          startRegOffset + accessSize <= stateSaveAreaCache.data.size();
 
     int ret = 0;
     if (write) {
-        ret = writeGpuMemory(thread->getMemoryHandle(), static_cast<const char *>(pRegisterValues), count * regdesc->bytes, gpuVa + startRegOffset);
+        ret = writeGpuMemory(thread->getMemoryHandle(), static_cast<const char *>(pRegisterValues), accessSize, gpuVa + startRegOffset);
+        if (ret == 0 && useCache) {
+            memcpy_s(stateSaveAreaCache.data.data() + startRegOffset, accessSize, pRegisterValues, accessSize);
+        }
+    } else if (useCache) {
+        memcpy_s(pRegisterValues, accessSize, stateSaveAreaCache.data.data() + startRegOffset, accessSize);
     } else {
-        ret = readGpuMemory(thread->getMemoryHandle(), static_cast<char *>(pRegisterValues), count * regdesc->bytes, gpuVa + startRegOffset);
+        ret = readGpuMemory(thread->getMemoryHandle(), static_cast<char *>(pRegisterValues), accessSize, gpuVa + startRegOffset);
     }
 
     return ret == 0 ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
 }
 
+ze_result_t DebugSessionImp::updateStateSaveAreaCache(uint64_t memoryHandle) {
+    auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
+    auto stateSaveAreaSize = getContextStateSaveAreaSize(memoryHandle);
+
+    stateSaveAreaCache.valid = false;
+    stateSaveAreaCache.sbaBuffers.clear();
+
+    if (gpuVa == 0 || stateSaveAreaSize == 0) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+
+    // Whole state save area is read at once, buffer capacity is kept across updates.
+    stateSaveAreaCache.data.resize(stateSaveAreaSize);
+    auto result = readGpuMemory(memoryHandle, stateSaveAreaCache.data.data(), stateSaveAreaSize, gpuVa);
+    if (result == ZE_RESULT_SUCCESS) {
+        stateSaveAreaCache.memoryHandle = memoryHandle;
+        stateSaveAreaCache.valid = true;
+    }
+    return result;
+}
+
+void DebugSessionImp::invalidateStateSaveAreaCache() {
+    std::lock_guard<std::mutex> lock(stateSaveAreaCacheMutex);
+    if (stateSaveAreaCache.valid) {
+        stateSaveAreaCache.valid = false;
+        stateSaveAreaCache.sbaBuffers.clear();
+    }
+}
+
 ze_result_t DebugSessionImp::cmdRegisterAccessHelper(const EuThread::ThreadId &threadId, SIP::sip_command &command, bool write) {
     auto stateSaveAreaHeader = getStateSaveAreaHeader();
     auto *regdesc = &stateSaveAreaHeader->regHeader.cmd;
@@ -1260,6 +1320,11 @@ ze_result_t DebugSessionImp::cmdRegisterAccessHelper(const EuThread::ThreadId &t
         PRINT_DEBUGGER_ERROR_LOG("Failed to access CMD for thread %s\n", EuThread::toString(threadId).c_str());
     }
 
+    if (write) {
+        // SIP executes the command and modifies the state save area.
+        invalidateStateSaveAreaCache();
+    }
+
     return result;
 }
 
@@ -19,6 +19,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace SIP {
@@ -114,6 +115,19 @@ struct DebugSessionImp : DebugSession {
     ze_result_t registersAccessHelper(const EuThread *thread, const SIP::regset_desc *regdesc,
                                       uint32_t start, uint32_t count, void *pRegisterValues, bool write);
 
+    // Snapshot of the context state save area taken when attention is raised.
+    // Serves register and SBA reads of stopped threads without reading GPU memory
+    // for each thread. Any resume or SIP command makes the snapshot stale.
+    struct StateSaveAreaCache {
+        std::vector<char> data;
+        std::unordered_map<uint64_t, NEO::SbaTrackedAddresses> sbaBuffers;
+        uint64_t memoryHandle = 0;
+        bool valid = false;
+    };
+
+    ze_result_t updateStateSaveAreaCache(uint64_t memoryHandle); // requires stateSaveAreaCacheMutex
+    void invalidateStateSaveAreaCache();
+
     void slmSipVersionCheck();
     MOCKABLE_VIRTUAL ze_result_t cmdRegisterAccessHelper(const EuThread::ThreadId &threadId, SIP::sip_command &command, bool write);
     MOCKABLE_VIRTUAL ze_result_t waitForCmdReady(EuThread::ThreadId threadId, uint16_t retryCount);
@@ -158,6 +172,8 @@ struct DebugSessionImp : DebugSession {
     std::vector<std::pair<ze_device_thread_t, bool>> pendingInterrupts;
     std::vector<EuThread::ThreadId> newlyStoppedThreads;
     std::vector<char> stateSaveAreaHeader;
+    StateSaveAreaCache stateSaveAreaCache;
+    std::mutex stateSaveAreaCacheMutex;
     SIP::version minSlmSipVersion = {2, 1, 0};
     bool sipSupportsSlm = false;
 
@@ -246,6 +262,7 @@ ze_result_t DebugSessionImp::slmMemoryAccess(EuThread::ThreadId threadId, const
             return status;
         }
 
+        invalidateStateSaveAreaCache();
         status = resumeImp(std::vector<EuThread::ThreadId>{threadId}, threadId.tileIndex);
         if (status != ZE_RESULT_SUCCESS) {
             return status;
@@ -1296,34 +1296,29 @@ void DebugSessionLinux::handleAttentionEvent(prelim_drm_i915_debug_event_eu_atte
         auto gpuVa = getContextStateSaveAreaGpuVa(vmHandle);
         auto stateSaveAreaSize = getContextStateSaveAreaSize(vmHandle);
 
-        std::unique_ptr<char[]> stateSaveArea = nullptr;
-        auto stateSaveReadResult = ZE_RESULT_ERROR_UNKNOWN;
-
-        std::unique_lock<std::mutex> lock;
-
+        // Threads are tracked and their registers read by the session owning them
+        DebugSessionLinux *session = this;
         if (tileSessionsEnabled) {
-            lock = std::unique_lock<std::mutex>(static_cast<TileDebugSessionLinux *>(tileSessions[tileIndex].first)->threadStateMutex);
-        } else {
-            lock = std::unique_lock<std::mutex>(threadStateMutex);
+            session = static_cast<TileDebugSessionLinux *>(tileSessions[tileIndex].first);
         }
 
+        std::unique_lock<std::mutex> lock(session->threadStateMutex);
+        std::lock_guard<std::mutex> cacheLock(session->stateSaveAreaCacheMutex);
+
+        auto stateSaveReadResult = ZE_RESULT_ERROR_UNKNOWN;
         if (gpuVa != 0 && stateSaveAreaSize != 0) {
-            stateSaveArea = std::make_unique<char[]>(stateSaveAreaSize);
-            stateSaveReadResult = readGpuMemory(vmHandle, stateSaveArea.get(), stateSaveAreaSize, gpuVa);
+            // Single read of the whole area, shared by all threads with attention and by later register reads.
+            stateSaveReadResult = session->updateStateSaveAreaCache(vmHandle);
         } else {
             PRINT_DEBUGGER_ERROR_LOG("Context state save area bind info invalid\n", "");
             DEBUG_BREAK_IF(true);
         }
 
         if (stateSaveReadResult == ZE_RESULT_SUCCESS) {
+            const char *stateSaveArea = session->stateSaveAreaCache.data.data();
             for (auto &threadId : threadsWithAttention) {
                 PRINT_DEBUGGER_THREAD_LOG("ATTENTION event for thread: %s\n", EuThread::toString(threadId).c_str());
-
-                if (tileSessionsEnabled) {
-                    static_cast<TileDebugSessionLinux *>(tileSessions[tileIndex].first)->addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveArea.get());
-                } else {
-                    addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveArea.get());
-                }
+                session->addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveArea);
             }
         }
     }
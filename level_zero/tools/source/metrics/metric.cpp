@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -253,6 +253,31 @@ ze_result_t metricGroupGet(zet_device_handle_t hDevice, uint32_t *pCount, zet_me
     return device->getMetricDeviceContext().metricGroupGet(pCount, phMetricGroups);
 }
 
+ze_result_t MetricStreamer::startStreaming(uint8_t *pRingBuffer, size_t ringBufferSize) {
+    if (streamingReader != nullptr) {
+        return ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
+    }
+
+    auto readFunctions = getStreamingReadFunctions();
+    if (readFunctions.empty()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto reader = std::make_unique<MetricStreamingReader>(pRingBuffer, ringBufferSize, std::move(readFunctions));
+    const ze_result_t result = reader->start();
+    if (result == ZE_RESULT_SUCCESS) {
+        streamingReader = std::move(reader);
+    }
+    return result;
+}
+
+void MetricStreamer::stopStreaming() {
+    if (streamingReader != nullptr) {
+        streamingReader->stop();
+        streamingReader.reset();
+    }
+}
+
 ze_result_t metricStreamerOpen(zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup,
                                zet_metric_streamer_desc_t *pDesc, ze_event_handle_t hNotificationEvent,
                                zet_metric_streamer_handle_t *phMetricStreamer) {
@@ -7,11 +7,13 @@
 
 #pragma once
 #include "level_zero/core/source/event/event.h"
+#include "level_zero/tools/source/metrics/metric_streaming_reader.h"
 #include <level_zero/zet_api.h>
 
 #include "metrics_discovery_api.h"
 
 #include <map>
+#include <mutex>
 #include <vector>
 
 struct _zet_metric_group_handle_t {};
@@ -132,6 +134,16 @@ struct MetricStreamer : _zet_metric_streamer_handle_t {
     virtual ze_result_t appendStreamerMarker(CommandList &commandList, uint32_t value) = 0;
     virtual Event::State getNotificationState() = 0;
     inline zet_metric_streamer_handle_t toHandle() { return this; }
+
+    ze_result_t startStreaming(uint8_t *pRingBuffer, size_t ringBufferSize);
+    void stopStreaming();
+    MetricStreamingReader *getStreamingReader() const { return streamingReader.get(); }
+
+  protected:
+    virtual std::vector<MetricStreamingReader::ReadFunction> getStreamingReadFunctions() { return {}; }
+
+    std::unique_ptr<MetricStreamingReader> streamingReader;
+    std::mutex readDataMutex; // Serializes API reads with the streaming reader thread.
 };
 
 struct MetricQueryPool : _zet_metric_query_pool_handle_t {
@@ -69,6 +69,7 @@ ze_result_t IpSamplingMetricGroupImp::streamerOpen(
 }
 
 ze_result_t IpSamplingMetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+    std::lock_guard<std::mutex> lock(readDataMutex);
 
     // Return required size if requested.
     if (*pRawDataSize == 0) {
@@ -87,6 +88,7 @@ ze_result_t IpSamplingMetricStreamerImp::readData(uint32_t maxReportCount, size_
 
 ze_result_t IpSamplingMetricStreamerImp::close() {
 
+    stopStreaming();
     const ze_result_t result = ipSamplingSource.getMetricOsInterface()->stopMeasurement();
     detachEvent();
     ipSamplingSource.pActiveStreamer = nullptr;
@@ -107,6 +109,12 @@ uint32_t IpSamplingMetricStreamerImp::getMaxSupportedReportCount() {
     return ipSamplingSource.getMetricOsInterface()->getRequiredBufferSize(UINT32_MAX) / unitReportSize;
 }
 
+std::vector<MetricStreamingReader::ReadFunction> IpSamplingMetricStreamerImp::getStreamingReadFunctions() {
+    return {[this](uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+        return readData(maxReportCount, pRawDataSize, pRawData);
+    }};
+}
+
 ze_result_t MultiDeviceIpSamplingMetricGroupImp::streamerOpen(
     zet_context_handle_t hContext,
     zet_device_handle_t hDevice,
@@ -140,6 +148,7 @@ ze_result_t MultiDeviceIpSamplingMetricGroupImp::streamerOpen(
 }
 
 ze_result_t MultiDeviceIpSamplingMetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+    std::lock_guard<std::mutex> lock(readDataMutex);
 
     const int32_t totalHeaderSize = static_cast<int32_t>(sizeof(IpSamplingMetricDataHeader) * subDeviceStreamers.size());
     // Find single report size
@@ -204,6 +213,7 @@ ze_result_t MultiDeviceIpSamplingMetricStreamerImp::readData(uint32_t maxReportC
 
 ze_result_t MultiDeviceIpSamplingMetricStreamerImp::close() {
 
+    stopStreaming();
     ze_result_t result = ZE_RESULT_SUCCESS;
     for (auto &streamer : subDeviceStreamers) {
         result = streamer->close();
@@ -231,4 +241,16 @@ Event::State MultiDeviceIpSamplingMetricStreamerImp::getNotificationState() {
     return state;
 }
 
+std::vector<MetricStreamingReader::ReadFunction> MultiDeviceIpSamplingMetricStreamerImp::getStreamingReadFunctions() {
+    // Each sub-device is drained separately, batches are tagged with the sub-device index instead of data headers.
+    std::vector<MetricStreamingReader::ReadFunction> readFunctions;
+    readFunctions.reserve(subDeviceStreamers.size());
+    for (auto &streamer : subDeviceStreamers) {
+        readFunctions.push_back([streamer](uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+            return streamer->readData(maxReportCount, pRawDataSize, pRawData);
+        });
+    }
+    return readFunctions;
+}
+
 } // namespace L0
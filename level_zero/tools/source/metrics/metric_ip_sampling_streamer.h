@@ -33,6 +33,7 @@ struct IpSamplingMetricStreamerImp : public IpSamplingMetricStreamerBase {
     uint32_t getMaxSupportedReportCount();
 
   protected:
+    std::vector<MetricStreamingReader::ReadFunction> getStreamingReadFunctions() override;
     IpSamplingMetricSourceImp &ipSamplingSource;
 };
 
@@ -45,6 +46,7 @@ struct MultiDeviceIpSamplingMetricStreamerImp : public IpSamplingMetricStreamerB
     Event::State getNotificationState() override;
 
   protected:
+    std::vector<MetricStreamingReader::ReadFunction> getStreamingReadFunctions() override;
     std::vector<IpSamplingMetricStreamerImp *> subDeviceStreamers = {};
 };
 
@@ -21,6 +21,7 @@ namespace L0 {
 
 ze_result_t OaMetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawDataSize,
                                           uint8_t *pRawData) {
+    std::lock_guard<std::mutex> lock(readDataMutex);
     ze_result_t result = ZE_RESULT_SUCCESS;
     const size_t metricStreamerSize = metricStreamers.size();
 
@@ -95,6 +96,7 @@ ze_result_t OaMetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawD
 }
 
 ze_result_t OaMetricStreamerImp::close() {
+    stopStreaming();
     ze_result_t result = ZE_RESULT_SUCCESS;
     if (metricStreamers.size() > 0) {
 
@@ -223,6 +225,26 @@ std::vector<zet_metric_streamer_handle_t> &OaMetricStreamerImp::getMetricStreame
     return metricStreamers;
 }
 
+std::vector<MetricStreamingReader::ReadFunction> OaMetricStreamerImp::getStreamingReadFunctions() {
+    std::vector<MetricStreamingReader::ReadFunction> readFunctions;
+
+    if (metricStreamers.size() > 0) {
+        // Sub-device reports are read directly, without MetricGroupCalculateHeader.
+        for (auto metricStreamerHandle : metricStreamers) {
+            auto pMetricStreamer = MetricStreamer::fromHandle(metricStreamerHandle);
+            readFunctions.push_back([pMetricStreamer](uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+                return pMetricStreamer->readData(maxReportCount, pRawDataSize, pRawData);
+            });
+        }
+    } else {
+        readFunctions.push_back([this](uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+            return readData(maxReportCount, pRawDataSize, pRawData);
+        });
+    }
+
+    return readFunctions;
+}
+
 uint32_t OaMetricStreamerImp::getRequiredBufferSize(const uint32_t maxReportCount) const {
     DEBUG_BREAK_IF(rawReportSize == 0);
     uint32_t maxOaBufferReportCount = oaBufferSize / rawReportSize;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@ struct OaMetricStreamerImp : MetricStreamer {
     std::vector<zet_metric_streamer_handle_t> &getMetricStreamers();
 
   protected:
+    std::vector<MetricStreamingReader::ReadFunction> getStreamingReadFunctions() override;
     ze_result_t stopMeasurements();
     uint32_t getOaBufferSize(const uint32_t notifyEveryNReports) const;
     uint32_t getNotifyEveryNReports(const uint32_t oaBufferSize) const;
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/metrics/metric_streaming_reader.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace L0 {
+
+MetricStreamingReader::MetricStreamingReader(uint8_t *pBuffer, size_t bufferSize, std::vector<ReadFunction> readFunctions)
+    : pBuffer(pBuffer), bufferSize(bufferSize) {
+
+    uint32_t maxPendingBatches = defaultMaxPendingBatches;
+    if (NEO::DebugManager.flags.MetricStreamingMaxPendingBatches.get() != -1) {
+        maxPendingBatches = static_cast<uint32_t>(NEO::DebugManager.flags.MetricStreamingMaxPendingBatches.get());
+    }
+    if (NEO::DebugManager.flags.MetricStreamingPollIntervalUs.get() != -1) {
+        pollInterval = std::chrono::microseconds{NEO::DebugManager.flags.MetricStreamingPollIntervalUs.get()};
+    }
+    pendingBatches.resize(std::max(1u, maxPendingBatches));
+
+    size_t minReportSize = bufferSize;
+    sources.reserve(readFunctions.size());
+    for (auto &readFunction : readFunctions) {
+        // Query size of a single report.
+        size_t reportSize = 0;
+        readFunction(1, &reportSize, nullptr);
+        sources.push_back({std::move(readFunction), reportSize});
+        minReportSize = std::min(minReportSize, reportSize);
+    }
+
+    // Unreleased reports never exceed what fits into the ring, so their timestamps are never overwritten.
+    if (minReportSize > 0) {
+        reportTimestamps.resize(bufferSize / minReportSize);
+    }
+}
+
+MetricStreamingReader::~MetricStreamingReader() {
+    stop();
+}
+
+ze_result_t MetricStreamingReader::start() {
+    if (pBuffer == nullptr || sources.empty()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (const auto &source : sources) {
+        if (source.reportSize == 0 || source.reportSize > bufferSize) {
+            return ZE_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (readerThread) {
+        return ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
+    }
+
+    const auto startTimestampNs = getTimestampNs();
+    for (auto &source : sources) {
+        source.lastReadTimestampNs = startTimestampNs;
+    }
+
+    keepReading.store(true);
+    readerThread = NEO::Thread::create(readerThreadFunction, reinterpret_cast<void *>(this));
+    return ZE_RESULT_SUCCESS;
+}
+
+void MetricStreamingReader::stop() {
+    keepReading.store(false);
+    if (readerThread) {
+        readerThread->join();
+        readerThread.reset();
+    }
+}
+
+void *MetricStreamingReader::readerThreadFunction(void *arg) {
+    auto reader = reinterpret_cast<MetricStreamingReader *>(arg);
+
+    while (reader->keepReading.load()) {
+        if (!reader->readAvailableData()) {
+            reader->sleep();
+        }
+    }
+    return nullptr;
+}
+
+bool MetricStreamingReader::readAvailableData() {
+    bool dataRead = false;
+    for (uint32_t setIndex = 0; setIndex < static_cast<uint32_t>(sources.size()); setIndex++) {
+        dataRead |= readFromSource(setIndex);
+    }
+    return dataRead;
+}
+
+bool MetricStreamingReader::readFromSource(uint32_t setIndex) {
+    const auto reportSize = sources[setIndex].reportSize;
+
+    if (batchWriteIndex.load(std::memory_order_relaxed) - batchReadIndex.load(std::memory_order_acquire) >= pendingBatches.size()) {
+        ringFullCount++;
+        return false;
+    }
+
+    uint64_t currentWriteOffset = writeOffset.load(std::memory_order_relaxed);
+    size_t freeSpace = bufferSize - static_cast<size_t>(currentWriteOffset - readOffset.load(std::memory_order_acquire));
+    size_t ringOffset = static_cast<size_t>(currentWriteOffset % bufferSize);
+    size_t contiguousSpace = std::min(freeSpace, bufferSize - ringOffset);
+
+    if (contiguousSpace < reportSize) {
+        // Reports are never split, skip the tail of the ring if the beginning has room.
+        const size_t remainder = bufferSize - ringOffset;
+        if (remainder >= reportSize || freeSpace < remainder + reportSize) {
+            ringFullCount++;
+            return false;
+        }
+        currentWriteOffset += remainder;
+        freeSpace -= remainder;
+        ringOffset = 0;
+        contiguousSpace = std::min(freeSpace, bufferSize);
+    }
+
+    const uint32_t maxReportCount = static_cast<uint32_t>(contiguousSpace / reportSize);
+    size_t rawDataSize = maxReportCount * reportSize;
+    const auto result = sources[setIndex].read(maxReportCount, &rawDataSize, pBuffer + ringOffset);
+    const auto readTimestampNs = getTimestampNs();
+    const auto previousReadTimestampNs = sources[setIndex].lastReadTimestampNs;
+    sources[setIndex].lastReadTimestampNs = readTimestampNs;
+
+    if (result == ZE_RESULT_WARNING_DROPPED_DATA) {
+        droppedDataCount++;
+    } else if (result != ZE_RESULT_SUCCESS) {
+        rawDataSize = 0;
+    }
+
+    DEBUG_BREAK_IF(rawDataSize % reportSize != 0);
+    rawDataSize -= rawDataSize % reportSize;
+
+    if (rawDataSize == 0) {
+        writeOffset.store(currentWriteOffset, std::memory_order_release);
+        return false;
+    }
+
+    const uint32_t readReportCount = static_cast<uint32_t>(rawDataSize / reportSize);
+    const auto firstReportIndex = reportCount.load(std::memory_order_relaxed);
+
+    // Reports were produced between the previous and the current read of this source, spread them evenly over that interval.
+    const auto readIntervalNs = readTimestampNs - std::min(previousReadTimestampNs, readTimestampNs);
+    for (uint32_t i = 0; i < readReportCount; i++) {
+        reportTimestamps[(firstReportIndex + i) % reportTimestamps.size()] = readTimestampNs - readIntervalNs * (readReportCount - 1 - i) / readReportCount;
+    }
+
+    const auto currentBatchIndex = batchWriteIndex.load(std::memory_order_relaxed);
+    auto &batch = pendingBatches[currentBatchIndex % pendingBatches.size()];
+    batch.offset = ringOffset;
+    batch.size = rawDataSize;
+    batch.firstReportIndex = firstReportIndex;
+    batch.reportCount = readReportCount;
+    batch.setIndex = setIndex;
+
+    reportCount.store(firstReportIndex + readReportCount, std::memory_order_release);
+    writeOffset.store(currentWriteOffset + rawDataSize, std::memory_order_release);
+    batchWriteIndex.store(currentBatchIndex + 1, std::memory_order_release);
+    return true;
+}
+
+ze_result_t MetricStreamingReader::getBatches(uint32_t *pCount, MetricStreamedBatch *pBatches) {
+    std::lock_guard<std::mutex> lock(consumerMutex);
+
+    const auto firstBatchIndex = batchReadIndex.load(std::memory_order_relaxed);
+    const auto availableCount = static_cast<uint32_t>(batchWriteIndex.load(std::memory_order_acquire) - firstBatchIndex);
+
+    if (*pCount == 0 || pBatches == nullptr) {
+        *pCount = availableCount;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    *pCount = std::min(*pCount, availableCount);
+    for (uint32_t i = 0; i < *pCount; i++) {
+        pBatches[i] = pendingBatches[(firstBatchIndex + i) % pendingBatches.size()];
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t MetricStreamingReader::releaseBatches(uint32_t count) {
+    std::lock_guard<std::mutex> lock(consumerMutex);
+
+    const auto firstBatchIndex = batchReadIndex.load(std::memory_order_relaxed);
+    const auto availableCount = batchWriteIndex.load(std::memory_order_acquire) - firstBatchIndex;
+    if (count == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+    if (count > availableCount) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Ring space is released up to the end of the last consumed batch, including any skipped tail before it.
+    const auto &lastBatch = pendingBatches[(firstBatchIndex + count - 1) % pendingBatches.size()];
+    const uint64_t currentReadOffset = readOffset.load(std::memory_order_relaxed);
+    const uint64_t lastBatchEnd = lastBatch.offset + lastBatch.size;
+    uint64_t newReadOffset = currentReadOffset - (currentReadOffset % bufferSize) + lastBatchEnd;
+    if (newReadOffset <= currentReadOffset) {
+        newReadOffset += bufferSize;
+    }
+
+    readOffset.store(newReadOffset, std::memory_order_release);
+    batchReadIndex.store(firstBatchIndex + count, std::memory_order_release);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t MetricStreamingReader::getReportTimestamps(const MetricStreamedBatch &batch, uint64_t *pTimestamps) {
+    std::lock_guard<std::mutex> lock(consumerMutex);
+
+    const auto firstBatchIndex = batchReadIndex.load(std::memory_order_relaxed);
+    if (firstBatchIndex == batchWriteIndex.load(std::memory_order_acquire)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Only timestamps of batches which were not released yet are valid.
+    const auto firstPendingReportIndex = pendingBatches[firstBatchIndex % pendingBatches.size()].firstReportIndex;
+    if (batch.firstReportIndex < firstPendingReportIndex || batch.firstReportIndex + batch.reportCount > reportCount.load(std::memory_order_acquire)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (uint32_t i = 0; i < batch.reportCount; i++) {
+        pTimestamps[i] = reportTimestamps[(batch.firstReportIndex + i) % reportTimestamps.size()];
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+void MetricStreamingReader::getStatistics(MetricStreamingStatistics &statistics) const {
+    statistics.batchCount = batchWriteIndex.load();
+    statistics.reportCount = reportCount.load();
+    statistics.ringFullCount = ringFullCount.load();
+    statistics.droppedDataCount = droppedDataCount.load();
+}
+
+void MetricStreamingReader::sleep() {
+    std::this_thread::sleep_for(pollInterval);
+}
+
+uint64_t MetricStreamingReader::getTimestampNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace L0
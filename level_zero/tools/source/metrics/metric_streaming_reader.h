@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <level_zero/ze_api.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace L0 {
+
+struct MetricStreamedBatch {
+    uint64_t offset;           // Byte offset of the batch within the user ring buffer.
+    uint64_t size;             // Batch size in bytes, always a multiple of the report size.
+    uint64_t firstReportIndex; // Sequence number of the first report, used to query report timestamps.
+    uint32_t reportCount;
+    uint32_t setIndex; // Sub-device index for multi-device streamers, 0 otherwise.
+};
+
+struct MetricStreamingStatistics {
+    uint64_t batchCount;
+    uint64_t reportCount;
+    uint64_t ringFullCount;    // Reads skipped since the user did not release enough space.
+    uint64_t droppedDataCount; // Reads reported as overflown by the kernel interface.
+};
+
+// Drains metric reports on a background thread directly into a caller-provided
+// ring buffer. Reports never straddle the end of the ring, so every batch is
+// contiguous and can be consumed in place without additional copies.
+// Single producer (reader thread), single consumer (API caller).
+class MetricStreamingReader {
+  public:
+    using ReadFunction = std::function<ze_result_t(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData)>;
+
+    static constexpr uint32_t defaultMaxPendingBatches = 1024u;
+    static constexpr std::chrono::microseconds defaultPollInterval{100};
+
+    MetricStreamingReader(uint8_t *pBuffer, size_t bufferSize, std::vector<ReadFunction> sources);
+    virtual ~MetricStreamingReader();
+
+    ze_result_t start();
+    void stop();
+
+    bool readAvailableData();
+    ze_result_t getBatches(uint32_t *pCount, MetricStreamedBatch *pBatches);
+    ze_result_t releaseBatches(uint32_t count);
+    ze_result_t getReportTimestamps(const MetricStreamedBatch &batch, uint64_t *pTimestamps);
+    void getStatistics(MetricStreamingStatistics &statistics) const;
+
+  protected:
+    struct Source {
+        ReadFunction read;
+        size_t reportSize = 0;
+        uint64_t lastReadTimestampNs = 0;
+    };
+
+    static void *readerThreadFunction(void *arg);
+    bool readFromSource(uint32_t setIndex);
+
+    MOCKABLE_VIRTUAL void sleep();
+    MOCKABLE_VIRTUAL uint64_t getTimestampNs();
+
+    uint8_t *pBuffer = nullptr;
+    size_t bufferSize = 0;
+    std::vector<Source> sources;
+
+    std::vector<MetricStreamedBatch> pendingBatches;
+    std::vector<uint64_t> reportTimestamps; // Indexed by report sequence number modulo size.
+    std::atomic<uint64_t> batchWriteIndex{0};
+    std::atomic<uint64_t> batchReadIndex{0};
+    std::atomic<uint64_t> writeOffset{0};
+    std::atomic<uint64_t> readOffset{0};
+    std::mutex consumerMutex;
+
+    std::atomic<uint64_t> reportCount{0};
+    std::atomic<uint64_t> ringFullCount{0};
+    std::atomic<uint64_t> droppedDataCount{0};
+
+    std::unique_ptr<NEO::Thread> readerThread;
+    std::atomic_bool keepReading{false};
+    std::chrono::microseconds pollInterval{defaultPollInterval};
+};
+
+} // namespace L0
@@ -251,20 +251,25 @@ struct MockDebugSessionLinux : public L0::DebugSessionLinux {
     using L0::DebugSessionImp::allThreads;
     using L0::DebugSessionImp::apiEvents;
     using L0::DebugSessionImp::attachTile;
+    using L0::DebugSessionImp::cmdRegisterAccessHelper;
     using L0::DebugSessionImp::detachTile;
     using L0::DebugSessionImp::enqueueApiEvent;
     using L0::DebugSessionImp::expectedAttentionEvents;
     using L0::DebugSessionImp::fillResumeAndStoppedThreadsFromNewlyStopped;
     using L0::DebugSessionImp::generateEventsForPendingInterrupts;
     using L0::DebugSessionImp::interruptSent;
+    using L0::DebugSessionImp::invalidateStateSaveAreaCache;
     using L0::DebugSessionImp::isValidGpuAddress;
     using L0::DebugSessionImp::newAttentionRaised;
     using L0::DebugSessionImp::sipSupportsSlm;
+    using L0::DebugSessionImp::stateSaveAreaCache;
+    using L0::DebugSessionImp::stateSaveAreaCacheMutex;
     using L0::DebugSessionImp::stateSaveAreaHeader;
     using L0::DebugSessionImp::tileAttachEnabled;
     using L0::DebugSessionImp::tileSessions;
     using L0::DebugSessionImp::tileSessionsEnabled;
     using L0::DebugSessionImp::triggerEvents;
+    using L0::DebugSessionImp::updateStateSaveAreaCache;
 
     using L0::DebugSessionLinux::asyncThread;
     using L0::DebugSessionLinux::blockOnFenceMode;
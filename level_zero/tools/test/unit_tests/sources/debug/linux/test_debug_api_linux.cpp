@@ -7170,6 +7170,144 @@ TEST_F(DebugApiRegistersAccessTest, givenWriteRegistersCalledCorrectValuesRead)
     EXPECT_EQ(0, memcmp(grf, grfRef, 32));
 }
 
+TEST_F(DebugApiRegistersAccessTest, givenStateSaveAreaCacheUpdatedWhenReadRegistersCalledThenValuesAreReadFromCacheWithoutPread) {
+    SIP::version version = {1, 0, 0};
+    initStateSaveArea(session->stateSaveAreaHeader, version, device);
+    ioctlHandler = new MockIoctlHandler;
+    ioctlHandler->setPreadMemory(session->stateSaveAreaHeader.data(), session->stateSaveAreaHeader.size(), stateSaveAreaGpuVa);
+    session->ioctlHandler.reset(ioctlHandler);
+    session->vmHandle = 7;
+
+    {
+        std::lock_guard<std::mutex> lock(session->stateSaveAreaCacheMutex);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, session->updateStateSaveAreaCache(vmHandle));
+    }
+    EXPECT_TRUE(session->stateSaveAreaCache.valid);
+    EXPECT_EQ(vmHandle, session->stateSaveAreaCache.memoryHandle);
+    EXPECT_EQ(maxDbgSurfaceSize, session->stateSaveAreaCache.data.size());
+
+    auto preadCalledAfterUpdate = ioctlHandler->preadCalled;
+    char grf[32] = {0};
+    char grfRef[32] = {0};
+
+    session->ensureThreadStopped({0, 0, 0, 0});
+    session->ensureThreadStopped({0, 3, 7, 3});
+    for (uint32_t reg = 0; reg < 20; ++reg) {
+        memset(grfRef, 'a' + reg, 32);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugReadRegisters(session->toHandle(), {0, 0, 0, 0}, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, reg, 1, grf));
+        EXPECT_EQ(0, memcmp(grf, grfRef, 32));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugReadRegisters(session->toHandle(), {0, 3, 7, 3}, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, reg, 1, grf));
+        EXPECT_EQ(0, memcmp(grf, grfRef, 32));
+    }
+    EXPECT_EQ(preadCalledAfterUpdate, ioctlHandler->preadCalled);
+}
+
+TEST_F(DebugApiRegistersAccessTest, givenStateSaveAreaCacheUpdatedWhenWriteRegistersCalledThenGpuMemoryAndCacheAreUpdated) {
+    SIP::version version = {1, 0, 0};
+    initStateSaveArea(session->stateSaveAreaHeader, version, device);
+    ioctlHandler = new MockIoctlHandler;
+    ioctlHandler->setPreadMemory(session->stateSaveAreaHeader.data(), session->stateSaveAreaHeader.size(), stateSaveAreaGpuVa);
+    ioctlHandler->setPwriteMemory(session->stateSaveAreaHeader.data(), session->stateSaveAreaHeader.size(), stateSaveAreaGpuVa);
+    session->ioctlHandler.reset(ioctlHandler);
+    session->vmHandle = 7;
+
+    {
+        std::lock_guard<std::mutex> lock(session->stateSaveAreaCacheMutex);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, session->updateStateSaveAreaCache(vmHandle));
+    }
+
+    char grf[32] = {0};
+    char grfRef[32] = {0};
+    memset(grfRef, 'x', 32);
+
+    session->ensureThreadStopped(stoppedThread);
+    auto pwriteCalledBefore = ioctlHandler->pwriteCalled;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugWriteRegisters(session->toHandle(), stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 10, 1, grfRef));
+    EXPECT_LT(pwriteCalledBefore, ioctlHandler->pwriteCalled);
+
+    auto preadCalledBefore = ioctlHandler->preadCalled;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugReadRegisters(session->toHandle(), stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 10, 1, grf));
+    EXPECT_EQ(0, memcmp(grf, grfRef, 32));
+    EXPECT_EQ(preadCalledBefore, ioctlHandler->preadCalled);
+}
+
+TEST_F(DebugApiRegistersAccessTest, givenStateSaveAreaCacheInvalidatedWhenReadRegistersCalledThenGpuMemoryIsRead) {
+    SIP::version version = {1, 0, 0};
+    initStateSaveArea(session->stateSaveAreaHeader, version, device);
+    ioctlHandler = new MockIoctlHandler;
+    ioctlHandler->setPreadMemory(session->stateSaveAreaHeader.data(), session->stateSaveAreaHeader.size(), stateSaveAreaGpuVa);
+    session->ioctlHandler.reset(ioctlHandler);
+    session->vmHandle = 7;
+
+    {
+        std::lock_guard<std::mutex> lock(session->stateSaveAreaCacheMutex);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, session->updateStateSaveAreaCache(vmHandle));
+    }
+
+    session->invalidateStateSaveAreaCache();
+    EXPECT_FALSE(session->stateSaveAreaCache.valid);
+    EXPECT_TRUE(session->stateSaveAreaCache.sbaBuffers.empty());
+
+    char grf[32] = {0};
+    char grfRef[32] = {0};
+    memset(grfRef, 'a' + 5, 32);
+
+    session->ensureThreadStopped(stoppedThread);
+    auto preadCalledBefore = ioctlHandler->preadCalled;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugReadRegisters(session->toHandle(), stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 5, 1, grf));
+    EXPECT_EQ(0, memcmp(grf, grfRef, 32));
+    EXPECT_LT(preadCalledBefore, ioctlHandler->preadCalled);
+}
+
+TEST_F(DebugApiRegistersAccessTest, givenStateSaveAreaCacheUpdatedWhenSipCommandIsReadThenGpuMemoryIsRead) {
+    SIP::version version = {2, 0, 0};
+    initStateSaveArea(session->stateSaveAreaHeader, version, device);
+    ioctlHandler = new MockIoctlHandler;
+    ioctlHandler->setPreadMemory(session->stateSaveAreaHeader.data(), session->stateSaveAreaHeader.size(), stateSaveAreaGpuVa);
+    ioctlHandler->setPwriteMemory(session->stateSaveAreaHeader.data(), session->stateSaveAreaHeader.size(), stateSaveAreaGpuVa);
+    session->ioctlHandler.reset(ioctlHandler);
+
+    {
+        std::lock_guard<std::mutex> lock(session->stateSaveAreaCacheMutex);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, session->updateStateSaveAreaCache(vmHandle));
+    }
+
+    session->ensureThreadStopped(stoppedThread);
+    SIP::sip_command command = {0};
+    auto preadCalledBefore = ioctlHandler->preadCalled;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->cmdRegisterAccessHelper(stoppedThreadId, command, false));
+    EXPECT_LT(preadCalledBefore, ioctlHandler->preadCalled);
+    EXPECT_TRUE(session->stateSaveAreaCache.valid);
+}
+
+TEST_F(DebugApiRegistersAccessTest, givenStateSaveAreaCacheUpdatedWhenSipCommandIsWrittenThenCacheIsInvalidated) {
+    SIP::version version = {2, 0, 0};
+    initStateSaveArea(session->stateSaveAreaHeader, version, device);
+    ioctlHandler = new MockIoctlHandler;
+    ioctlHandler->setPreadMemory(session->stateSaveAreaHeader.data(), session->stateSaveAreaHeader.size(), stateSaveAreaGpuVa);
+    ioctlHandler->setPwriteMemory(session->stateSaveAreaHeader.data(), session->stateSaveAreaHeader.size(), stateSaveAreaGpuVa);
+    session->ioctlHandler.reset(ioctlHandler);
+
+    {
+        std::lock_guard<std::mutex> lock(session->stateSaveAreaCacheMutex);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, session->updateStateSaveAreaCache(vmHandle));
+    }
+
+    session->ensureThreadStopped(stoppedThread);
+    SIP::sip_command command = {0};
+    command.command = static_cast<uint32_t>(NEO::SipKernel::COMMAND::RESUME);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->cmdRegisterAccessHelper(stoppedThreadId, command, true));
+    EXPECT_FALSE(session->stateSaveAreaCache.valid);
+}
+
+TEST_F(DebugApiRegistersAccessTest, givenInvalidStateSaveAreaBindInfoWhenUpdatingStateSaveAreaCacheThenErrorIsReturnedAndCacheIsInvalid) {
+    session->clientHandleToConnection[MockDebugSessionLinux::mockClientHandle]->vmToContextStateSaveAreaBindInfo.clear();
+
+    std::lock_guard<std::mutex> lock(session->stateSaveAreaCacheMutex);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, session->updateStateSaveAreaCache(vmHandle));
+    EXPECT_FALSE(session->stateSaveAreaCache.valid);
+}
+
 TEST_F(DebugApiRegistersAccessTest, givenNoneThreadsStoppedWhenWriteRegistersCalledThenErrorNotAvailableReturned) {
     session->allThreadsStopped = false;
     session->allThreads[stoppedThreadId]->resumeThread();
@@ -0,0 +1,438 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/api/driver_experimental/public/zex_metric.h"
+#include "level_zero/tools/source/metrics/metric_streaming_reader.h"
+#include "level_zero/tools/test/unit_tests/sources/metrics/metric_ip_sampling_fixture.h"
+#include "level_zero/tools/test/unit_tests/sources/metrics/mock_metric_ip_sampling.h"
+#include <level_zero/zet_api.h>
+
+#include <chrono>
+#include <cstring>
+
+namespace L0 {
+namespace ult {
+
+class MockMetricStreamingReader : public MetricStreamingReader {
+  public:
+    using MetricStreamingReader::MetricStreamingReader;
+    using MetricStreamingReader::readOffset;
+    using MetricStreamingReader::sources;
+    using MetricStreamingReader::writeOffset;
+
+    uint64_t getTimestampNs() override {
+        timestampNs += timestampStepNs;
+        return timestampNs;
+    }
+
+    uint64_t timestampNs = 0;
+    uint64_t timestampStepNs = 1;
+};
+
+struct MockMetricReportSource {
+    static constexpr size_t reportSize = 16;
+
+    ze_result_t read(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+        if (*pRawDataSize == 0) {
+            *pRawDataSize = maxReportCount * reportSize;
+            return ZE_RESULT_SUCCESS;
+        }
+        readCalled++;
+        const uint32_t reportCount = std::min(maxReportCount, availableReports);
+        for (uint32_t i = 0; i < reportCount; i++) {
+            memset(pRawData + i * reportSize, static_cast<int>(nextValue++), reportSize);
+        }
+        availableReports -= reportCount;
+        *pRawDataSize = reportCount * reportSize;
+        return readResult;
+    }
+
+    MetricStreamingReader::ReadFunction getReadFunction() {
+        return [this](uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+            return read(maxReportCount, pRawDataSize, pRawData);
+        };
+    }
+
+    ze_result_t readResult = ZE_RESULT_SUCCESS;
+    uint32_t availableReports = 0;
+    uint32_t readCalled = 0;
+    uint8_t nextValue = 1;
+};
+
+TEST(MetricStreamingReaderTest, givenSourceWhenReaderIsCreatedThenReportSizeIsQueried) {
+    MockMetricReportSource source;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 4] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source.getReadFunction()});
+
+    ASSERT_EQ(1u, reader.sources.size());
+    EXPECT_EQ(MockMetricReportSource::reportSize, reader.sources[0].reportSize);
+    EXPECT_EQ(0u, source.readCalled);
+}
+
+TEST(MetricStreamingReaderTest, givenAvailableReportsWhenReadingThenReportsAreWrittenDirectlyToRingBufferAndBatchIsPublished) {
+    MockMetricReportSource source;
+    source.availableReports = 3;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 4] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source.getReadFunction()});
+
+    EXPECT_TRUE(reader.readAvailableData());
+
+    uint32_t batchCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.getBatches(&batchCount, nullptr));
+    EXPECT_EQ(1u, batchCount);
+
+    MetricStreamedBatch batch = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.getBatches(&batchCount, &batch));
+    EXPECT_EQ(0u, batch.offset);
+    EXPECT_EQ(3 * MockMetricReportSource::reportSize, batch.size);
+    EXPECT_EQ(3u, batch.reportCount);
+    EXPECT_EQ(0u, batch.setIndex);
+    EXPECT_EQ(0u, batch.firstReportIndex);
+
+    EXPECT_EQ(1u, ringBuffer[0]);
+    EXPECT_EQ(3u, ringBuffer[2 * MockMetricReportSource::reportSize]);
+    EXPECT_EQ(0u, ringBuffer[3 * MockMetricReportSource::reportSize]);
+
+    MetricStreamingStatistics statistics = {};
+    reader.getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.batchCount);
+    EXPECT_EQ(3u, statistics.reportCount);
+    EXPECT_EQ(0u, statistics.ringFullCount);
+    EXPECT_EQ(0u, statistics.droppedDataCount);
+}
+
+TEST(MetricStreamingReaderTest, givenReportsReadInTwoBatchesWhenGettingReportTimestampsThenEachReportIsStampedWithinItsReadInterval) {
+    MockMetricReportSource source;
+    source.availableReports = 3;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 8] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source.getReadFunction()});
+    reader.timestampStepNs = 300;
+
+    EXPECT_TRUE(reader.readAvailableData());
+    source.availableReports = 2;
+    EXPECT_TRUE(reader.readAvailableData());
+
+    uint32_t batchCount = 2;
+    MetricStreamedBatch batches[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.getBatches(&batchCount, batches));
+    EXPECT_EQ(0u, batches[0].firstReportIndex);
+    EXPECT_EQ(3u, batches[1].firstReportIndex);
+
+    uint64_t timestamps[3] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.getReportTimestamps(batches[0], timestamps));
+    EXPECT_EQ(100u, timestamps[0]);
+    EXPECT_EQ(200u, timestamps[1]);
+    EXPECT_EQ(300u, timestamps[2]);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.getReportTimestamps(batches[1], timestamps));
+    EXPECT_EQ(450u, timestamps[0]);
+    EXPECT_EQ(600u, timestamps[1]);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.releaseBatches(1));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, reader.getReportTimestamps(batches[0], timestamps));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.getReportTimestamps(batches[1], timestamps));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.releaseBatches(1));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, reader.getReportTimestamps(batches[1], timestamps));
+}
+
+TEST(MetricStreamingReaderTest, givenNoAvailableReportsWhenReadingThenNoBatchIsPublished) {
+    MockMetricReportSource source;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 4] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source.getReadFunction()});
+
+    EXPECT_FALSE(reader.readAvailableData());
+    EXPECT_EQ(1u, source.readCalled);
+
+    uint32_t batchCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.getBatches(&batchCount, nullptr));
+    EXPECT_EQ(0u, batchCount);
+}
+
+TEST(MetricStreamingReaderTest, givenFullRingBufferWhenReadingThenSourceIsNotReadAndRingFullCountIsIncremented) {
+    MockMetricReportSource source;
+    source.availableReports = 6;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 4] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source.getReadFunction()});
+
+    EXPECT_TRUE(reader.readAvailableData());
+    EXPECT_EQ(2u, source.availableReports);
+
+    EXPECT_FALSE(reader.readAvailableData());
+    EXPECT_EQ(1u, source.readCalled);
+
+    MetricStreamingStatistics statistics = {};
+    reader.getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.ringFullCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.releaseBatches(1));
+    EXPECT_TRUE(reader.readAvailableData());
+    EXPECT_EQ(0u, source.availableReports);
+}
+
+TEST(MetricStreamingReaderTest, givenRingTailSmallerThanReportWhenReadingThenDataIsWrittenFromRingBeginning) {
+    MockMetricReportSource source;
+    source.availableReports = 2;
+    constexpr size_t ringBufferSize = MockMetricReportSource::reportSize * 3 + MockMetricReportSource::reportSize / 2;
+    uint8_t ringBuffer[ringBufferSize] = {};
+    MockMetricStreamingReader reader(ringBuffer, ringBufferSize, {source.getReadFunction()});
+
+    EXPECT_TRUE(reader.readAvailableData());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.releaseBatches(1));
+
+    source.availableReports = 2;
+    EXPECT_TRUE(reader.readAvailableData());
+
+    uint32_t batchCount = 1;
+    MetricStreamedBatch batch = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.getBatches(&batchCount, &batch));
+    EXPECT_EQ(2 * MockMetricReportSource::reportSize, batch.offset);
+    EXPECT_EQ(1u, batch.reportCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.releaseBatches(1));
+
+    EXPECT_TRUE(reader.readAvailableData());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.getBatches(&batchCount, &batch));
+    EXPECT_EQ(0u, batch.offset);
+    EXPECT_EQ(1u, batch.reportCount);
+    EXPECT_EQ(4u, ringBuffer[0]);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.releaseBatches(1));
+    EXPECT_EQ(reader.writeOffset.load(), reader.readOffset.load());
+}
+
+TEST(MetricStreamingReaderTest, givenDroppedDataWhenReadingThenDroppedDataCountIsIncremented) {
+    MockMetricReportSource source;
+    source.availableReports = 1;
+    source.readResult = ZE_RESULT_WARNING_DROPPED_DATA;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 4] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source.getReadFunction()});
+
+    EXPECT_TRUE(reader.readAvailableData());
+
+    MetricStreamingStatistics statistics = {};
+    reader.getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.droppedDataCount);
+    EXPECT_EQ(1u, statistics.reportCount);
+}
+
+TEST(MetricStreamingReaderTest, givenReadErrorWhenReadingThenNoBatchIsPublished) {
+    MockMetricReportSource source;
+    source.availableReports = 1;
+    source.readResult = ZE_RESULT_ERROR_UNKNOWN;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 4] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source.getReadFunction()});
+
+    EXPECT_FALSE(reader.readAvailableData());
+    EXPECT_EQ(0u, reader.writeOffset.load());
+}
+
+TEST(MetricStreamingReaderTest, givenMultipleSourcesWhenReadingThenBatchesAreTaggedWithSetIndex) {
+    MockMetricReportSource source0, source1;
+    source0.availableReports = 1;
+    source1.availableReports = 2;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 4] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source0.getReadFunction(), source1.getReadFunction()});
+
+    EXPECT_TRUE(reader.readAvailableData());
+
+    uint32_t batchCount = 2;
+    MetricStreamedBatch batches[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.getBatches(&batchCount, batches));
+    EXPECT_EQ(2u, batchCount);
+    EXPECT_EQ(0u, batches[0].setIndex);
+    EXPECT_EQ(1u, batches[0].reportCount);
+    EXPECT_EQ(1u, batches[1].setIndex);
+    EXPECT_EQ(MockMetricReportSource::reportSize, batches[1].offset);
+    EXPECT_EQ(2u, batches[1].reportCount);
+}
+
+TEST(MetricStreamingReaderTest, givenMaxPendingBatchesReachedWhenReadingThenRingFullCountIsIncremented) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.MetricStreamingMaxPendingBatches.set(1);
+
+    MockMetricReportSource source;
+    source.availableReports = 2;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 4] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {[&source](uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+                                         return source.read(1, pRawDataSize, pRawData);
+                                     }});
+
+    EXPECT_TRUE(reader.readAvailableData());
+    EXPECT_FALSE(reader.readAvailableData());
+
+    MetricStreamingStatistics statistics = {};
+    reader.getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.ringFullCount);
+}
+
+TEST(MetricStreamingReaderTest, givenTooManyBatchesWhenReleasingThenErrorIsReturned) {
+    MockMetricReportSource source;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 4] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source.getReadFunction()});
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.releaseBatches(0));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, reader.releaseBatches(1));
+}
+
+TEST(MetricStreamingReaderTest, givenRingBufferSmallerThanReportWhenStartingThenErrorIsReturned) {
+    MockMetricReportSource source;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize / 2] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source.getReadFunction()});
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, reader.start());
+}
+
+TEST(MetricStreamingReaderTest, givenValidRingBufferWhenStartingAndStoppingThenReaderThreadIsJoined) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.MetricStreamingPollIntervalUs.set(0);
+
+    MockMetricReportSource source;
+    uint8_t ringBuffer[MockMetricReportSource::reportSize * 4] = {};
+    MockMetricStreamingReader reader(ringBuffer, sizeof(ringBuffer), {source.getReadFunction()});
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.start());
+    EXPECT_EQ(ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE, reader.start());
+    reader.stop();
+}
+
+using MetricIpSamplingStreamingTest = MetricIpSamplingFixture;
+
+TEST_F(MetricIpSamplingStreamingTest, givenOpenStreamerWhenStreamingIsStartedThenReaderIsCreatedAndStoppedOnClose) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.MetricStreamingPollIntervalUs.set(0);
+
+    for (auto osInterface : osInterfaceVector) {
+        osInterface->isfillDataEnabled = true;
+        osInterface->fillDataSize = 0;
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
+    for (auto device : testDevices) {
+        uint32_t metricGroupCount = 1;
+        zet_metric_group_handle_t metricGroupHandle = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zetMetricGroupGet(device->toHandle(), &metricGroupCount, &metricGroupHandle));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zetContextActivateMetricGroups(context->toHandle(), device, 1, &metricGroupHandle));
+
+        zet_metric_streamer_handle_t streamerHandle = {};
+        zet_metric_streamer_desc_t streamerDesc = {};
+        streamerDesc.stype = ZET_STRUCTURE_TYPE_METRIC_STREAMER_DESC;
+        streamerDesc.notifyEveryNReports = 32768;
+        streamerDesc.samplingPeriod = 1000;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zetMetricStreamerOpen(context->toHandle(), device, metricGroupHandle, &streamerDesc, nullptr, &streamerHandle));
+
+        auto streamer = MetricStreamer::fromHandle(streamerHandle);
+        std::vector<uint8_t> ringBuffer(osInterfaceVector[0]->getUnitReportSizeReturn * 16);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zexMetricStreamerStartStreaming(streamerHandle, ringBuffer.data(), ringBuffer.size()));
+        EXPECT_NE(nullptr, streamer->getStreamingReader());
+        EXPECT_EQ(ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE, zexMetricStreamerStartStreaming(streamerHandle, ringBuffer.data(), ringBuffer.size()));
+
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zetMetricStreamerClose(streamerHandle));
+    }
+}
+
+TEST(MetricStreamingExtensionApiTest, givenNullStreamerHandleWhenCallingStreamingExtensionsThenInvalidNullHandleIsReturned) {
+    uint8_t ringBuffer[64] = {};
+    uint32_t batchCount = 0;
+    zex_metric_streamed_batch_t batch = {};
+    uint64_t timestamp = 0;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexMetricStreamerStartStreaming(nullptr, ringBuffer, sizeof(ringBuffer)));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexMetricStreamerStopStreaming(nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexMetricStreamerGetStreamedBatches(nullptr, &batchCount, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexMetricStreamerGetReportTimestamps(nullptr, &batch, &timestamp));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexMetricStreamerReleaseStreamedBatches(nullptr, 1));
+}
+
+TEST(MetricStreamingExtensionApiTest, givenNullRingBufferWhenStartingStreamingThenInvalidNullPointerIsReturned) {
+    auto streamerHandle = reinterpret_cast<zet_metric_streamer_handle_t>(0x1234);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexMetricStreamerStartStreaming(streamerHandle, nullptr, 64));
+}
+
+TEST(MetricStreamingExtensionApiTest, givenNullCountWhenGettingStreamedBatchesThenInvalidNullPointerIsReturned) {
+    auto streamerHandle = reinterpret_cast<zet_metric_streamer_handle_t>(0x1234);
+    zex_metric_streamed_batch_t batch = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexMetricStreamerGetStreamedBatches(streamerHandle, nullptr, &batch));
+}
+
+TEST(MetricStreamingExtensionApiTest, givenNonZeroCountAndNullBatchesWhenGettingStreamedBatchesThenInvalidNullPointerIsReturned) {
+    auto streamerHandle = reinterpret_cast<zet_metric_streamer_handle_t>(0x1234);
+    uint32_t batchCount = 1;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexMetricStreamerGetStreamedBatches(streamerHandle, &batchCount, nullptr));
+    EXPECT_EQ(1u, batchCount);
+}
+
+TEST(MetricStreamingExtensionApiTest, givenNullBatchOrTimestampsWhenGettingReportTimestampsThenInvalidNullPointerIsReturned) {
+    auto streamerHandle = reinterpret_cast<zet_metric_streamer_handle_t>(0x1234);
+    zex_metric_streamed_batch_t batch = {};
+    uint64_t timestamp = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexMetricStreamerGetReportTimestamps(streamerHandle, nullptr, &timestamp));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexMetricStreamerGetReportTimestamps(streamerHandle, &batch, nullptr));
+}
+
+TEST_F(MetricIpSamplingStreamingTest, givenStreamingStartedThroughExtensionApiWhenReportsAreAvailableThenBatchesAndTimestampsAreReturned) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.MetricStreamingPollIntervalUs.set(0);
+
+    const auto reportSize = osInterfaceVector[0]->getUnitReportSizeReturn;
+    for (auto osInterface : osInterfaceVector) {
+        osInterface->isfillDataEnabled = true;
+        osInterface->fillDataSize = 2 * reportSize;
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
+    auto device = testDevices[1];
+    uint32_t metricGroupCount = 1;
+    zet_metric_group_handle_t metricGroupHandle = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetMetricGroupGet(device->toHandle(), &metricGroupCount, &metricGroupHandle));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetContextActivateMetricGroups(context->toHandle(), device, 1, &metricGroupHandle));
+
+    zet_metric_streamer_handle_t streamerHandle = {};
+    zet_metric_streamer_desc_t streamerDesc = {};
+    streamerDesc.stype = ZET_STRUCTURE_TYPE_METRIC_STREAMER_DESC;
+    streamerDesc.notifyEveryNReports = 32768;
+    streamerDesc.samplingPeriod = 1000;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetMetricStreamerOpen(context->toHandle(), device, metricGroupHandle, &streamerDesc, nullptr, &streamerHandle));
+
+    uint32_t batchCount = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNINITIALIZED, zexMetricStreamerGetStreamedBatches(streamerHandle, &batchCount, nullptr));
+
+    std::vector<uint8_t> ringBuffer(reportSize * 16);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexMetricStreamerStartStreaming(streamerHandle, ringBuffer.data(), ringBuffer.size()));
+
+    const auto waitStart = std::chrono::steady_clock::now();
+    do {
+        batchCount = 0;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zexMetricStreamerGetStreamedBatches(streamerHandle, &batchCount, nullptr));
+    } while (batchCount == 0 && std::chrono::steady_clock::now() - waitStart < std::chrono::seconds(5));
+    ASSERT_NE(0u, batchCount);
+
+    batchCount = 1;
+    zex_metric_streamed_batch_t batch = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexMetricStreamerGetStreamedBatches(streamerHandle, &batchCount, &batch));
+    EXPECT_EQ(1u, batchCount);
+    EXPECT_EQ(2u, batch.reportCount);
+    EXPECT_EQ(2u * reportSize, batch.size);
+    EXPECT_EQ(0u, batch.firstReportIndex);
+    EXPECT_EQ(osInterfaceVector[0]->fillData, ringBuffer[batch.offset]);
+
+    uint64_t timestamps[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexMetricStreamerGetReportTimestamps(streamerHandle, &batch, timestamps));
+    EXPECT_LE(timestamps[0], timestamps[1]);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexMetricStreamerReleaseStreamedBatches(streamerHandle, 1));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexMetricStreamerStopStreaming(streamerHandle));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNINITIALIZED, zexMetricStreamerReleaseStreamedBatches(streamerHandle, 1));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNINITIALIZED, zexMetricStreamerGetReportTimestamps(streamerHandle, &batch, timestamps));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetMetricStreamerClose(streamerHandle));
+}
+
+} // namespace ult
+} // namespace L0
@@ -23,8 +23,11 @@
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/helpers/tiled_image_copy.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/memory_pool.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/utilities/api_intercept.h"
@@ -1005,6 +1008,63 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
     return false;
 }
 
+bool CommandQueue::imageCpuCopyAllowed(Image *image, cl_bool blocking, const size_t *region, GraphicsAllocation *mapAllocation,
+                                       cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    if (blocking == CL_FALSE || mapAllocation != nullptr) {
+        return false;
+    }
+
+    const auto &imageDesc = image->getImageDesc();
+    if (imageDesc.image_type != CL_MEM_OBJECT_IMAGE2D &&
+        imageDesc.image_type != CL_MEM_OBJECT_IMAGE2D_ARRAY &&
+        imageDesc.image_type != CL_MEM_OBJECT_IMAGE3D) {
+        return false;
+    }
+    if (isMipMapped(imageDesc) || imageDesc.num_samples > 1 || image->getPlane() != GMM_NO_PLANE) {
+        return false;
+    }
+
+    const size_t copySize = region[0] * region[1] * region[2] * image->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+    if (!TiledImageCopy::isCpuCopyPreferred(copySize)) {
+        return false;
+    }
+
+    if (Event::checkUserEventDependencies(numEventsInWaitList, eventWaitList)) {
+        return false;
+    }
+
+    ImageTilingMode tilingMode = ImageTilingMode::linear;
+    return TiledImageCopy::isCpuCopySupported(*image->getGraphicsAllocation(device->getRootDeviceIndex()), tilingMode);
+}
+
+bool CommandQueue::writeImageOnCpu(Image *image, const size_t *origin, const size_t *region, size_t inputRowPitch, size_t inputSlicePitch, const void *ptr) {
+    auto allocation = image->getGraphicsAllocation(device->getRootDeviceIndex());
+    ImageTilingMode tilingMode = ImageTilingMode::linear;
+    UNRECOVERABLE_IF(!TiledImageCopy::isCpuCopySupported(*allocation, tilingMode));
+
+    auto memoryManager = device->getMemoryManager();
+    const bool allocationInSystemMemory = MemoryPoolHelper::isSystemMemoryPool(allocation->getMemoryPool());
+    const bool unlockRequired = !allocationInSystemMemory && !allocation->isLocked();
+    void *imageStorage = allocationInSystemMemory ? allocation->getUnderlyingBuffer() : memoryManager->lockResource(allocation);
+    if (imageStorage == nullptr) {
+        return false;
+    }
+
+    const auto &imageDesc = image->getImageDesc();
+    const size_t bytesPerPixel = image->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+    const size_t hostRowPitch = inputRowPitch ? inputRowPitch : region[0] * bytesPerPixel;
+    const size_t hostSlicePitch = inputSlicePitch ? inputSlicePitch : hostRowPitch * region[1];
+
+    TiledImageCopy::copyLinearToTiled(tilingMode, imageStorage, imageDesc.image_row_pitch, imageDesc.image_slice_pitch,
+                                      ptr, hostRowPitch, hostSlicePitch,
+                                      bytesPerPixel, Vec3<size_t>(origin), Vec3<size_t>(region));
+
+    if (unlockRequired) {
+        memoryManager->unlockResource(allocation);
+    }
+    return true;
+}
+
 bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || DebugManager.flags.OmitTimestampPacketDependencies.get();
 }
@@ -389,6 +389,9 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void overrideEngine(aub_stream::EngineType engineType, EngineUsage engineUsage);
     bool bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool imageCpuCopyAllowed(Image *image, cl_bool blocking, const size_t *region, GraphicsAllocation *mapAllocation,
+                             cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool writeImageOnCpu(Image *image, const size_t *origin, const size_t *region, size_t inputRowPitch, size_t inputSlicePitch, const void *ptr);
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
     bool blitEnqueueAllowed(const CsrSelectionArgs &args) const;
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/cpu_memcpy.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/utilities/logger.h"
@@ -135,11 +136,19 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
-            memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            if (transferProperties.lockedPtr) {
+                cpuMemcpyFromLockedMemory(transferProperties.ptr, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            } else {
+                memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            }
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
-            memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            if (transferProperties.lockedPtr) {
+                cpuMemcpyToLockedMemory(transferProperties.getCpuPtrForReadWrite(), transferProperties.ptr, transferProperties.size[0]);
+            } else {
+                memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            }
             eventCompleted = true;
             modifySimulationFlags = true;
             break;
@@ -12,6 +12,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 
 #include "opencl/source/command_queue/command_queue_hw.h"
+#include "opencl/source/event/event.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/helpers/mipmap.h"
 #include "opencl/source/mem_obj/image.h"
@@ -51,6 +52,20 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteImage(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
+    if (imageCpuCopyAllowed(dstImage, blockingWrite, region, mapAllocation, numEventsInWaitList, eventWaitList)) {
+        auto retVal = Event::waitForEvents(numEventsInWaitList, eventWaitList);
+        if (retVal == CL_SUCCESS) {
+            retVal = finish();
+        }
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+        if (writeImageOnCpu(dstImage, origin, region, inputRowPitch, inputSlicePitch, ptr)) {
+            return enqueueMarkerForReadWriteOperation(dstImage, const_cast<void *>(ptr), cmdType, blockingWrite,
+                                                      0, nullptr, event);
+        }
+    }
+
     size_t hostPtrSize = calculateHostPtrSizeForImage(region, inputRowPitch, inputSlicePitch, dstImage);
     void *srcPtr = const_cast<void *>(ptr);
 
@@ -37,6 +37,7 @@
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 #include "shared/source/program/kernel_info.h"
+#include "shared/source/program/print_formatter.h"
 #include "shared/source/utilities/lookup_array.h"
 #include "shared/source/utilities/tag_allocator.h"
 
@@ -351,6 +352,10 @@ cl_int Kernel::initialize() {
         initializeLocalIdsCache();
     }
 
+    if (kernelDescriptor.kernelAttributes.flags.usesPrintf) {
+        printfFormatCache = std::make_unique<PrintfFormatCache>();
+    }
+
     return CL_SUCCESS;
 }
 
@@ -42,6 +42,7 @@ class Surface;
 class PrintfHandler;
 class MultiDeviceKernel;
 class LocalIdsCache;
+class PrintfFormatCache;
 
 class Kernel : public ReferenceTrackedObject<Kernel> {
   public:
@@ -410,6 +411,8 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     size_t getLocalIdsSizeForGroup(const Vec3<uint16_t> &groupSize) const;
     size_t getLocalIdsSizePerThread() const;
 
+    PrintfFormatCache *getPrintfFormatCache() const { return printfFormatCache.get(); }
+
   protected:
     struct KernelConfig {
         Vec3<size_t> gws;
@@ -477,6 +480,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     void initializeLocalIdsCache();
     std::unique_ptr<LocalIdsCache> localIdsCache;
+    std::unique_ptr<PrintfFormatCache> printfFormatCache;
 
     UnifiedMemoryControls unifiedMemoryControls{};
 
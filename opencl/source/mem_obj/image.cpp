@@ -14,6 +14,7 @@
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/cpu_memcpy.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -39,6 +40,7 @@
 
 #include "igfxfmid.h"
 
+#include <algorithm>
 #include <map>
 
 namespace NEO {
@@ -91,6 +93,49 @@ Image::Image(Context *context,
         setSurfaceOffsets(0, 0, 0, 0);
 }
 
+namespace {
+struct ImageTransferRows {
+    void *dst;
+    size_t dstRowPitch;
+    size_t dstSlicePitch;
+    const void *src;
+    size_t srcRowPitch;
+    size_t srcSlicePitch;
+    size_t lineWidth;
+    size_t rowsPerSlice;
+    std::array<size_t, 3> origin;
+    size_t originOffset;
+    bool rowsContiguous;
+    bool slicesContiguous;
+    size_t firstRow;
+    size_t rowCount;
+};
+
+void copyImageRows(const ImageTransferRows &rows) {
+    const size_t endRow = rows.firstRow + rows.rowCount;
+    for (size_t row = rows.firstRow; row < endRow;) {
+        const size_t slice = rows.origin[2] + row / rows.rowsPerSlice;
+        const size_t rowInSlice = row % rows.rowsPerSlice;
+
+        // Adjacent rows without padding are copied with a single memcpy
+        size_t rowsToCopy = 1;
+        if (rows.slicesContiguous) {
+            rowsToCopy = endRow - row;
+        } else if (rows.rowsContiguous) {
+            rowsToCopy = std::min(endRow - row, rows.rowsPerSlice - rowInSlice);
+        }
+
+        const size_t height = rows.origin[1] + rowInSlice;
+        auto srcOffset = ptrOffset(rows.src, rows.srcSlicePitch * slice + rows.srcRowPitch * height + rows.originOffset);
+        auto dstOffset = ptrOffset(rows.dst, rows.dstSlicePitch * slice + rows.dstRowPitch * height + rows.originOffset);
+        const size_t copySize = rows.lineWidth * rowsToCopy;
+        memcpy_s(dstOffset, copySize, srcOffset, copySize);
+
+        row += rowsToCopy;
+    }
+}
+} // namespace
+
 void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
                          void *src, size_t srcRowPitch, size_t srcSlicePitch,
                          std::array<size_t, 3> copyRegion, std::array<size_t, 3> copyOrigin) {
@@ -106,18 +151,38 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
         std::swap(copyRegion[1], copyRegion[2]);
     }
 
-    for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
-        auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice);
-        auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice);
-
-        for (size_t height = copyOrigin[1]; height < (copyOrigin[1] + copyRegion[1]); height++) {
-            auto srcRowOffset = ptrOffset(srcSliceOffset, srcRowPitch * height);
-            auto dstRowOffset = ptrOffset(dstSliceOffset, destRowPitch * height);
-
-            memcpy_s(ptrOffset(dstRowOffset, copyOrigin[0] * pixelSize), lineWidth,
-                     ptrOffset(srcRowOffset, copyOrigin[0] * pixelSize), lineWidth);
-        }
-    }
+    const size_t rowCount = copyRegion[1] * copyRegion[2];
+    if (lineWidth == 0 || rowCount == 0) {
+        return;
+    }
+
+    ImageTransferRows rows = {};
+    rows.dst = dest;
+    rows.dstRowPitch = destRowPitch;
+    rows.dstSlicePitch = destSlicePitch;
+    rows.src = src;
+    rows.srcRowPitch = srcRowPitch;
+    rows.srcSlicePitch = srcSlicePitch;
+    rows.lineWidth = lineWidth;
+    rows.rowsPerSlice = copyRegion[1];
+    rows.origin = copyOrigin;
+    rows.originOffset = copyOrigin[0] * pixelSize;
+    rows.rowsContiguous = copyRegion[1] == 1 || (srcRowPitch == lineWidth && destRowPitch == lineWidth);
+    rows.slicesContiguous = rows.rowsContiguous && (copyRegion[2] == 1 || (srcSlicePitch == lineWidth * copyRegion[1] && destSlicePitch == lineWidth * copyRegion[1]));
+
+    if (DebugManager.flags.EnableParallelImageTransfer.get() != 1) {
+        rows.rowCount = rowCount;
+        copyImageRows(rows);
+        return;
+    }
+
+    // Batches of consecutive rows are copied by multiple threads for large transfers
+    CpuMemcpyHelper::copyInParallel(lineWidth * rowCount, lineWidth, [&rows, lineWidth](size_t offset, size_t size) {
+        auto batch = rows;
+        batch.firstRow = offset / lineWidth;
+        batch.rowCount = size / lineWidth;
+        copyImageRows(batch);
+    });
 }
 
 Image *Image::create(Context *context,
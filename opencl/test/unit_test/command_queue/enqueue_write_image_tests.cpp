@@ -782,3 +782,51 @@ HWTEST_F(EnqueueWriteImageTest, givenMultiRootDeviceImageWhenNonBlockedEnqueueWr
     pCmdQ1->release();
     pImage->release();
 }
+
+HWTEST_F(EnqueueWriteImageTest, givenCpuTiledImageCopyEnabledWhenWritingSmallRegionOfLinearImageThenDataIsWrittenOnCpu) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ForceLinearImages.set(true);
+    DebugManager.flags.EnableCpuTiledImageCopy.set(1);
+
+    std::unique_ptr<Image> image(Image2dHelper<>::create(context));
+    auto allocation = image->getGraphicsAllocation(pClDevice->getRootDeviceIndex());
+    const auto &imageDesc = image->getImageDesc();
+    const size_t bytesPerPixel = image->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+    memset(allocation->getUnderlyingBuffer(), 0, allocation->getUnderlyingBufferSize());
+
+    const size_t origin[] = {2, 3, 0};
+    const size_t region[] = {5, 4, 1};
+    std::vector<uint8_t> hostData(region[0] * region[1] * bytesPerPixel);
+    for (size_t i = 0; i < hostData.size(); i++) {
+        hostData[i] = static_cast<uint8_t>(i + 1);
+    }
+
+    auto retVal = pCmdQ->enqueueWriteImage(image.get(), CL_TRUE, origin, region, 0, 0, hostData.data(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    for (size_t row = 0; row < region[1]; row++) {
+        auto imageRow = ptrOffset(allocation->getUnderlyingBuffer(), (origin[1] + row) * imageDesc.image_row_pitch + origin[0] * bytesPerPixel);
+        EXPECT_EQ(0, memcmp(imageRow, &hostData[row * region[0] * bytesPerPixel], region[0] * bytesPerPixel));
+    }
+}
+
+HWTEST_F(EnqueueWriteImageTest, givenCpuTiledImageCopyEnabledWhenWritingRegionAboveSizeLimitThenDataIsNotWrittenOnCpu) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ForceLinearImages.set(true);
+    DebugManager.flags.EnableCpuTiledImageCopy.set(1);
+    DebugManager.flags.CpuTiledImageCopyMaxSize.set(4);
+
+    std::unique_ptr<Image> image(Image2dHelper<>::create(context));
+    auto allocation = image->getGraphicsAllocation(pClDevice->getRootDeviceIndex());
+    const size_t bytesPerPixel = image->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+    memset(allocation->getUnderlyingBuffer(), 0, allocation->getUnderlyingBufferSize());
+
+    const size_t origin[] = {0, 0, 0};
+    const size_t region[] = {5, 4, 1};
+    std::vector<uint8_t> hostData(region[0] * region[1] * bytesPerPixel, 0xab);
+
+    auto retVal = pCmdQ->enqueueWriteImage(image.get(), CL_TRUE, origin, region, 0, 0, hostData.data(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_NE(0, memcmp(allocation->getUnderlyingBuffer(), hostData.data(), region[0] * bytesPerPixel));
+}
@@ -975,3 +975,23 @@ TEST_F(LocalWorkSizeTest, givenGwsWithSmallXAndBigYWhenLwsIsCalculatedThenDescen
     EXPECT_EQ(workGroupSize[1], 128u);
     EXPECT_EQ(workGroupSize[2], 1u);
 }
+
+TEST(LocalWorkSizeDivisorsTest, givenWorkItemsWhenComputingDivisorsThenAllDivisorsUpToLimitAreReturnedInAscendingOrder) {
+    const size_t workItemsToCheck[] = {0, 1, 2, 7, 12, 97, 256, 360, 1000, 1023, 1024, 4097, 65536, 1920 * 1080, 999983, 2147483647, 4294967296ull};
+    const uint32_t limitsToCheck[] = {1, 2, 16, 255, 511, 1023};
+
+    uint32_t divisors[1024];
+    for (auto workItems : workItemsToCheck) {
+        for (auto limit : limitsToCheck) {
+            std::vector<uint32_t> expectedDivisors;
+            for (uint32_t candidate = 1; candidate <= limit; candidate++) {
+                if (candidate == 1 || workItems % candidate == 0) {
+                    expectedDivisors.push_back(candidate);
+                }
+            }
+
+            auto count = computeDivisors(workItems, limit, divisors);
+            EXPECT_EQ(expectedDivisors, std::vector<uint32_t>(divisors, divisors + count)) << "workItems: " << workItems << " limit: " << limit;
+        }
+    }
+}
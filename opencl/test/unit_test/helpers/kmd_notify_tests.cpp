@@ -526,4 +526,195 @@ TEST_F(KmdNotifyTests, givenDisabledKmdDirectSubmissionNotifyMechanismWhenDirect
     auto params = helper.obtainTimeoutParams(false, 1, 2, flushStampToWait, QueueThrottle::MEDIUM, true, directSubmission);
     EXPECT_TRUE(params.enableTimeout);
     EXPECT_EQ(expectedTimeout, params.waitTimeout);
-}
\ No newline at end of file
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledWhenNotEnoughWaitsWereObservedThenBaseDelayTimeoutIsSelected) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    EXPECT_TRUE(helper.adaptivePolicyEnabled());
+
+    for (uint64_t i = 0; i < KmdNotifyConstants::adaptiveMinimumSampleCount - 1; i++) {
+        helper.recordWaitDuration(3);
+    }
+
+    auto params = helper.obtainTimeoutParams(false, 1, 2, 1, QueueThrottle::MEDIUM, true, false);
+    EXPECT_TRUE(params.enableTimeout);
+    EXPECT_EQ(150, params.waitTimeout);
+
+    KmdNotifyStatistics statistics;
+    helper.getStatistics(statistics);
+    EXPECT_EQ(0u, statistics.adaptiveDecisionCount);
+    EXPECT_EQ(KmdNotifyConstants::adaptiveMinimumSampleCount - 1, statistics.waitDurationHistogram[2]);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledAndShortObservedWaitsWhenParametersAreObtainedThenPollingIsShortenedToObservedWaits) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    for (uint64_t i = 0; i < KmdNotifyConstants::adaptiveMinimumSampleCount; i++) {
+        helper.recordWaitDuration(3);
+    }
+
+    auto params = helper.obtainTimeoutParams(false, 1, 2, 1, QueueThrottle::MEDIUM, true, false);
+    EXPECT_TRUE(params.enableTimeout);
+    EXPECT_EQ(4, params.waitTimeout);
+
+    KmdNotifyStatistics statistics;
+    helper.getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.adaptiveDecisionCount);
+    EXPECT_EQ(1u, statistics.adaptivePollCount);
+    EXPECT_EQ(0u, statistics.adaptiveKmdWaitCount);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledAndObservedWaitsLongerThanBaseDelayWhenParametersAreObtainedThenPollingIsSkipped) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    for (uint64_t i = 0; i < KmdNotifyConstants::adaptiveMinimumSampleCount; i++) {
+        helper.recordWaitDuration(1000);
+    }
+
+    auto params = helper.obtainTimeoutParams(false, 1, 2, 1, QueueThrottle::MEDIUM, true, false);
+    EXPECT_TRUE(params.enableTimeout);
+    EXPECT_EQ(0, params.waitTimeout);
+
+    KmdNotifyStatistics statistics;
+    helper.getStatistics(statistics);
+    EXPECT_EQ(1u, statistics.adaptiveDecisionCount);
+    EXPECT_EQ(0u, statistics.adaptivePollCount);
+    EXPECT_EQ(1u, statistics.adaptiveKmdWaitCount);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledAndObservedWaitsLongerThanBaseDelayWhenManyParametersAreObtainedThenBaseDelayIsPeriodicallyPolled) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    for (uint64_t i = 0; i < KmdNotifyConstants::adaptiveMinimumSampleCount; i++) {
+        helper.recordWaitDuration(1000);
+    }
+
+    for (uint64_t i = 1; i < KmdNotifyConstants::adaptiveProbeInterval; i++) {
+        EXPECT_EQ(0, helper.obtainTimeoutParams(false, 1, 2, 1, QueueThrottle::MEDIUM, true, false).waitTimeout);
+    }
+    EXPECT_EQ(150, helper.obtainTimeoutParams(false, 1, 2, 1, QueueThrottle::MEDIUM, true, false).waitTimeout);
+
+    KmdNotifyStatistics statistics;
+    helper.getStatistics(statistics);
+    EXPECT_EQ(KmdNotifyConstants::adaptiveProbeInterval, statistics.adaptiveDecisionCount);
+    EXPECT_EQ(KmdNotifyConstants::adaptiveProbeInterval - 1, statistics.adaptiveKmdWaitCount);
+    EXPECT_EQ(1u, statistics.adaptiveProbeCount);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyPercentileWhenObservedWaitsAreMixedThenPercentileSelectsBetweenPollingAndKmdWait) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0, false, 0);
+
+    auto recordMixedWaits = [](KmdNotifyHelper &helper) {
+        for (uint32_t i = 0; i < 80; i++) {
+            helper.recordWaitDuration(10);
+        }
+        for (uint32_t i = 0; i < 20; i++) {
+            helper.recordWaitDuration(5000);
+        }
+    };
+
+    MockKmdNotifyHelper defaultHelper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    recordMixedWaits(defaultHelper);
+    EXPECT_EQ(0, defaultHelper.obtainTimeoutParams(false, 1, 2, 1, QueueThrottle::MEDIUM, true, false).waitTimeout);
+
+    DebugManager.flags.AdaptiveKmdNotifyPercentile.set(75);
+    MockKmdNotifyHelper lowLatencyBudgetHelper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    recordMixedWaits(lowLatencyBudgetHelper);
+    EXPECT_EQ(16, lowLatencyBudgetHelper.obtainTimeoutParams(false, 1, 2, 1, QueueThrottle::MEDIUM, true, false).waitTimeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledWhenQuickKmdSleepIsRequestedThenQuickSleepDelayIsNotAdapted) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    overrideKmdNotifyParams(true, 150, true, 20, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    for (uint64_t i = 0; i < KmdNotifyConstants::adaptiveMinimumSampleCount; i++) {
+        helper.recordWaitDuration(1000);
+    }
+
+    auto params = helper.obtainTimeoutParams(true, 1, 2, 1, QueueThrottle::MEDIUM, true, false);
+    EXPECT_EQ(20, params.waitTimeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledWhenManyWaitsAreRecordedThenHistogramIsAged) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    for (uint64_t i = 0; i < KmdNotifyConstants::adaptiveHistogramAgingSampleCount; i++) {
+        helper.recordWaitDuration(0);
+    }
+
+    KmdNotifyStatistics statistics;
+    helper.getStatistics(statistics);
+    EXPECT_EQ(KmdNotifyConstants::adaptiveHistogramAgingSampleCount / 2, statistics.waitDurationHistogram[0]);
+}
+
+HWTEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledWhenWaitUntilCompletionCalledThenWaitDurationIsRecorded) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    createMockCsr<FamilyType>();
+
+    cmdQ->waitUntilComplete(taskCountToWait, {}, flushStampToWait, false);
+
+    KmdNotifyStatistics statistics;
+    mockKmdNotifyHelper->getStatistics(statistics);
+    uint64_t recordedWaits = 0;
+    for (auto bucketCount : statistics.waitDurationHistogram) {
+        recordedWaits += bucketCount;
+    }
+    EXPECT_EQ(1u, recordedWaits);
+}
+
+HWTEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyDisabledWhenWaitUntilCompletionCalledThenWaitDurationIsNotRecorded) {
+    auto csr = createMockCsr<FamilyType>();
+    EXPECT_FALSE(mockKmdNotifyHelper->adaptivePolicyEnabled());
+
+    cmdQ->waitUntilComplete(taskCountToWait, {}, flushStampToWait, false);
+    EXPECT_EQ(1u, csr->waitForCompletionWithTimeoutCalled);
+
+    KmdNotifyStatistics statistics;
+    mockKmdNotifyHelper->getStatistics(statistics);
+    for (auto bucketCount : statistics.waitDurationHistogram) {
+        EXPECT_EQ(0u, bucketCount);
+    }
+}
+
+HWTEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyEnabledWhenPollingIsSkippedAndKmdWaitIsUsedThenWaitDurationIsNotRecorded) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveKmdNotify.set(1);
+    auto csr = createMockCsr<FamilyType>();
+    csr->waitForCompletionWithTimeoutResult = WaitStatus::NotReady;
+
+    for (uint64_t i = 0; i < KmdNotifyConstants::adaptiveMinimumSampleCount; i++) {
+        mockKmdNotifyHelper->recordWaitDuration(1000);
+    }
+
+    cmdQ->waitUntilComplete(taskCountToWait, {}, flushStampToWait, false);
+    EXPECT_EQ(2u, csr->waitForCompletionWithTimeoutCalled);
+    EXPECT_EQ(0, csr->waitForCompletionWithTimeoutParamsPassed[0].timeoutMs);
+    EXPECT_EQ(1u, csr->waitForFlushStampCalled);
+
+    KmdNotifyStatistics statistics;
+    mockKmdNotifyHelper->getStatistics(statistics);
+    uint64_t recordedWaits = 0;
+    for (auto bucketCount : statistics.waitDurationHistogram) {
+        recordedWaits += bucketCount;
+    }
+    EXPECT_EQ(KmdNotifyConstants::adaptiveMinimumSampleCount, recordedWaits);
+}
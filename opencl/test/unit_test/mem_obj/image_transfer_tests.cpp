@@ -11,9 +11,12 @@
 #include "opencl/test/unit_test/fixtures/image_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
+#include "opencl/test/unit_test/mocks/mock_image.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
 class ImageHostPtrTransferTests : public testing::Test {
@@ -190,3 +193,140 @@ TEST_F(ImageHostPtrTransferTests, given1dArrayImageWhenTransferFromHostPtrCalled
 
     EXPECT_TRUE(memcmp(image->getCpuAddress(), expectedImageData.get(), imageSlicePitch * imgDesc->image_array_size) == 0);
 }
+
+TEST_F(ImageHostPtrTransferTests, given3dImageAndParallelTransferEnabledWhenTransferToHostPtrCalledThenCopyRequestedRegionAndOriginOnly) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ForceLinearImages.set(true);
+    DebugManager.flags.EnableParallelImageTransfer.set(1);
+    DebugManager.flags.CpuMemcpyMultiThreadThreshold.set(0);
+    DebugManager.flags.CpuMemcpyMaxThreadCount.set(4);
+
+    createImageAndSetTestParams<Image3dDefaults>();
+
+    std::array<size_t, 3> copyOrigin = {{imgDesc->image_width / 2, imgDesc->image_height / 2, imgDesc->image_depth / 2}};
+    std::array<size_t, 3> copyRegion = copyOrigin;
+
+    std::unique_ptr<uint8_t> expectedHostPtr(new uint8_t[hostPtrSlicePitch * imgDesc->image_depth]);
+    memset(image->getHostPtr(), 0, hostPtrSlicePitch * imgDesc->image_depth);
+    memset(expectedHostPtr.get(), 0, hostPtrSlicePitch * imgDesc->image_depth);
+    memset(image->getCpuAddress(), 123, imageSlicePitch * imgDesc->image_depth);
+
+    setExpectedData(expectedHostPtr.get(), hostPtrSlicePitch, hostPtrRowPitch, copyOrigin, copyRegion);
+
+    image->transferDataToHostPtr(copyRegion, copyOrigin);
+
+    EXPECT_TRUE(memcmp(image->getHostPtr(), expectedHostPtr.get(), hostPtrSlicePitch * imgDesc->image_depth) == 0);
+}
+
+TEST_F(ImageHostPtrTransferTests, given2dArrayImageAndParallelTransferEnabledWhenTransferFromHostPtrCalledThenCopyRequestedRegionAndOriginOnly) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ForceLinearImages.set(true);
+    DebugManager.flags.EnableParallelImageTransfer.set(1);
+    DebugManager.flags.CpuMemcpyMultiThreadThreshold.set(0);
+    DebugManager.flags.CpuMemcpyMaxThreadCount.set(3);
+
+    createImageAndSetTestParams<Image2dArrayDefaults>();
+
+    std::array<size_t, 3> copyOrigin = {{imgDesc->image_width / 2, imgDesc->image_height / 2, imgDesc->image_array_size / 2}};
+    std::array<size_t, 3> copyRegion = copyOrigin;
+
+    std::unique_ptr<uint8_t> expectedImageData(new uint8_t[imageSlicePitch * imgDesc->image_array_size]);
+    memset(image->getHostPtr(), 123, hostPtrSlicePitch * imgDesc->image_array_size);
+    memset(expectedImageData.get(), 0, imageSlicePitch * imgDesc->image_array_size);
+    memset(image->getCpuAddress(), 0, imageSlicePitch * imgDesc->image_array_size);
+
+    setExpectedData(expectedImageData.get(), imageSlicePitch, imageRowPitch, copyOrigin, copyRegion);
+
+    image->transferDataFromHostPtr(copyRegion, copyOrigin);
+
+    EXPECT_TRUE(memcmp(image->getCpuAddress(), expectedImageData.get(), imageSlicePitch * imgDesc->image_array_size) == 0);
+}
+
+struct ImageTransferDataParams {
+    cl_mem_object_type imageType;
+    size_t srcRowPadding;
+    size_t dstRowPadding;
+    size_t slicePadding;
+    bool parallel;
+};
+
+class ImageTransferDataTests : public ::testing::TestWithParam<ImageTransferDataParams> {
+  public:
+    void SetUp() override {
+        params = GetParam();
+        image.imageDesc.image_type = params.imageType;
+        image.surfaceFormatInfo.surfaceFormat.ImageElementSizeInBytes = pixelSize;
+        DebugManager.flags.EnableParallelImageTransfer.set(params.parallel ? 1 : -1);
+        DebugManager.flags.CpuMemcpyMultiThreadThreshold.set(0);
+        DebugManager.flags.CpuMemcpyMaxThreadCount.set(4);
+    }
+
+    DebugManagerStateRestore restorer;
+    ImageTransferDataParams params = {};
+    MockImageBase image;
+    static constexpr size_t pixelSize = 4;
+};
+
+TEST_P(ImageTransferDataTests, givenPitchesAndRegionWhenTransferringDataThenOnlyRequestedRegionIsCopied) {
+    constexpr size_t width = 37;
+    constexpr size_t height = 11;
+    constexpr size_t depth = 5;
+    const size_t lineWidth = width * pixelSize;
+
+    const size_t srcRowPitch = lineWidth + params.srcRowPadding;
+    const size_t dstRowPitch = lineWidth + params.dstRowPadding;
+    const size_t srcSlicePitch = srcRowPitch * height + params.slicePadding;
+    const size_t dstSlicePitch = dstRowPitch * height + params.slicePadding;
+
+    std::vector<uint8_t> src(srcSlicePitch * depth);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<uint8_t>(i * 7 + 1);
+    }
+
+    for (auto startOffset : {0u, 1u}) {
+        // Origin and region in slice order used by transferData after 1D array coordinates are swapped
+        std::array<size_t, 3> origin = {{3 * startOffset, 2 * startOffset, startOffset}};
+        std::array<size_t, 3> region = {{width - origin[0], height - origin[1], depth - origin[2]}};
+        if (params.imageType == CL_MEM_OBJECT_IMAGE1D_ARRAY) {
+            origin[1] = 0;
+            region[1] = 1;
+        }
+        auto copyOrigin = origin;
+        auto copyRegion = region;
+        if (params.imageType == CL_MEM_OBJECT_IMAGE1D_ARRAY) {
+            std::swap(copyOrigin[1], copyOrigin[2]);
+            std::swap(copyRegion[1], copyRegion[2]);
+        }
+
+        std::vector<uint8_t> dst(dstSlicePitch * depth, 0);
+        std::vector<uint8_t> expected(dst.size(), 0);
+        for (size_t slice = origin[2]; slice < origin[2] + region[2]; slice++) {
+            for (size_t row = origin[1]; row < origin[1] + region[1]; row++) {
+                memcpy(&expected[slice * dstSlicePitch + row * dstRowPitch + origin[0] * pixelSize],
+                       &src[slice * srcSlicePitch + row * srcRowPitch + origin[0] * pixelSize],
+                       region[0] * pixelSize);
+            }
+        }
+
+        image.transferData(dst.data(), dstRowPitch, dstSlicePitch, src.data(), srcRowPitch, srcSlicePitch, copyRegion, copyOrigin);
+        EXPECT_EQ(expected, dst);
+    }
+}
+
+ImageTransferDataParams imageTransferDataParams[] = {
+    {CL_MEM_OBJECT_IMAGE3D, 0, 0, 0, false},
+    {CL_MEM_OBJECT_IMAGE3D, 0, 0, 0, true},
+    {CL_MEM_OBJECT_IMAGE3D, 0, 0, 64, false},
+    {CL_MEM_OBJECT_IMAGE3D, 0, 0, 64, true},
+    {CL_MEM_OBJECT_IMAGE3D, 16, 0, 0, false},
+    {CL_MEM_OBJECT_IMAGE3D, 16, 48, 0, true},
+    {CL_MEM_OBJECT_IMAGE2D_ARRAY, 0, 0, 0, true},
+    {CL_MEM_OBJECT_IMAGE2D_ARRAY, 12, 12, 0, false},
+    {CL_MEM_OBJECT_IMAGE1D_ARRAY, 0, 0, 0, false},
+    {CL_MEM_OBJECT_IMAGE1D_ARRAY, 0, 0, 0, true},
+    {CL_MEM_OBJECT_IMAGE1D_ARRAY, 8, 4, 0, true},
+};
+
+INSTANTIATE_TEST_CASE_P(ImageTransferData,
+                        ImageTransferDataTests,
+                        ::testing::ValuesIn(imageTransferDataParams));
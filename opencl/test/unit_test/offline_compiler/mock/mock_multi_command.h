@@ -11,6 +11,7 @@
 
 #include "opencl/test/unit_test/offline_compiler/mock/mock_argument_helper.h"
 
+#include <atomic>
 #include <optional>
 #include <string>
 
@@ -20,6 +21,8 @@ class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
     using MultiCommand::lines;
+    using MultiCommand::outputFile;
+    using MultiCommand::parallelJobs;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
 
@@ -27,6 +30,7 @@ class MockMultiCommand : public MultiCommand {
     using MultiCommand::initialize;
     using MultiCommand::printHelp;
     using MultiCommand::runBuilds;
+    using MultiCommand::runBuildsInParallel;
     using MultiCommand::showResults;
     using MultiCommand::singleBuild;
     using MultiCommand::splitLineInSeparateArgs;
@@ -49,10 +53,28 @@ class MockMultiCommand : public MultiCommand {
         return OclocErrorCode::SUCCESS;
     }
 
+    int compileSingleCommand(const std::vector<std::string> &args, std::string &outputFileName, std::string &buildLog) override {
+        ++compileSingleCommandCalledCount;
+        if (argHelper->getPrinterRef().isSuppressed()) {
+            ++compileSingleCommandWithSuppressedMessagesCount;
+        }
+
+        if (callBaseCompileSingleCommand) {
+            return MultiCommand::compileSingleCommand(args, outputFileName, buildLog);
+        }
+
+        buildLog = "Build log of " + outputFileName;
+        return outputFileName == failingBuildOutputName ? OclocErrorCode::BUILD_PROGRAM_FAILURE : OclocErrorCode::SUCCESS;
+    }
+
     std::map<std::string, std::string> filesMap{};
     std::unique_ptr<MockOclocArgHelper> uniqueHelper{};
     int singleBuildCalledCount{0};
     bool callBaseSingleBuild{true};
+    std::atomic<int> compileSingleCommandCalledCount{0};
+    std::atomic<int> compileSingleCommandWithSuppressedMessagesCount{0};
+    bool callBaseCompileSingleCommand{true};
+    std::string failingBuildOutputName{};
 };
 
 } // namespace NEO
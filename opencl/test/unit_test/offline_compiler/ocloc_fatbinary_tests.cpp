@@ -1399,6 +1399,64 @@ TEST_F(OclocFatBinaryTest, givenFlagsWhichRequireMoreArgsWithoutThemWhenBuilding
     }
 }
 
+TEST_F(OclocFatBinaryTest, givenInvalidParallelJobsValueWhenBuildingFatbinaryThenErrorIsReported) {
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-j",
+        "many",
+        "-device",
+        "*"};
+
+    ::testing::internal::CaptureStdout();
+    const auto result = buildFatBinary(args, &mockArgHelper);
+    const auto output{::testing::internal::GetCapturedStdout()};
+
+    EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, result);
+
+    const std::string expectedErrorMessage{"Invalid number of parallel jobs: many\n"};
+    EXPECT_EQ(expectedErrorMessage, output);
+}
+
+TEST_F(OclocFatBinaryTest, givenParallelJobsFlagWhenBuildingFatbinaryThenFlagIsNotPassedToCompilersAndArchiveHasEntryForEachDevice) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-exclude_ir",
+        "-j",
+        "1",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    const auto buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OclocErrorCode::SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+
+    const auto &rawArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    const auto archiveBytes = ArrayRef<const std::uint8_t>::fromAny(rawArchive.data(), rawArchive.size());
+
+    std::string outErrReason{};
+    std::string outWarning{};
+    const auto decodedArchive = NEO::Ar::decodeAr(archiveBytes, outErrReason, outWarning);
+
+    ASSERT_NE(nullptr, decodedArchive.magic);
+    ASSERT_TRUE(outErrReason.empty());
+    ASSERT_TRUE(outWarning.empty());
+
+    const auto isPadding = [](const auto &file) { return file.fileName.startsWith("pad"); };
+    EXPECT_EQ(2, std::count_if(decodedArchive.files.begin(), decodedArchive.files.end(), [&](const auto &file) { return !isPadding(file); }));
+}
+
 TEST_F(OclocFatBinaryTest, givenBitFlagsWhenBuildingFatbinaryThenFilesInArchiveHaveCorrectPointerSize) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
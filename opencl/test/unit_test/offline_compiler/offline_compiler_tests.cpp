@@ -8,6 +8,7 @@
 #include "offline_compiler_tests.h"
 
 #include "shared/offline_compiler/source/ocloc_api.h"
+#include "shared/offline_compiler/source/utilities/parallel_jobs.h"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/compiler_interface/oclc_extensions.h"
@@ -35,9 +36,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <fstream>
 #include <string>
+#include <thread>
 
 extern Environment *gEnvironment;
 
@@ -390,6 +393,11 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Optional number of builds run in parallel.
+                                0 selects the number of hardware threads.
+                                Build results are reported in the order
+                                of lines in <file_name>.
+
 )===";
 
     EXPECT_EQ(expectedOutput, output);
@@ -523,6 +531,154 @@ TEST(MultiCommandWhiteboxTest, GivenInvalidArgsWhenInitializingThenErrorIsReturn
     EXPECT_NE(std::string::npos, errorPosition);
 }
 
+TEST(MultiCommandWhiteboxTest, GivenParallelJobsArgWhenInitializingThenParallelJobsCountIsSet) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.uniqueHelper->callBaseFileExists = false;
+    mockMultiCommand.uniqueHelper->callBaseReadFileToVectorOfStrings = false;
+    mockMultiCommand.uniqueHelper->shouldReturnEmptyVectorOfStrings = true;
+    mockMultiCommand.filesMap["commands.txt"] = "";
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "multi",
+        "commands.txt",
+        "-j",
+        "3"};
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.initialize(args);
+    testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(3u, mockMultiCommand.parallelJobs);
+}
+
+TEST(MultiCommandWhiteboxTest, GivenInvalidParallelJobsArgWhenInitializingThenErrorIsReturned) {
+    MockMultiCommand mockMultiCommand{};
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "multi",
+        "commands.txt",
+        "-j",
+        "two"};
+
+    ::testing::internal::CaptureStdout();
+    const auto result = mockMultiCommand.initialize(args);
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, result);
+    EXPECT_NE(std::string::npos, output.find("Invalid number of parallel jobs: two\n"));
+}
+
+TEST(MultiCommandWhiteboxTest, GivenParallelJobsWhenRunningBuildsThenEachCommandIsBuiltOnceAndResultsAreReportedInCommandFileOrder) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+    mockMultiCommand.parallelJobs = 4;
+    mockMultiCommand.callBaseCompileSingleCommand = false;
+    mockMultiCommand.failingBuildOutputName = "build_no_3";
+
+    const std::string validLine{"-file test_files/copybuffer.cl -device " + gEnvironment->devicePrefix};
+    for (int i = 0; i < 6; i++) {
+        mockMultiCommand.lines.push_back(validLine);
+    }
+    mockMultiCommand.lines.push_back("-out_dir \"Some Directory");
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.runBuilds("ocloc");
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(6, mockMultiCommand.compileSingleCommandCalledCount.load());
+
+    const std::vector<int> expectedRetValues = {
+        OclocErrorCode::SUCCESS, OclocErrorCode::SUCCESS, OclocErrorCode::BUILD_PROGRAM_FAILURE,
+        OclocErrorCode::SUCCESS, OclocErrorCode::SUCCESS, OclocErrorCode::SUCCESS, OclocErrorCode::INVALID_FILE};
+    EXPECT_EQ(expectedRetValues, mockMultiCommand.retValues);
+
+    size_t previousPosition = 0;
+    for (int i = 1; i <= 6; i++) {
+        const auto commandPosition = output.find("Command number " + std::to_string(i) + ": \nBuild log of build_no_" + std::to_string(i) + "\n");
+        ASSERT_NE(std::string::npos, commandPosition);
+        EXPECT_LE(previousPosition, commandPosition);
+        previousPosition = commandPosition;
+    }
+    EXPECT_NE(std::string::npos, output.find("Build log of build_no_3\nBuild failed with error code: -11\n"));
+
+    std::vector<std::string> outputFileLines;
+    std::string outputFileLine;
+    while (std::getline(mockMultiCommand.outputFile, outputFileLine)) {
+        outputFileLines.push_back(outputFileLine);
+    }
+    ASSERT_EQ(6u, outputFileLines.size());
+    EXPECT_EQ("Unsuccesful build", outputFileLines[2]);
+    EXPECT_TRUE(hasSubstr(outputFileLines[5], "build_no_6"));
+}
+
+TEST(MultiCommandWhiteboxTest, GivenParallelJobsAndCommandWithQqFlagWhenRunningBuildsThenMessagesAreSuppressedBeforeAnyJobStarts) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.parallelJobs = 4;
+    mockMultiCommand.callBaseCompileSingleCommand = false;
+
+    const std::string validLine{"-file test_files/copybuffer.cl -device " + gEnvironment->devicePrefix};
+    for (int i = 0; i < 3; i++) {
+        mockMultiCommand.lines.push_back(validLine);
+    }
+    mockMultiCommand.lines.push_back(validLine + " -qq");
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.runBuilds("ocloc");
+    testing::internal::GetCapturedStdout();
+
+    EXPECT_TRUE(mockMultiCommand.argHelper->getPrinterRef().isSuppressed());
+    EXPECT_EQ(4, mockMultiCommand.compileSingleCommandCalledCount.load());
+    EXPECT_EQ(4, mockMultiCommand.compileSingleCommandWithSuppressedMessagesCount.load());
+}
+
+TEST(OclocParallelJobsTest, GivenValidValueWhenParsingParallelJobsCountThenValueIsReturned) {
+    uint32_t parallelJobs = 0;
+    EXPECT_TRUE(parseParallelJobsCount("8", parallelJobs));
+    EXPECT_EQ(8u, parallelJobs);
+
+    EXPECT_TRUE(parseParallelJobsCount("0", parallelJobs));
+    EXPECT_LE(1u, parallelJobs);
+
+    EXPECT_TRUE(parseParallelJobsCount("100000000000", parallelJobs));
+    EXPECT_EQ(1024u, parallelJobs);
+}
+
+TEST(OclocParallelJobsTest, GivenInvalidValueWhenParsingParallelJobsCountThenFalseIsReturned) {
+    uint32_t parallelJobs = 5;
+    EXPECT_FALSE(parseParallelJobsCount("", parallelJobs));
+    EXPECT_FALSE(parseParallelJobsCount("-1", parallelJobs));
+    EXPECT_FALSE(parseParallelJobsCount("4x", parallelJobs));
+    EXPECT_EQ(5u, parallelJobs);
+}
+
+TEST(OclocParallelJobsTest, GivenMultipleParallelJobsWhenRunningJobsThenEveryJobIsExecutedExactlyOnce) {
+    constexpr size_t jobCount = 100;
+    std::array<std::atomic<int>, jobCount> executionCounts{};
+
+    runParallelJobs(jobCount, 4, [&](size_t jobIndex) {
+        executionCounts[jobIndex]++;
+    });
+
+    for (const auto &count : executionCounts) {
+        EXPECT_EQ(1, count.load());
+    }
+}
+
+TEST(OclocParallelJobsTest, GivenSingleParallelJobWhenRunningJobsThenJobsAreExecutedInOrderOnCallingThread) {
+    std::vector<size_t> executedJobs;
+    const auto callingThreadId = std::this_thread::get_id();
+
+    runParallelJobs(5, 1, [&](size_t jobIndex) {
+        EXPECT_EQ(callingThreadId, std::this_thread::get_id());
+        executedJobs.push_back(jobIndex);
+    });
+
+    const std::vector<size_t> expectedJobs = {0, 1, 2, 3, 4};
+    EXPECT_EQ(expectedJobs, executedJobs);
+}
+
 using MockOfflineCompilerTests = ::testing::Test;
 TEST_F(MockOfflineCompilerTests, givenProductConfigValueAndRevisionIdWhenInitHwInfoThenTheseValuesAreSet) {
     MockOfflineCompiler mockOfflineCompiler;
@@ -956,6 +1112,29 @@ TEST_F(OfflineCompilerTests, givenIncorrectConfigFlagWhenParsingCommandLineThenE
     EXPECT_EQ(expectedErrorMessage, output);
 }
 
+TEST_F(OfflineCompilerTests, givenParallelJobsFlagWhenParsingCommandLineForSingleTargetThenErrorLogIsPrintedAndFailureIsReturned) {
+    const std::vector<std::string> argv = {
+        "ocloc",
+        "compile",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-j",
+        "4"};
+
+    MockOfflineCompiler mockOfflineCompiler{};
+
+    ::testing::internal::CaptureStdout();
+    const auto result = mockOfflineCompiler.parseCommandLine(argv.size(), argv);
+    const auto output{::testing::internal::GetCapturedStdout()};
+
+    EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, result);
+
+    const std::string expectedErrorMessage{"Error: -j is supported only by ocloc multi and by builds for multiple devices.\n"};
+    EXPECT_EQ(expectedErrorMessage, output);
+}
+
 TEST_F(OfflineCompilerTests, Given64BitModeFlagWhenParsingThenInternalOptionsContain64BitModeFlag) {
     const std::array<std::string, 2> flagsToTest = {
         "-64", CompilerOptions::arch64bit.str()};
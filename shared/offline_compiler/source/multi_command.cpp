@@ -9,12 +9,21 @@
 
 #include "shared/offline_compiler/source/ocloc_error_code.h"
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
+#include "shared/offline_compiler/source/utilities/parallel_jobs.h"
 #include "shared/source/utilities/const_stringref.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace NEO {
 int MultiCommand::singleBuild(const std::vector<std::string> &args) {
+    std::string buildLog;
+    int retVal = compileSingleCommand(args, outFileName, buildLog);
+    reportSingleBuild(retVal, buildLog, outFileName);
+    return retVal;
+}
+
+int MultiCommand::compileSingleCommand(const std::vector<std::string> &args, std::string &outputFileName, std::string &buildLog) {
     int retVal = OclocErrorCode::SUCCESS;
 
     if (requestedFatBinary(args, argHelper)) {
@@ -23,14 +32,18 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
         std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
         if (retVal == OclocErrorCode::SUCCESS) {
             retVal = buildWithSafetyGuard(pCompiler.get());
-
-            std::string &buildLog = pCompiler->getBuildLog();
-            if (buildLog.empty() == false) {
-                argHelper->printf("%s\n", buildLog.c_str());
-            }
+            buildLog = pCompiler->getBuildLog();
         }
-        outFileName += ".bin";
+        outputFileName += ".bin";
+    }
+    return retVal;
+}
+
+void MultiCommand::reportSingleBuild(int retVal, const std::string &buildLog, const std::string &outputFileName) {
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
     }
+
     if (retVal == OclocErrorCode::SUCCESS) {
         if (!quiet)
             argHelper->printf("Build succeeded.\n");
@@ -39,13 +52,11 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
     }
 
     if (retVal == OclocErrorCode::SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outputFileName;
     } else {
         outputFile << "Unsuccesful build";
     }
     outputFile << '\n';
-
-    return retVal;
 }
 
 MultiCommand *MultiCommand::create(const std::vector<std::string> &args, int &retVal, OclocArgHelper *helper) {
@@ -105,6 +116,11 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             outputFileList = args[++argIndex];
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            if (!parseParallelJobsCount(args[++argIndex], parallelJobs)) {
+                argHelper->printf("Invalid number of parallel jobs: %s\n", args[argIndex].c_str());
+                return OclocErrorCode::INVALID_COMMAND_LINE;
+            }
         } else {
             argHelper->printf("Invalid option (arg %zu): %s\n", argIndex, currArg.c_str());
             printHelp();
@@ -133,6 +149,11 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
+    if (parallelJobs > 1 && lines.size() > 1) {
+        runBuildsInParallel(argZero);
+        return;
+    }
+
     for (size_t i = 0; i < lines.size(); ++i) {
         std::vector<std::string> args = {argZero};
 
@@ -152,6 +173,57 @@ void MultiCommand::runBuilds(const std::string &argZero) {
     }
 }
 
+void MultiCommand::runBuildsInParallel(const std::string &argZero) {
+    struct BuildCommand {
+        std::vector<std::string> args;
+        std::string outFileName;
+        std::string buildLog;
+        int retVal = OclocErrorCode::SUCCESS;
+        bool valid = false;
+    };
+    std::vector<BuildCommand> buildCommands(lines.size());
+
+    // Command lines are prepared serially, as they update shared output names.
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto &command = buildCommands[i];
+        command.args = {argZero};
+        command.retVal = splitLineInSeparateArgs(command.args, lines[i], i);
+        if (command.retVal != OclocErrorCode::SUCCESS) {
+            continue;
+        }
+        addAdditionalOptionsToSingleCommandLine(command.args, i);
+        command.outFileName = outFileName;
+        command.valid = true;
+    }
+
+    // Printer is shared by all jobs, so quiet mode is applied once before they are started.
+    const auto requestsSuppressedMessages = [](const BuildCommand &command) {
+        return std::find(command.args.begin(), command.args.end(), "-qq") != command.args.end();
+    };
+    if (std::any_of(buildCommands.begin(), buildCommands.end(), requestsSuppressedMessages)) {
+        argHelper->getPrinterRef().setSuppressMessages(true);
+    }
+
+    runParallelJobs(buildCommands.size(), parallelJobs, [&](size_t i) {
+        auto &command = buildCommands[i];
+        if (command.valid) {
+            command.retVal = compileSingleCommand(command.args, command.outFileName, command.buildLog);
+        }
+    });
+
+    // Results are reported in command file order, independently of completion order.
+    for (size_t i = 0; i < buildCommands.size(); ++i) {
+        const auto &command = buildCommands[i];
+        if (command.valid) {
+            if (!quiet) {
+                argHelper->printf("Command number %zu: \n", i + 1);
+            }
+            reportSingleBuild(command.retVal, command.buildLog, command.outFileName);
+        }
+        retValues.push_back(command.retVal);
+    }
+}
+
 void MultiCommand::printHelp() {
     argHelper->printf(R"===(Compiles multiple files using a config file.
 
@@ -167,6 +239,11 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Optional number of builds run in parallel.
+                                0 selects the number of hardware threads.
+                                Build results are reported in the order
+                                of lines in <file_name>.
+
 )===");
 }
 
@@ -39,9 +39,12 @@ class MultiCommand {
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
     MOCKABLE_VIRTUAL int singleBuild(const std::vector<std::string> &args);
+    MOCKABLE_VIRTUAL int compileSingleCommand(const std::vector<std::string> &args, std::string &outputFileName, std::string &buildLog);
+    void reportSingleBuild(int retVal, const std::string &buildLog, const std::string &outputFileName);
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
+    void runBuildsInParallel(const std::string &argZero);
 
     OclocArgHelper *argHelper = nullptr;
     std::vector<int> retValues;
@@ -49,6 +52,7 @@ class MultiCommand {
     std::string outFileName;
     std::string pathToCommandFile;
     std::stringstream outputFile;
+    uint32_t parallelJobs = 1;
     bool quiet = false;
 };
 } // namespace NEO
@@ -15,6 +15,7 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -47,6 +48,7 @@ class OclocArgHelper {
   protected:
     std::vector<Source> inputs, headers;
     std::vector<std::unique_ptr<Output>> outputs;
+    std::mutex outputsMutex;
     uint32_t *numOutputs = nullptr;
     char ***nameOutputs = nullptr;
     uint8_t ***dataOutputs = nullptr;
@@ -58,6 +60,7 @@ class OclocArgHelper {
     bool sourceFileExists(const std::string &filename) const;
 
     inline void addOutput(const std::string &filename, const void *data, const size_t &size) {
+        std::lock_guard<std::mutex> lock(outputsMutex);
         outputs.push_back(std::make_unique<Output>(filename, data, size));
     }
 
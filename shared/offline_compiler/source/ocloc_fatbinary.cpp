@@ -8,6 +8,7 @@
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
 
 #include "shared/offline_compiler/source/ocloc_error_code.h"
+#include "shared/offline_compiler/source/utilities/parallel_jobs.h"
 #include "shared/offline_compiler/source/utilities/safety_caller.h"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
@@ -22,6 +23,7 @@
 #include "igfxfmid.h"
 #include "platforms.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
@@ -245,23 +247,27 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
 
     if (retVal == 0) {
         retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
-        }
+        retVal = appendTargetToFatBinary(retVal, argsCopy, pointerSize, fatbinary, pCompiler, argHelper, product);
     }
-    if (retVal) {
-        return retVal;
+    return retVal;
+}
+
+int appendTargetToFatBinary(int buildRetVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
+    }
+    if (buildRetVal == 0) {
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), buildRetVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
+        return buildRetVal;
     }
 
     std::string productConfig("");
@@ -272,7 +278,50 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
     }
 
     fatbinary.appendFileEntry(pointerSize + "." + productConfig, pCompiler->getPackedDeviceBinaryOutput());
-    return retVal;
+    return buildRetVal;
+}
+
+int buildFatBinaryForTargetsInParallel(const std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::vector<ConstStringRef> &targetProducts,
+                                       uint32_t parallelJobs, std::string pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper) {
+    struct TargetBuild {
+        std::vector<std::string> args;
+        std::unique_ptr<OfflineCompiler> compiler;
+        int createRetVal = OclocErrorCode::SUCCESS;
+        int buildRetVal = OclocErrorCode::SUCCESS;
+    };
+    std::vector<TargetBuild> targetBuilds(targetProducts.size());
+    for (size_t i = 0; i < targetProducts.size(); i++) {
+        targetBuilds[i].args = argsCopy;
+        targetBuilds[i].args[deviceArgIndex] = targetProducts[i].str();
+    }
+
+    // Printer is shared by all jobs, so quiet mode is applied once before they are started.
+    if (std::find(argsCopy.begin(), argsCopy.end(), "-qq") != argsCopy.end()) {
+        argHelper->getPrinterRef().setSuppressMessages(true);
+    }
+
+    runParallelJobs(targetBuilds.size(), parallelJobs, [&](size_t i) {
+        auto &target = targetBuilds[i];
+        target.compiler.reset(OfflineCompiler::create(target.args.size(), target.args, false, target.createRetVal, argHelper));
+        if (target.createRetVal == OclocErrorCode::SUCCESS) {
+            target.buildRetVal = buildWithSafetyGuard(target.compiler.get());
+        }
+    });
+
+    // Entries are appended in target order, so the archive does not depend on completion order.
+    for (size_t i = 0; i < targetBuilds.size(); i++) {
+        auto &target = targetBuilds[i];
+        if (OclocErrorCode::SUCCESS != target.createRetVal) {
+            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+            return target.createRetVal;
+        }
+
+        auto retVal = appendTargetToFatBinary(target.buildRetVal, target.args, pointerSize, fatbinary, target.compiler.get(), argHelper, targetProducts[i].str());
+        if (retVal) {
+            return retVal;
+        }
+    }
+    return OclocErrorCode::SUCCESS;
 }
 
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
@@ -283,11 +332,26 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
     bool spirvInput = false;
     bool excludeIr = false;
+    uint32_t parallelJobs = 1;
+
+    std::vector<std::string> argsCopy;
+    argsCopy.reserve(args.size());
+    for (size_t argIndex = 0; argIndex < args.size(); argIndex++) {
+        // Number of parallel jobs is consumed here and not passed to per-target compilers.
+        if ((argIndex > 0) && (ConstStringRef("-j") == args[argIndex]) && (argIndex + 1 < args.size())) {
+            if (!parseParallelJobsCount(args[argIndex + 1], parallelJobs)) {
+                argHelper->printf("Invalid number of parallel jobs: %s\n", args[argIndex + 1].c_str());
+                return OclocErrorCode::INVALID_COMMAND_LINE;
+            }
+            ++argIndex;
+            continue;
+        }
+        argsCopy.push_back(args[argIndex]);
+    }
 
-    std::vector<std::string> argsCopy(args);
-    for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
-        const auto &currArg = args[argIndex];
-        const bool hasMoreArgs = (argIndex + 1 < args.size());
+    for (size_t argIndex = 1; argIndex < argsCopy.size(); argIndex++) {
+        const auto &currArg = argsCopy[argIndex];
+        const bool hasMoreArgs = (argIndex + 1 < argsCopy.size());
         if ((ConstStringRef("-device") == currArg) && hasMoreArgs) {
             deviceArgIndex = argIndex + 1;
             ++argIndex;
@@ -296,13 +360,13 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         } else if ((CompilerOptions::arch64bit == currArg) || (ConstStringRef("-64") == currArg)) {
             pointerSizeInBits = "64";
         } else if ((ConstStringRef("-file") == currArg) && hasMoreArgs) {
-            inputFileName = args[argIndex + 1];
+            inputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if ((ConstStringRef("-output") == currArg) && hasMoreArgs) {
-            outputFileName = args[argIndex + 1];
+            outputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if ((ConstStringRef("-out_dir") == currArg) && hasMoreArgs) {
-            outputDirectory = args[argIndex + 1];
+            outputDirectory = argsCopy[argIndex + 1];
             ++argIndex;
         } else if (ConstStringRef("-exclude_ir") == currArg) {
             excludeIr = true;
@@ -323,24 +387,31 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
 
     Ar::ArEncoder fatbinary(true);
     std::vector<ConstStringRef> targetProducts;
-    targetProducts = getTargetProductsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
+    targetProducts = getTargetProductsForFatbinary(ConstStringRef(argsCopy[deviceArgIndex]), argHelper);
     if (targetProducts.empty()) {
-        argHelper->printf("Failed to parse target devices from : %s\n", args[deviceArgIndex].c_str());
+        argHelper->printf("Failed to parse target devices from : %s\n", argsCopy[deviceArgIndex].c_str());
         return 1;
     }
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
-
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OclocErrorCode::SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+    if (parallelJobs > 1 && targetProducts.size() > 1) {
+        auto retVal = buildFatBinaryForTargetsInParallel(argsCopy, deviceArgIndex, targetProducts, parallelJobs, pointerSizeInBits, fatbinary, argHelper);
+        if (retVal) {
             return retVal;
         }
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OclocErrorCode::SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
 
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
-        if (retVal) {
-            return retVal;
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+            if (retVal) {
+                return retVal;
+            }
         }
     }
 
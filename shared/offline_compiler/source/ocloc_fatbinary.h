@@ -37,6 +37,10 @@ void getProductsForRange(unsigned int productFrom, unsigned int productTo, std::
 std::vector<ConstStringRef> getTargetProductsForFatbinary(ConstStringRef deviceArg, OclocArgHelper *argHelper);
 int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
                             OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &deviceConfig);
+int appendTargetToFatBinary(int buildRetVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &deviceConfig);
+int buildFatBinaryForTargetsInParallel(const std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::vector<ConstStringRef> &targetProducts,
+                                       uint32_t parallelJobs, std::string pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper);
 int appendGenericIr(Ar::ArEncoder &fatbinary, const std::string &inputFile, OclocArgHelper *argHelper);
 std::vector<uint8_t> createEncodedElfWithSpirv(const ArrayRef<const uint8_t> &spirv);
 
@@ -716,7 +716,10 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
         } else if ("-q" == currArg) {
             quiet = true;
         } else if ("-qq" == currArg) {
-            argHelper->getPrinterRef().setSuppressMessages(true);
+            // Parallel builds suppress messages before dispatching jobs, so the shared printer is only written here when it is not set yet.
+            if (!argHelper->getPrinterRef().isSuppressed()) {
+                argHelper->getPrinterRef().setSuppressMessages(true);
+            }
             quiet = true;
         } else if ("-spv_only" == currArg) {
             onlySpirV = true;
@@ -743,6 +746,10 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
             argIndex++;
         } else if ("-allow_caching" == currArg) {
             allowCaching = true;
+        } else if ("-j" == currArg) {
+            argHelper->printf("Error: -j is supported only by ocloc multi and by builds for multiple devices.\n");
+            retVal = INVALID_COMMAND_LINE;
+            break;
         } else {
             argHelper->printf("Invalid option (arg %d): %s\n", argIndex, argv[argIndex].c_str());
             retVal = INVALID_COMMAND_LINE;
@@ -1016,6 +1023,13 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
   -config                       Target hardware info config for a single device,
                                 e.g 1x4x8.
 
+  -j <jobs>                     Number of targets compiled in parallel when
+                                multiple target devices are provided.
+                                0 selects the number of hardware threads.
+                                Fatbinary content does not depend on
+                                this value. Not allowed for a single
+                                target device.
+
 Examples :
   Compile file to Intel Compute GPU device binary (out = source_file_Gen9core.bin)
     ocloc -file source_file.cl -device skl
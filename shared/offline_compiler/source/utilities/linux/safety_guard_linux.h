@@ -14,7 +14,8 @@
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
+// Builds may run on several threads, signals raised by a crash are delivered to the faulting thread.
+static thread_local jmp_buf jmpbuf;
 
 class SafetyGuardLinux {
   public:
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/offline_compiler/source/utilities/parallel_jobs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+bool parseParallelJobsCount(const std::string &value, uint32_t &parallelJobs) {
+    if (value.empty() || !std::all_of(value.begin(), value.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+        return false;
+    }
+
+    constexpr uint32_t maxParallelJobs = 1024u;
+    parallelJobs = 0;
+    for (auto c : value) {
+        parallelJobs = std::min(parallelJobs * 10 + static_cast<uint32_t>(c - '0'), maxParallelJobs);
+    }
+    if (parallelJobs == 0) {
+        parallelJobs = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return true;
+}
+
+void runParallelJobs(size_t jobCount, uint32_t maxParallelJobs, const std::function<void(size_t)> &job) {
+    const auto workersCount = std::min(static_cast<size_t>(maxParallelJobs), jobCount);
+    if (workersCount <= 1) {
+        for (size_t jobIndex = 0; jobIndex < jobCount; jobIndex++) {
+            job(jobIndex);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextJobIndex{0};
+    auto worker = [&]() {
+        for (auto jobIndex = nextJobIndex++; jobIndex < jobCount; jobIndex = nextJobIndex++) {
+            job(jobIndex);
+        }
+    };
+
+    // Calling thread takes part in processing as well.
+    std::vector<std::thread> workers;
+    workers.reserve(workersCount - 1);
+    for (size_t i = 0; i < workersCount - 1; i++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+
+    for (auto &workerThread : workers) {
+        workerThread.join();
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace NEO {
+
+// Parses value of "-j" option, 0 selects number of hardware threads.
+// Returns false for values that are not a non-negative number.
+bool parseParallelJobsCount(const std::string &value, uint32_t &parallelJobs);
+
+// Executes job for every index in [0, jobCount) on up to maxParallelJobs threads.
+// Jobs are picked in index order, callers keep per-index results so that
+// reporting does not depend on which job finished first.
+void runParallelJobs(size_t jobCount, uint32_t maxParallelJobs, const std::function<void(size_t)> &job);
+
+} // namespace NEO
@@ -8,13 +8,20 @@
 #pragma once
 #include "shared/source/aub_mem_dump/aub_data.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class AubHelper;
-}
+class Thread;
+} // namespace NEO
 
 namespace AubMemDump {
 #include "aub_services.h"
@@ -120,6 +127,10 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    static constexpr size_t defaultWriteBufferSize = 16 * 1024 * 1024;
+    static constexpr size_t maxPendingWriteBuffers = 4;
+
+    ~AubFileStream() override;
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -139,10 +150,39 @@ struct AubFileStream : public AubStream {
                                        uint32_t addressSpace, uint32_t compareOperation);
     MOCKABLE_VIRTUAL bool addComment(const char *message);
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
+    MOCKABLE_VIRTUAL bool isPageWriteRedundant(uint64_t physAddress, uint64_t gpuAddress, const void *memory, size_t size, uint64_t entryBits);
 
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+
+  protected:
+    static void *writerThreadFunction(void *arg);
+    void startWriterThread();
+    void stopWriterThread();
+    void submitWriteBuffer();
+    void waitForPendingWrites();
+    void printStatistics() const;
+
+    // Background writer, active when AubDumpAsyncWrite is enabled.
+    std::unique_ptr<NEO::Thread> writerThread;
+    std::mutex writerMutex;
+    std::condition_variable writerCondition;
+    std::vector<char> writeBuffer;
+    std::deque<std::vector<char>> pendingWriteBuffers;
+    std::vector<std::vector<char>> freeWriteBuffers;
+    size_t writeBufferSize = defaultWriteBufferSize;
+    bool writeInProgress = false;
+    bool keepWriting = false;
+
+    // Content hashes of dumped pages, keyed by physical address.
+    std::unordered_map<uint64_t, uint64_t> pageHashes;
+    bool skipUnchangedPages = false;
+
+    uint64_t bytesWritten = 0;
+    uint64_t bytesSkipped = 0;
+    std::atomic<uint64_t> fileWriteTimeNs{0};
+    bool collectStatistics = false;
 };
 
 template <int addressingBits>
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -122,8 +122,11 @@ void AubDump<Traits>::reserveAddressGGTTAndWriteMmeory(typename Traits::Stream &
                                                        uint64_t additionalBits, const NEO::AubHelper &aubHelper) {
     auto vmAddr = (gfxAddress + offset) & ~(MemoryConstants::pageSize - 1);
     auto pAddr = physAddress & ~(MemoryConstants::pageSize - 1);
+    // Physically contiguous runs spanning several pages are mapped with a single reservation.
+    auto vmEnd = (gfxAddress + offset + size + MemoryConstants::pageSize - 1) & ~(MemoryConstants::pageSize - 1);
+    auto blockSize = std::max(static_cast<size_t>(vmEnd - vmAddr), static_cast<size_t>(MemoryConstants::pageSize));
 
-    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, MemoryConstants::pageSize, pAddr, additionalBits, aubHelper);
+    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, blockSize, pAddr, additionalBits, aubHelper);
 
     int hint = NEO::AubHelper::getMemTrace(additionalBits);
 
@@ -177,6 +177,7 @@ void CommandContainer::reset() {
     getResidencyContainer().clear();
     getDeallocationContainer().clear();
     sshAllocations.clear();
+    dispatchKernelTemplateCache.clear();
 
     this->handleCmdBufferAllocations(1u);
     cmdBufferAllocations.erase(cmdBufferAllocations.begin() + 1, cmdBufferAllocations.end());
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/command_container/dispatch_kernel_template_cache.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/heap_base_address_model.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
@@ -188,6 +189,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
     uint32_t &nextIddInBlockRef() { return nextIddInBlock; }
     HeapContainer &getSshAllocations() { return sshAllocations; }
     uint64_t &currentLinearStreamStartOffsetRef() { return currentLinearStreamStartOffset; }
+    DispatchKernelTemplateCache &getDispatchKernelTemplateCache() { return dispatchKernelTemplateCache; }
 
     void setUsingPrimaryBuffer(bool value) {
         usingPrimaryBuffer = value;
@@ -221,6 +223,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
     ResidencyContainer residencyContainer;
     std::vector<GraphicsAllocation *> deallocationContainer;
     HeapContainer sshAllocations;
+    DispatchKernelTemplateCache dispatchKernelTemplateCache;
 
     HeapReserveData dynamicStateHeapReserveData;
     HeapReserveData surfaceStateHeapReserveData;
@@ -74,28 +74,80 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
     WALKER_TYPE cmd = Family::cmdInitGpgpuWalker;
     auto idd = Family::cmdInitInterfaceDescriptorData;
-    {
-        auto alloc = args.dispatchInterface->getIsaAllocation();
-        UNRECOVERABLE_IF(nullptr == alloc);
-        auto offset = alloc->getGpuAddressToPatch();
-        idd.setKernelStartPointer(offset);
-        idd.setKernelStartPointerHigh(0u);
+
+    uint32_t bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
+    bool isBindlessKernel = kernelDescriptor.kernelAttributes.bufferAddressingMode == KernelDescriptor::BindlessAndStateless;
+
+    // Template holds walker followed by interface descriptor
+    constexpr size_t dispatchTemplateSize = sizeof(cmd) + sizeof(idd);
+    bool useDispatchTemplate = DebugManager.flags.EnableDispatchKernelTemplates.get() == 1;
+    DispatchKernelTemplateKey dispatchTemplateKey;
+    const void *dispatchTemplate = nullptr;
+    if (useDispatchTemplate) {
+        dispatchTemplateKey = DispatchKernelTemplateKey::create(args);
+        dispatchTemplate = container.getDispatchKernelTemplateCache().find(dispatchTemplateKey, dispatchTemplateSize);
     }
 
-    auto numThreadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
-    idd.setNumberOfThreadsInGpgpuThreadGroup(numThreadsPerThreadGroup);
-    idd.setDenormMode(INTERFACE_DESCRIPTOR_DATA::DENORM_MODE_SETBYKERNEL);
+    if (dispatchTemplate) {
+        memcpy_s(&cmd, sizeof(cmd), dispatchTemplate, sizeof(cmd));
+        memcpy_s(&idd, sizeof(idd), ptrOffset(dispatchTemplate, sizeof(cmd)), sizeof(idd));
+        if (!args.isIndirect) {
+            cmd.setThreadGroupIdXDimension(threadDims[0]);
+            cmd.setThreadGroupIdYDimension(threadDims[1]);
+            cmd.setThreadGroupIdZDimension(threadDims[2]);
+        }
+    } else {
+        {
+            auto alloc = args.dispatchInterface->getIsaAllocation();
+            UNRECOVERABLE_IF(nullptr == alloc);
+            auto offset = alloc->getGpuAddressToPatch();
+            idd.setKernelStartPointer(offset);
+            idd.setKernelStartPointerHigh(0u);
+        }
 
-    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
-                                                       kernelDescriptor.kernelAttributes.barrierCount,
-                                                       hwInfo);
-    auto slmSize = static_cast<typename INTERFACE_DESCRIPTOR_DATA::SHARED_LOCAL_MEMORY_SIZE>(
-        gfxCoreHelper.computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize()));
-    idd.setSharedLocalMemorySize(slmSize);
+        auto numThreadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
+        idd.setNumberOfThreadsInGpgpuThreadGroup(numThreadsPerThreadGroup);
+        idd.setDenormMode(INTERFACE_DESCRIPTOR_DATA::DENORM_MODE_SETBYKERNEL);
+
+        EncodeDispatchKernel<Family>::programBarrierEnable(idd,
+                                                           kernelDescriptor.kernelAttributes.barrierCount,
+                                                           hwInfo);
+        auto slmSize = static_cast<typename INTERFACE_DESCRIPTOR_DATA::SHARED_LOCAL_MEMORY_SIZE>(
+            gfxCoreHelper.computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize()));
+        idd.setSharedLocalMemorySize(slmSize);
+
+        PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, args.preemptionMode);
+
+        if (!isBindlessKernel) {
+            EncodeDispatchKernel<Family>::adjustBindingTablePrefetch(idd, kernelDescriptor.payloadMappings.samplerTable.numSamplers, bindingTableStateCount);
+        }
+
+        EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
+                                                 sizePerThreadData, hwInfo);
+
+        EncodeDispatchKernel<Family>::encodeThreadData(cmd,
+                                                       nullptr,
+                                                       threadDims,
+                                                       args.dispatchInterface->getGroupSize(),
+                                                       kernelDescriptor.kernelAttributes.simdSize,
+                                                       kernelDescriptor.kernelAttributes.numLocalIdChannels,
+                                                       numThreadsPerThreadGroup,
+                                                       args.dispatchInterface->getThreadExecutionMask(),
+                                                       true,
+                                                       false,
+                                                       args.isIndirect,
+                                                       args.dispatchInterface->getRequiredWorkgroupOrder(),
+                                                       rootDeviceEnvironment);
+
+        if (useDispatchTemplate) {
+            uint8_t templateData[dispatchTemplateSize];
+            memcpy_s(templateData, sizeof(cmd), &cmd, sizeof(cmd));
+            memcpy_s(ptrOffset(templateData, sizeof(cmd)), sizeof(idd), &idd, sizeof(idd));
+            container.getDispatchKernelTemplateCache().store(dispatchTemplateKey, templateData, dispatchTemplateSize);
+        }
+    }
 
-    uint32_t bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
     uint32_t bindingTablePointer = 0u;
-    bool isBindlessKernel = kernelDescriptor.kernelAttributes.bufferAddressingMode == KernelDescriptor::BindlessAndStateless;
     if (!isBindlessKernel) {
         container.prepareBindfulSsh();
         if (bindingTableStateCount > 0u) {
@@ -112,10 +164,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     }
     idd.setBindingTablePointer(bindingTablePointer);
 
-    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, args.preemptionMode);
-
     uint32_t samplerStateOffset = 0;
-    uint32_t samplerCount = 0;
 
     if (kernelDescriptor.payloadMappings.samplerTable.numSamplers > 0) {
         auto dsHeap = args.dynamicStateHeap;
@@ -132,7 +181,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
         UNRECOVERABLE_IF(!dsHeap);
 
-        samplerCount = kernelDescriptor.payloadMappings.samplerTable.numSamplers;
         samplerStateOffset = EncodeStates<Family>::copySamplerState(dsHeap, kernelDescriptor.payloadMappings.samplerTable.tableOffset,
                                                                     kernelDescriptor.payloadMappings.samplerTable.numSamplers,
                                                                     kernelDescriptor.payloadMappings.samplerTable.borderColor,
@@ -141,12 +189,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     }
 
     idd.setSamplerStatePointer(samplerStateOffset);
-    if (!isBindlessKernel) {
-        EncodeDispatchKernel<Family>::adjustBindingTablePrefetch(idd, samplerCount, bindingTableStateCount);
-    }
-
-    EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
-                                             sizePerThreadData, hwInfo);
 
     uint32_t sizeThreadData = sizePerThreadDataForWholeGroup + sizeCrossThreadData;
     uint32_t sizeForImplicitArgsPatching = NEO::ImplicitArgsHelper::getSizeForImplicitArgsPatching(pImplicitArgs, kernelDescriptor);
@@ -239,20 +281,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     cmd.setIndirectDataLength(sizeThreadData);
     cmd.setInterfaceDescriptorOffset(numIDD);
 
-    EncodeDispatchKernel<Family>::encodeThreadData(cmd,
-                                                   nullptr,
-                                                   threadDims,
-                                                   args.dispatchInterface->getGroupSize(),
-                                                   kernelDescriptor.kernelAttributes.simdSize,
-                                                   kernelDescriptor.kernelAttributes.numLocalIdChannels,
-                                                   args.dispatchInterface->getNumThreadsPerThreadGroup(),
-                                                   args.dispatchInterface->getThreadExecutionMask(),
-                                                   true,
-                                                   false,
-                                                   args.isIndirect,
-                                                   args.dispatchInterface->getRequiredWorkgroupOrder(),
-                                                   rootDeviceEnvironment);
-
     cmd.setPredicateEnable(args.isPredicate);
 
     if (ApiSpecificConfig::getBindlessConfiguration()) {
@@ -74,43 +74,92 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     WALKER_TYPE walkerCmd = Family::cmdInitGpgpuWalker;
     auto &idd = walkerCmd.getInterfaceDescriptor();
 
-    EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
-                                             sizePerThreadData, hwInfo);
-    auto &productHelper = args.device->getProductHelper();
-    productHelper.updateIddCommand(&idd, kernelDescriptor.kernelAttributes.numGrfRequired,
-                                   kernelDescriptor.kernelAttributes.threadArbitrationPolicy);
-
     bool localIdsGenerationByRuntime = args.dispatchInterface->requiresGenerationOfLocalIdsByRuntime();
     auto requiredWorkgroupOrder = args.dispatchInterface->getRequiredWorkgroupOrder();
-    bool inlineDataProgramming = EncodeDispatchKernel<Family>::inlineDataProgrammingRequired(kernelDescriptor);
-    {
-        auto alloc = args.dispatchInterface->getIsaAllocation();
-        UNRECOVERABLE_IF(nullptr == alloc);
-        auto offset = alloc->getGpuAddressToPatch();
-        if (!localIdsGenerationByRuntime) {
-            offset += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
-        }
-        idd.setKernelStartPointer(offset);
+    bool inlineDataProgramming = EncodeDispatchKernel<Family>::inlineDataProgrammingRequired(kernelDescriptor) && sizeCrossThreadData != 0;
+    auto threadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
+    auto bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
+
+    bool useDispatchTemplate = DebugManager.flags.EnableDispatchKernelTemplates.get() == 1;
+    DispatchKernelTemplateKey dispatchTemplateKey;
+    const void *dispatchTemplate = nullptr;
+    if (useDispatchTemplate) {
+        dispatchTemplateKey = DispatchKernelTemplateKey::create(args);
+        dispatchTemplate = container.getDispatchKernelTemplateCache().find(dispatchTemplateKey, sizeof(walkerCmd));
     }
 
-    auto threadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
-    idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
-    idd.setDenormMode(INTERFACE_DESCRIPTOR_DATA::DENORM_MODE_SETBYKERNEL);
+    if (dispatchTemplate) {
+        memcpy_s(&walkerCmd, sizeof(walkerCmd), dispatchTemplate, sizeof(walkerCmd));
+        if (!args.isIndirect) {
+            walkerCmd.setThreadGroupIdXDimension(threadDims[0]);
+            walkerCmd.setThreadGroupIdYDimension(threadDims[1]);
+            walkerCmd.setThreadGroupIdZDimension(threadDims[2]);
+        }
+    } else {
+        EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
+                                                 sizePerThreadData, hwInfo);
+        auto &productHelper = args.device->getProductHelper();
+        productHelper.updateIddCommand(&idd, kernelDescriptor.kernelAttributes.numGrfRequired,
+                                       kernelDescriptor.kernelAttributes.threadArbitrationPolicy);
+        {
+            auto alloc = args.dispatchInterface->getIsaAllocation();
+            UNRECOVERABLE_IF(nullptr == alloc);
+            auto offset = alloc->getGpuAddressToPatch();
+            if (!localIdsGenerationByRuntime) {
+                offset += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
+            }
+            idd.setKernelStartPointer(offset);
+        }
+
+        idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
+        idd.setDenormMode(INTERFACE_DESCRIPTOR_DATA::DENORM_MODE_SETBYKERNEL);
+
+        EncodeDispatchKernel<Family>::programBarrierEnable(idd,
+                                                           kernelDescriptor.kernelAttributes.barrierCount,
+                                                           hwInfo);
 
-    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
-                                                       kernelDescriptor.kernelAttributes.barrierCount,
-                                                       hwInfo);
+        auto &gfxCoreHelper = args.device->getGfxCoreHelper();
+        auto slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(
+            gfxCoreHelper.computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize()));
 
-    auto &gfxCoreHelper = args.device->getGfxCoreHelper();
-    auto slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(
-        gfxCoreHelper.computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize()));
+        if (DebugManager.flags.OverrideSlmAllocationSize.get() != -1) {
+            slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(DebugManager.flags.OverrideSlmAllocationSize.get());
+        }
+        idd.setSharedLocalMemorySize(slmSize);
+
+        PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, args.preemptionMode);
 
-    if (DebugManager.flags.OverrideSlmAllocationSize.get() != -1) {
-        slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(DebugManager.flags.OverrideSlmAllocationSize.get());
+        uint32_t samplerCount = 0;
+        if constexpr (Family::supportsSampler) {
+            if (args.device->getDeviceInfo().imageSupport) {
+                samplerCount = kernelDescriptor.payloadMappings.samplerTable.numSamplers;
+            }
+        }
+        EncodeDispatchKernel<Family>::adjustBindingTablePrefetch(idd, samplerCount, bindingTableStateCount);
+
+        EncodeDispatchKernel<Family>::encodeThreadData(walkerCmd,
+                                                       nullptr,
+                                                       threadDims,
+                                                       args.dispatchInterface->getGroupSize(),
+                                                       kernelDescriptor.kernelAttributes.simdSize,
+                                                       kernelDescriptor.kernelAttributes.numLocalIdChannels,
+                                                       threadsPerThreadGroup,
+                                                       args.dispatchInterface->getThreadExecutionMask(),
+                                                       localIdsGenerationByRuntime,
+                                                       inlineDataProgramming,
+                                                       args.isIndirect,
+                                                       requiredWorkgroupOrder,
+                                                       rootDeviceEnvironment);
+
+        EncodeDispatchKernel<Family>::appendAdditionalIDDFields(&idd, rootDeviceEnvironment, threadsPerThreadGroup,
+                                                                args.dispatchInterface->getSlmTotalSize(),
+                                                                args.dispatchInterface->getSlmPolicy());
+
+        if (useDispatchTemplate) {
+            container.getDispatchKernelTemplateCache().store(dispatchTemplateKey, &walkerCmd, sizeof(walkerCmd));
+        }
     }
-    idd.setSharedLocalMemorySize(slmSize);
 
-    auto bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
     uint32_t bindingTablePointer = 0u;
     if ((kernelDescriptor.kernelAttributes.bufferAddressingMode == KernelDescriptor::BindfulAndStateless) ||
         kernelDescriptor.kernelAttributes.flags.usesImages) {
@@ -129,10 +178,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     }
     idd.setBindingTablePointer(bindingTablePointer);
 
-    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, args.preemptionMode);
-
-    uint32_t samplerCount = 0;
-
     if constexpr (Family::supportsSampler) {
         if (args.device->getDeviceInfo().imageSupport) {
 
@@ -145,7 +190,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
                 }
                 UNRECOVERABLE_IF(!dsHeap);
 
-                samplerCount = kernelDescriptor.payloadMappings.samplerTable.numSamplers;
                 samplerStateOffset = EncodeStates<Family>::copySamplerState(
                     dsHeap, kernelDescriptor.payloadMappings.samplerTable.tableOffset,
                     kernelDescriptor.payloadMappings.samplerTable.numSamplers, kernelDescriptor.payloadMappings.samplerTable.borderColor,
@@ -160,8 +204,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
     }
 
-    EncodeDispatchKernel<Family>::adjustBindingTablePrefetch(idd, samplerCount, bindingTableStateCount);
-
     uint64_t offsetThreadData = 0u;
     const uint32_t inlineDataSize = sizeof(INLINE_DATA);
     auto crossThreadData = args.dispatchInterface->getCrossThreadData();
@@ -174,7 +216,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         memcpy_s(dest, inlineDataProgrammingOffset, crossThreadData, inlineDataProgrammingOffset);
         sizeCrossThreadData -= inlineDataProgrammingOffset;
         crossThreadData = ptrOffset(crossThreadData, inlineDataProgrammingOffset);
-        inlineDataProgramming = inlineDataProgrammingOffset != 0;
     }
 
     uint32_t sizeThreadData = sizePerThreadDataForWholeGroup + sizeCrossThreadData;
@@ -258,20 +299,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     walkerCmd.setIndirectDataStartAddress(static_cast<uint32_t>(offsetThreadData));
     walkerCmd.setIndirectDataLength(sizeThreadData);
 
-    EncodeDispatchKernel<Family>::encodeThreadData(walkerCmd,
-                                                   nullptr,
-                                                   threadDims,
-                                                   args.dispatchInterface->getGroupSize(),
-                                                   kernelDescriptor.kernelAttributes.simdSize,
-                                                   kernelDescriptor.kernelAttributes.numLocalIdChannels,
-                                                   args.dispatchInterface->getNumThreadsPerThreadGroup(),
-                                                   args.dispatchInterface->getThreadExecutionMask(),
-                                                   localIdsGenerationByRuntime,
-                                                   inlineDataProgramming,
-                                                   args.isIndirect,
-                                                   requiredWorkgroupOrder,
-                                                   rootDeviceEnvironment);
-
     using POSTSYNC_DATA = typename Family::POSTSYNC_DATA;
     auto &postSync = walkerCmd.getPostSync();
     if (args.eventAddress != 0) {
@@ -300,10 +327,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     auto threadGroupCount = walkerCmd.getThreadGroupIdXDimension() * walkerCmd.getThreadGroupIdYDimension() * walkerCmd.getThreadGroupIdZDimension();
     EncodeDispatchKernel<Family>::adjustInterfaceDescriptorData(idd, *args.device, hwInfo, threadGroupCount, kernelDescriptor.kernelAttributes.numGrfRequired);
 
-    EncodeDispatchKernel<Family>::appendAdditionalIDDFields(&idd, rootDeviceEnvironment, threadsPerThreadGroup,
-                                                            args.dispatchInterface->getSlmTotalSize(),
-                                                            args.dispatchInterface->getSlmPolicy());
-
     EncodeWalkerArgs walkerArgs{
         args.isCooperative ? KernelExecutionType::Concurrent : KernelExecutionType::Default,
         args.isHostScopeSignalEvent && args.isKernelUsingSystemAllocation,
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/dispatch_kernel_template_cache.h"
+
+#include "shared/source/command_container/command_encoder.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+DispatchKernelTemplateKey DispatchKernelTemplateKey::create(const EncodeDispatchKernelArgs &args) {
+    auto dispatchInterface = args.dispatchInterface;
+    auto groupSize = dispatchInterface->getGroupSize();
+    auto isaAllocation = dispatchInterface->getIsaAllocation();
+
+    DispatchKernelTemplateKey key;
+    key.kernelDescriptor = &dispatchInterface->getKernelDescriptor();
+    key.isaGpuAddress = isaAllocation ? isaAllocation->getGpuAddressToPatch() : 0u;
+    std::copy(groupSize, groupSize + 3, key.groupSize);
+    key.numThreadsPerThreadGroup = dispatchInterface->getNumThreadsPerThreadGroup();
+    key.threadExecutionMask = dispatchInterface->getThreadExecutionMask();
+    key.slmTotalSize = dispatchInterface->getSlmTotalSize();
+    key.slmPolicy = static_cast<uint32_t>(dispatchInterface->getSlmPolicy());
+    key.crossThreadDataSize = dispatchInterface->getCrossThreadDataSize();
+    key.perThreadDataSize = dispatchInterface->getPerThreadDataSize();
+    key.requiredWorkgroupOrder = dispatchInterface->getRequiredWorkgroupOrder();
+    key.preemptionMode = static_cast<uint32_t>(args.preemptionMode);
+    key.localIdsGenerationByRuntime = dispatchInterface->requiresGenerationOfLocalIdsByRuntime();
+    key.isIndirect = args.isIndirect;
+    return key;
+}
+
+bool DispatchKernelTemplateKey::operator==(const DispatchKernelTemplateKey &other) const {
+    return kernelDescriptor == other.kernelDescriptor &&
+           isaGpuAddress == other.isaGpuAddress &&
+           std::equal(groupSize, groupSize + 3, other.groupSize) &&
+           numThreadsPerThreadGroup == other.numThreadsPerThreadGroup &&
+           threadExecutionMask == other.threadExecutionMask &&
+           slmTotalSize == other.slmTotalSize &&
+           slmPolicy == other.slmPolicy &&
+           crossThreadDataSize == other.crossThreadDataSize &&
+           perThreadDataSize == other.perThreadDataSize &&
+           requiredWorkgroupOrder == other.requiredWorkgroupOrder &&
+           preemptionMode == other.preemptionMode &&
+           localIdsGenerationByRuntime == other.localIdsGenerationByRuntime &&
+           isIndirect == other.isIndirect;
+}
+
+const void *DispatchKernelTemplateCache::find(const DispatchKernelTemplateKey &key, size_t templateSize) {
+    // Consecutive launches of the same kernel are the common case, check last hit first.
+    if (lastHitIndex < entries.size() && entries[lastHitIndex].key == key && entries[lastHitIndex].data.size() == templateSize) {
+        hitCount++;
+        return entries[lastHitIndex].data.data();
+    }
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (entries[i].key == key && entries[i].data.size() == templateSize) {
+            lastHitIndex = i;
+            hitCount++;
+            return entries[i].data.data();
+        }
+    }
+    missCount++;
+    return nullptr;
+}
+
+void DispatchKernelTemplateCache::store(const DispatchKernelTemplateKey &key, const void *templateData, size_t templateSize) {
+    Entry *entry = nullptr;
+    if (entries.size() < maxTemplateCount) {
+        lastHitIndex = entries.size();
+        entry = &entries.emplace_back();
+    } else {
+        lastHitIndex = nextReplacedIndex;
+        entry = &entries[nextReplacedIndex];
+        nextReplacedIndex = (nextReplacedIndex + 1) % maxTemplateCount;
+    }
+
+    entry->key = key;
+    entry->data.resize(templateSize);
+    memcpy_s(entry->data.data(), templateSize, templateData, templateSize);
+}
+
+void DispatchKernelTemplateCache::clear() {
+    entries.clear();
+    lastHitIndex = 0;
+    nextReplacedIndex = 0;
+}
+
+} // namespace NEO
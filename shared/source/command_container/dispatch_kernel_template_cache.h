@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+struct EncodeDispatchKernelArgs;
+struct KernelDescriptor;
+
+// Inputs which fully determine the launch independent part of walker and interface descriptor.
+struct DispatchKernelTemplateKey {
+    static DispatchKernelTemplateKey create(const EncodeDispatchKernelArgs &args);
+    bool operator==(const DispatchKernelTemplateKey &other) const;
+
+    const KernelDescriptor *kernelDescriptor = nullptr;
+    uint64_t isaGpuAddress = 0;
+    uint32_t groupSize[3] = {};
+    uint32_t numThreadsPerThreadGroup = 0;
+    uint32_t threadExecutionMask = 0;
+    uint32_t slmTotalSize = 0;
+    uint32_t slmPolicy = 0;
+    uint32_t crossThreadDataSize = 0;
+    uint32_t perThreadDataSize = 0;
+    uint32_t requiredWorkgroupOrder = 0;
+    uint32_t preemptionMode = 0;
+    bool localIdsGenerationByRuntime = false;
+    bool isIndirect = false;
+};
+
+// Pre-encoded walker (and interface descriptor) templates. Launch specific fields like
+// group counts, indirect data and post sync addresses are patched by the encoder.
+class DispatchKernelTemplateCache {
+  public:
+    static constexpr size_t maxTemplateCount = 32;
+
+    const void *find(const DispatchKernelTemplateKey &key, size_t templateSize);
+    void store(const DispatchKernelTemplateKey &key, const void *templateData, size_t templateSize);
+    void clear();
+
+    uint64_t getHitCount() const { return hitCount; }
+    uint64_t getMissCount() const { return missCount; }
+
+  protected:
+    struct Entry {
+        DispatchKernelTemplateKey key;
+        std::vector<uint8_t> data;
+    };
+
+    std::vector<Entry> entries;
+    size_t lastHitIndex = 0;
+    size_t nextReplacedIndex = 0;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+};
+
+} // namespace NEO
@@ -13,12 +13,16 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/os_interface/os_inc_base.h"
+#include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/sys_calls_common.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <cstring>
 #include <sstream>
 
@@ -90,24 +94,174 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t g_dwordCountMax;
 
+AubFileStream::~AubFileStream() {
+    stopWriterThread();
+}
+
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    bytesWritten = 0;
+    bytesSkipped = 0;
+    fileWriteTimeNs = 0;
+    pageHashes.clear();
+    collectStatistics = NEO::DebugManager.flags.PrintAubWriterStatistics.get();
+    skipUnchangedPages = NEO::DebugManager.flags.AubDumpSkipUnchangedPages.get() == 1;
+    if (NEO::DebugManager.flags.AubDumpAsyncWriteBufferSize.get() > 0) {
+        writeBufferSize = static_cast<size_t>(NEO::DebugManager.flags.AubDumpAsyncWriteBufferSize.get());
+    }
+    if (NEO::DebugManager.flags.AubDumpAsyncWrite.get() == 1 && fileHandle.is_open()) {
+        startWriterThread();
+    }
 }
 
 void AubFileStream::close() {
+    stopWriterThread();
+    if (collectStatistics && fileHandle.is_open()) {
+        printStatistics();
+    }
     fileHandle.close();
     fileName.clear();
+    pageHashes.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
-    fileHandle.write(data, size);
+    bytesWritten += size;
+
+    if (!writerThread) {
+        auto start = collectStatistics ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+        fileHandle.write(data, size);
+        if (collectStatistics) {
+            fileWriteTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        }
+        return;
+    }
+
+    while (size > 0) {
+        if (writeBuffer.size() == writeBufferSize) {
+            submitWriteBuffer();
+        }
+        auto chunkSize = std::min(size, writeBufferSize - writeBuffer.size());
+        writeBuffer.insert(writeBuffer.end(), data, data + chunkSize);
+        data += chunkSize;
+        size -= chunkSize;
+    }
 }
 
 void AubFileStream::flush() {
+    if (writerThread) {
+        submitWriteBuffer();
+        waitForPendingWrites();
+    }
     fileHandle.flush();
 }
 
+void AubFileStream::startWriterThread() {
+    writeBuffer.reserve(writeBufferSize);
+    keepWriting = true;
+    writerThread = NEO::Thread::create(writerThreadFunction, reinterpret_cast<void *>(this));
+}
+
+void AubFileStream::stopWriterThread() {
+    if (!writerThread) {
+        return;
+    }
+    submitWriteBuffer();
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        keepWriting = false;
+    }
+    writerCondition.notify_all();
+    writerThread->join();
+    writerThread.reset();
+    freeWriteBuffers.clear();
+    writeBuffer = {};
+}
+
+void AubFileStream::submitWriteBuffer() {
+    if (writeBuffer.empty()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(writerMutex);
+    writerCondition.wait(lock, [this] { return pendingWriteBuffers.size() < maxPendingWriteBuffers; });
+    pendingWriteBuffers.push_back(std::move(writeBuffer));
+    if (!freeWriteBuffers.empty()) {
+        writeBuffer = std::move(freeWriteBuffers.back());
+        freeWriteBuffers.pop_back();
+    } else {
+        writeBuffer = {};
+        writeBuffer.reserve(writeBufferSize);
+    }
+    lock.unlock();
+    writerCondition.notify_all();
+}
+
+void AubFileStream::waitForPendingWrites() {
+    std::unique_lock<std::mutex> lock(writerMutex);
+    writerCondition.wait(lock, [this] { return pendingWriteBuffers.empty() && !writeInProgress; });
+}
+
+void *AubFileStream::writerThreadFunction(void *arg) {
+    auto stream = reinterpret_cast<AubFileStream *>(arg);
+
+    std::unique_lock<std::mutex> lock(stream->writerMutex);
+    while (true) {
+        stream->writerCondition.wait(lock, [stream] { return !stream->pendingWriteBuffers.empty() || !stream->keepWriting; });
+        if (stream->pendingWriteBuffers.empty()) {
+            break;
+        }
+
+        auto buffer = std::move(stream->pendingWriteBuffers.front());
+        stream->pendingWriteBuffers.pop_front();
+        stream->writeInProgress = true;
+        lock.unlock();
+
+        auto start = std::chrono::steady_clock::now();
+        stream->fileHandle.write(buffer.data(), buffer.size());
+        stream->fileWriteTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        buffer.clear();
+
+        lock.lock();
+        stream->writeInProgress = false;
+        stream->freeWriteBuffers.push_back(std::move(buffer));
+        stream->writerCondition.notify_all();
+    }
+    return nullptr;
+}
+
+void AubFileStream::printStatistics() const {
+    const double writeTimeMs = fileWriteTimeNs.load() / 1e6;
+    const double throughputMBps = writeTimeMs > 0 ? (bytesWritten / (1024.0 * 1024.0)) / (writeTimeMs / 1e3) : 0.0;
+    printf("AUB capture %s: written %llu bytes, skipped %llu bytes of unchanged pages, file write time %.3f ms (%.1f MB/s)\n",
+           fileName.c_str(),
+           static_cast<unsigned long long>(bytesWritten),
+           static_cast<unsigned long long>(bytesSkipped),
+           writeTimeMs,
+           throughputMBps);
+}
+
+bool AubFileStream::isPageWriteRedundant(uint64_t physAddress, uint64_t gpuAddress, const void *memory, size_t size, uint64_t entryBits) {
+    if (!skipUnchangedPages) {
+        return false;
+    }
+
+    NEO::Hash hash;
+    hash.update(reinterpret_cast<const char *>(memory), size);
+    const uint64_t mapping[] = {gpuAddress, entryBits, size};
+    hash.update(reinterpret_cast<const char *>(mapping), sizeof(mapping));
+    const auto pageHash = hash.finish();
+
+    auto storedHash = pageHashes.find(physAddress);
+    if (storedHash != pageHashes.end() && storedHash->second == pageHash) {
+        bytesSkipped += size;
+        return true;
+    }
+    pageHashes[physAddress] = pageHash;
+    return false;
+}
+
 bool AubFileStream::init(uint32_t stepping, uint32_t device) {
     CmdServicesMemTraceVersion header = {};
 
@@ -71,6 +71,10 @@ AUBCommandStreamReceiverHw<GfxFamily>::AUBCommandStreamReceiverHw(const std::str
 
     ppgtt = std::make_unique<std::conditional<is64bit, PML4, PDPE>::type>(physicalAddressAllocator);
     ggtt = std::make_unique<PDPE>(physicalAddressAllocator);
+    if (DebugManager.flags.EnablePageTableNodeArena.get() == 1) {
+        ppgtt->enableNodeArena();
+        ggtt->enableNodeArena();
+    }
 
     gttRemap = aubCenter->getAddressMapper();
     UNRECOVERABLE_IF(nullptr == gttRemap);
@@ -654,6 +658,9 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
     AubHelperHw<GfxFamily> aubHelperHw(this->isLocalMemoryEnabled());
 
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        if (getAubStream()->isPageWriteRedundant(physAddress, gpuAddress + offset, ptrOffset(cpuAddress, offset), size, entryBits)) {
+            return;
+        }
         AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
     };
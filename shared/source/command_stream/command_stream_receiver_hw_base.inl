@@ -1053,7 +1053,19 @@ inline WaitStatus CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNot
     const auto params = kmdNotifyHelper->obtainTimeoutParams(useQuickKmdSleep, *getTagAddress(), taskCountToWait, flushStampToWait, throttle, this->isKmdWaitModeActive(),
                                                              this->isAnyDirectSubmissionEnabled());
 
+    const bool recordWaitDuration = kmdNotifyHelper->adaptivePolicyEnabled();
+    std::chrono::steady_clock::time_point waitStartTime;
+    if (recordWaitDuration) {
+        waitStartTime = std::chrono::steady_clock::now();
+    }
+
     auto status = waitForCompletionWithTimeout(params, taskCountToWait);
+    if (recordWaitDuration && (status == WaitStatus::Ready || params.waitTimeout > 0)) {
+        // Only the polling phase is measured, KMD wake-up latency would make long waits look even longer.
+        // A poll that timed out still tells the wait took at least the poll duration.
+        auto pollDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStartTime);
+        kmdNotifyHelper->recordWaitDuration(pollDuration.count());
+    }
     if (status == WaitStatus::NotReady) {
         waitForFlushStamp(flushStampToWait);
         // now call blocking wait, this is to ensure that task count is reached
@@ -50,6 +50,10 @@ TbxCommandStreamReceiverHw<GfxFamily>::TbxCommandStreamReceiverHw(ExecutionEnvir
 
     ppgtt = std::make_unique<std::conditional<is64bit, PML4, PDPE>::type>(physicalAddressAllocator.get());
     ggtt = std::make_unique<PDPE>(physicalAddressAllocator.get());
+    if (DebugManager.flags.EnablePageTableNodeArena.get() == 1) {
+        ppgtt->enableNodeArena();
+        ggtt->enableNodeArena();
+    }
 
     auto debugDeviceId = DebugManager.flags.OverrideAubDeviceId.get();
     this->aubDeviceId = debugDeviceId == -1
@@ -418,12 +422,13 @@ void TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
 
     AubHelperHw<GfxFamily> aubHelperHw(this->localMemoryEnabled);
 
-    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
-        AUB::reserveAddressGGTTAndWriteMmeory(tbxStream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
-                                              aubHelperHw);
-    };
+    PageWalkRanges ranges;
+    ppgtt->rangeWalk(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, ranges, memoryBank);
 
-    ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, walker, memoryBank);
+    for (const auto &range : ranges) {
+        AUB::reserveAddressGGTTAndWriteMmeory(tbxStream, static_cast<uintptr_t>(gpuAddress), cpuAddress, range.physAddress, range.size, range.offset, range.entryBits,
+                                              aubHelperHw);
+    }
 }
 
 template <typename GfxFamily>
@@ -547,11 +552,13 @@ void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocationTbx(GraphicsAlloca
     auto length = gfxAllocation.getUnderlyingBufferSize();
 
     if (length) {
-        PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
-            DEBUG_BREAK_IF(offset > length);
-            tbxStream.readMemory(physAddress, ptrOffset(cpuAddress, offset), size);
-        };
-        ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), length, 0, 0, walker, this->getMemoryBank(&gfxAllocation));
+        PageWalkRanges ranges;
+        ppgtt->rangeWalk(static_cast<uintptr_t>(gpuAddress), length, 0, 0, ranges, this->getMemoryBank(&gfxAllocation));
+
+        for (const auto &range : ranges) {
+            DEBUG_BREAK_IF(range.offset > length);
+            tbxStream.readMemory(range.physAddress, ptrOffset(cpuAddress, range.offset), range.size);
+        }
     }
 }
 
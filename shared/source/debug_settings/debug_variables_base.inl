@@ -25,9 +25,15 @@ DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterKernelEndIdx, -1, "End index of ker
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpToggleCaptureOnOff, 0, "Toggle AUB capture on/off")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio offset from list with new value from AubDumpOverrideMmioRegisterValue")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpAsyncWrite, -1, "Write AUB file from a background thread through large buffers. -1: default (disabled), 0: disable, 1: enable")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpAsyncWriteBufferSize, -1, "-1: default (16MB), >0: size in bytes of a single AUB write buffer handed over to the background writer")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpSkipUnchangedPages, -1, "Do not dump memory pages again if their content and mapping did not change since last dump. -1: default (disabled), 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, ClDeviceGlobalMemSizeAvailablePercent, -1, "Percent of total GPU memory available; CL_DEVICE_GLOBAL_MEM_SIZE")
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxSocketsBatchWrites, -1, "Coalesce TBX write requests and send them only when the batch is full or a response is needed. -1: default (disabled), 0: disable, 1: enable")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxSocketsBatchSize, -1, "Size in bytes of the TBX write batch used with TbxSocketsBatchWrites. -1: default (1MB)")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePageTableNodeArena, -1, "Allocate simulated page table nodes of AUB and TBX command stream receivers from a shared arena. -1: default (disabled), 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, HBMSizePerTileInGigabytes, 0, "Size of HBM memory in GigaBytes per tile.")
 DECLARE_DEBUG_VARIABLE(bool, TbxFrontdoorMode, false, "Set TBX frontdoor mode for read and write memory accesses (the default mode is via backdoor)")
 DECLARE_DEBUG_VARIABLE(bool, FlattenBatchBufferForAUBDump, false, "Dump multi-level batch buffers to AUB as single, flat batch buffer")
@@ -36,6 +42,7 @@ DECLARE_DEBUG_VARIABLE(bool, UseAubStream, true, "Use aubstream for aub dumping"
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueReadOnly, false, "Force dumping buffers and images on clEnqueueReadBuffer/Image only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueSVMMemcpyOnly, false, "Force dumping allocations on clEnqueueSVMMemcpy only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
+DECLARE_DEBUG_VARIABLE(bool, PrintAubWriterStatistics, false, "Print AUB capture size, skipped memory and write throughput when AUB file is closed")
 DECLARE_DEBUG_VARIABLE(bool, GenerateAubFilePerProcessId, false, "Generate aub file with process id")
 
 /*DEBUG FLAGS*/
@@ -127,6 +134,13 @@ DECLARE_DEBUG_VARIABLE(int32_t, GpuScratchRegWriteAfterWalker, -1, "-1: disabled
 DECLARE_DEBUG_VARIABLE(int32_t, GpuScratchRegWriteRegisterOffset, 0, "register offset for GPU scratch register write after walker")
 DECLARE_DEBUG_VARIABLE(int32_t, GpuScratchRegWriteRegisterData, 0, "register data for GPU scratch register write after walker")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmAllocationSize, -1, "-1: default, >=0: program value for shared local memory size")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDispatchKernelTemplates, -1, "Cache pre-encoded walker and interface descriptor per kernel and dispatch state in command container and patch only launch specific fields, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCpuMemcpyStreaming, -1, "Use non-temporal stores and streaming loads for CPU copies to and from locked device memory, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuMemcpyMultiThreadThreshold, -1, "Size in bytes above which streaming CPU copy to or from locked memory and CPU image transfer are split between threads, -1: default (4MB)")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuMemcpyMaxThreadCount, -1, "Maximum number of threads used by streaming CPU copy to or from locked memory and CPU image transfer, -1: default (4, limited by hardware concurrency)")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelImageTransfer, -1, "Split CPU transfers of linear image data between host ptr and image storage across threads, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCpuTiledImageCopy, -1, "Write small image regions from host memory on CPU with tile address swizzling instead of GPU builtin or blit, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuTiledImageCopyMaxSize, -1, "Maximum size in bytes of image region written on CPU when EnableCpuTiledImageCopy is set, -1: default (64KB)")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerLogBitmask, 0, "0: logs disabled, 1 - INFO, 2 - ERROR, 1<<10 - Dump elf, see DebugVariables::DEBUGGER_LOG_BITMASK")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerOptDisable, -1, "-1: default from debugger query, 0: do not add opt-disable, 1: add opt-disable")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerForceSbaTrackingMode, -1, "-1: default, 0: per context address spaces, 1: single address space")
@@ -233,6 +247,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, AppendAubStreamContextFlags, -1, "-1: default, >
 DECLARE_DEBUG_VARIABLE(int32_t, DisableScratchPages, -1, "-1: default, 0: do not disable scratch pages during VM creations, 1: disable scratch pages during VM creations")
 DECLARE_DEBUG_VARIABLE(int32_t, OptimizeIoqBarriersHandling, -1, "-1: default, 0: disable, 1: enable. If enabled, dont dispatch stalling commands for IOQ. Instead, inherit TimestampPackets from previous enqueue.")
 DECLARE_DEBUG_VARIABLE(int64_t, OverrideEventSynchronizeTimeout, -1, "-1: default - user provided timeout value,  >0: timeout in nanoseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBatchedEventSynchronization, -1, "Synchronize lists of events with a single batched packet scan instead of per event host synchronization, -1: default , 0: disabled, 1: enabled")
 
 /*LOGGING FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, PrintDriverDiagnostics, -1, "prints driver diagnostics messages to standard output, value corresponds to hint level")
@@ -316,10 +331,15 @@ DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsCopy, -1, "-1: default, 0:disabled, 1: e
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMask, 0, "0: default, >0: bitmask: indicates bcs engines for split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskH2D, 0, "0: default, >0: bitmask: indicates bcs engines for H2D split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskD2H, 0, "0: default, >0: bitmask: indicates bcs engines for D2H split")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsSize, -1, "-1: default, >0: minimal copy size in bytes to split between copy engines")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMinChunkSize, -1, "-1: default, >0: minimal size in bytes of a single split copy chunk, smaller copies use fewer engines")
 DECLARE_DEBUG_VARIABLE(int32_t, ReuseKernelBinaries, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver reuses kernel binaries.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocations, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers and heaps at initialization of immediate command list.")
 DECLARE_DEBUG_VARIABLE(int32_t, UseHighAlignmentForHeapExtended, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver aligns HEAP_EXTENDED allocations to GPU VA that is next power of 2 for a given size, if disables GPU VA is using 2MB/64KB alignment.")
 DECLARE_DEBUG_VARIABLE(int32_t, DispatchCmdlistCmdBufferPrimary, -1, "-1: default, 0: dispatch command buffers as seconadry, 1: dispatch command buffers as primary and chain")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricStreamingMaxPendingBatches, -1, "-1: default (1024), >0: max number of batches produced by metric streaming reader and not yet released by application")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricStreamingPollIntervalUs, -1, "-1: default (100 us), >=0: time in us metric streaming reader thread sleeps when no reports are available")
+DECLARE_DEBUG_VARIABLE(int32_t, PrintfBackgroundDrainIntervalUs, -1, "-1: default (disabled), >0: printf output of executing kernels is printed by a background thread every given number of us")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -363,6 +383,7 @@ DECLARE_DEBUG_VARIABLE(bool, EnableAsyncDestroyAllocations, true, "Enables async
 DECLARE_DEBUG_VARIABLE(bool, EnableAsyncEventsHandler, true, "Enables async events handler")
 DECLARE_DEBUG_VARIABLE(bool, EnableForcePin, true, "Enables early pinning for memory object")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeND, true, "Enables different algorithm to compute local work size")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelGroupSizeSuggestionCache, -1, "Memoize zeKernelSuggestGroupSize results per kernel in a thread local table. -1: default (disabled), 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(bool, EnableMultiRootDeviceContexts, true, "Enables support for multi root device contexts")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeSquared, false, "Enables algorithm to compute the most squared work group as possible")
 DECLARE_DEBUG_VARIABLE(bool, EnableExtendedVaFormats, false, "Enable more formats in cl-va sharing")
@@ -401,6 +422,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForSporadicWaits, -1,
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForSporadicWaitsMicroseconds, -1, "-1: don't override, >0: timeout in microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForDirectSubmission, -1, "-1: don't override, 0: disable, 1: enable. It works only when QuickKmdSleep is enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForDirectSubmissionMicroseconds, -1, "-1: don't override, >0: timeout in microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveKmdNotify, -1, "-1: default (disabled), 0: disable, 1: enable. Choose KMD notify poll duration per command stream receiver from a histogram of observed wait durations. It works only when Kmd Notify is enabled.")
+DECLARE_DEBUG_VARIABLE(int32_t, AdaptiveKmdNotifyPercentile, -1, "-1: default (90), 1-100: percentage of observed waits that polling should cover before falling back to KMD wait. Higher values trade CPU time for lower latency")
 DECLARE_DEBUG_VARIABLE(int32_t, PowerSavingMode, 0, "0: default 1: enable. Whenever driver waits on GPU and its not ready, put waiting thread to sleep and wait for notification.")
 DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Csr")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedImagesEnabled, -1, "-1: default, 0: disabled, 1: enabled")
@@ -411,6 +434,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnablePassInlineData, -1, "-1: default, 0: Do no
 DECLARE_DEBUG_VARIABLE(int32_t, ForceFineGrainedSVMSupport, -1, "-1: default, 0: Do not report Fine Grained SVM capabilities 1: Report SVM Fine Grained capabilities if device supports SVM")
 DECLARE_DEBUG_VARIABLE(int32_t, ForcePipeSupport, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, UseAsyncDrmExec, -1, "-1: default, 0: Disabled 1: Enabled. If enabled, pass EXEC_OBJECT_ASYNC to exec ioctl.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableExecObjectCaching, -1, "-1: default, 0: Disabled 1: Enabled. If enabled, exec objects are encoded once per buffer object and OsContext and copied on later execs until buffer object state changes.")
 DECLARE_DEBUG_VARIABLE(int32_t, UseBindlessMode, -1, "Use precompiled builtins in bindless mode, -1: api dependent, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmSize, -1, "Force different slm size than default in kB")
 DECLARE_DEBUG_VARIABLE(int32_t, UseCyclesPerSecondTimer, 0, "0: default behavior, 0: disabled: Report L0 timer in nanosecond units, 1: enabled: Report L0 timer in cycles per second")
@@ -438,10 +462,17 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableDrmCompletionFence, -1, "Enables DRM compl
 DECLARE_DEBUG_VARIABLE(int32_t, UseDrmCompletionFenceForAllAllocations, -1, "Uses DRM completion fence for all allocations, -1:default (disabled), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableChipsetUniqueUUID, -1, "Enables retrieving chipset unique UUID using telemetry, -1:default (enabled), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableFlushTaskSubmission, -1, "Driver uses csr flushTask for immediate commandlist submissions, -1:default (enabled), 0:disabled, 1:enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateCmdListCoalescedFlush, -1, "Coalesce kernel launches without events on asynchronous immediate command lists into a single flushTask. Work is submitted on the next launch with host visible dependencies, other append, size threshold, host synchronization, memory free, kernel or module destroy, in background once delay threshold expires and by zexCommandListFlushPendingCommands, -1:default (disabled), 0:disabled, 1:enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListCoalescedFlushMaxSize, -1, "Size in bytes of coalesced immediate command list commands that triggers submission, -1:default (16KB)")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListCoalescedFlushMaxDelayUs, -1, "Time in microseconds since first coalesced immediate command list command after which pending commands are submitted, -1:default (100)")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateCmdListLaunchReplay, -1, "Record kernel launches without events on asynchronous immediate command lists into internal regular command lists and replay them when launched again without setting any kernel argument or property in between, pending replays are submitted with the next other append or zexCommandListFlushPendingCommands, -1:default (disabled), 0:disabled, 1:enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListLaunchReplayCacheSize, -1, "Number of recorded launches kept per immediate command list, -1:default (32)")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListLaunchReplayMaxBatch, -1, "Number of replayed launches submitted together in a single executeCommandLists call, -1:default (16)")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateCmdListHeapSharing, -1, "Immediate command lists using flush task use current csr heap instead private cmd list heap, -1:default (disabled), 0:disabled, 1:enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, UsePipeControlMultiKernelEventSync, -1, "Use single PIPE_CONTROL for event signal of multi-kernel append operations instead multi-packet POSTSYNC_DATA from each COMPUTE_WALKER, -1: default , 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, CompactL3FlushEventPacket, -1, "Compact COMPUTE_WALKER event packet and L3 Flush signal packet into single event packet, -1: default , 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, UseDynamicEventPacketsCount, -1, "Use dynamic estimation for event packet count based on a given device configuration, -1: default , 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventPacketPool, -1, "Allocate host-side event completion data on demand from storage shared by all events of an event pool, -1: default , 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, SignalAllEventPackets, -1, "All packets of event are signaled, reset and waited/synchronized, -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBcsSwControlWa, -1, "Enable BCS WA via BCSSWCONTROL MMIO. -1: default, 0: disabled, 1: if src in system mem, 2: if dst in system mem, 3: if src and dst in system mem, 4: always")
 
@@ -468,6 +499,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalForceCopyThroughLock, -1, "Force copy through lock pointer on zeAppendMemoryCopy for all cases -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockWaitlistSizeThreshold, -1, "If less than given value, driver will wait for Waitlist on host, instead of sending appendBarrier. If 0, always use barrier.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableStagingBufferCopy, -1, "Copy between pageable host memory and device USM through a pool of pinned staging buffers. -1: default 0: disable 1: enable")
+DECLARE_DEBUG_VARIABLE(int32_t, StagingBufferChunkSize, -1, "-1: default, >0: size in bytes of a single staging buffer used for pageable host memory copies")
+DECLARE_DEBUG_VARIABLE(int32_t, StagingBufferChunksPerCopy, -1, "-1: default, >0: number of staging buffers used in flight by a single pageable host memory copy")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableSourceLevelDebugger, false, "Experimentally enable source level debugger.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally enable attaching to tiles (subdevices).")
@@ -476,6 +510,9 @@ DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally
 DECLARE_DEBUG_VARIABLE(bool, UseMaxSimdSizeToDeduceMaxWorkgroupSize, false, "With this flag on, max workgroup size is deduced using SIMD32 instead of SIMD8, this causes the max wkg size to be 4 times bigger")
 DECLARE_DEBUG_VARIABLE(bool, ReturnRawGpuTimestamps, false, "Driver returns raw GPU timestamps instead of calculated ones.")
 DECLARE_DEBUG_VARIABLE(bool, EnableDeviceBasedTimestamps, true, "Driver returns timestamps in nanoseconds based on device timer.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCpuGpuTimeInterpolation, -1, "Answer CPU-GPU time queries from a calibrated clock model and read the GPU timestamp register only periodically. -1: default (disabled), 0: disable, 1: enable")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuGpuTimeInterpolationMaxErrorNs, -1, "-1: default (1000), >0: error bound in ns between interpolated and sampled GPU time, exceeding it shortens the calibration interval")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuGpuTimeMaxCalibrationIntervalMs, -1, "-1: default (100), >0: maximal time in ms between two GPU timestamp register reads when interpolation is enabled")
 DECLARE_DEBUG_VARIABLE(bool, UseCommandBufferHeaderSizeForWddmQueueSubmission, true, "0: Page size (4096), 1: sizeof(COMMAND_BUFFER_HEADER)")
 DECLARE_DEBUG_VARIABLE(bool, DisableDeepBind, false, "Disable passing RTLD_DEEPBIND flag to all dlopen calls.")
 DECLARE_DEBUG_VARIABLE(bool, UseUmKmDataTranslator, false, "Use helper library for UMD<->KMD (WDDM) struct layout compatibility")
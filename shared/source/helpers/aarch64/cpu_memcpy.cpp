@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/cpu_memcpy.h"
+
+#include <cstring>
+
+namespace NEO {
+
+namespace {
+void cpuMemcpyDefault(void *dst, const void *src, size_t size) {
+    memcpy(dst, src, size);
+}
+} // namespace
+
+void (*CpuMemcpyHelper::copyToLockedMemory)(void *dst, const void *src, size_t size) = cpuMemcpyDefault;
+void (*CpuMemcpyHelper::copyFromLockedMemory)(void *dst, const void *src, size_t size) = cpuMemcpyDefault;
+
+CpuMemcpyHelper::CpuMemcpyHelper() {}
+
+CpuMemcpyHelper CpuMemcpyHelper::initializer;
+
+} // namespace NEO
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/cpu_memcpy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+namespace {
+struct CopyChunk {
+    const CpuMemcpyHelper::CopyChunkFunction *copyChunk;
+    size_t offset;
+    size_t size;
+};
+
+void *copyChunkThreadFunction(void *arg) {
+    auto chunk = reinterpret_cast<CopyChunk *>(arg);
+    (*chunk->copyChunk)(chunk->offset, chunk->size);
+    return nullptr;
+}
+} // namespace
+
+void CpuMemcpyHelper::copyInParallel(size_t size, size_t granularity, const CopyChunkFunction &copyChunk) {
+    size_t multiThreadThreshold = CpuMemcpyHelper::defaultMultiThreadThreshold;
+    if (DebugManager.flags.CpuMemcpyMultiThreadThreshold.get() != -1) {
+        multiThreadThreshold = static_cast<size_t>(DebugManager.flags.CpuMemcpyMultiThreadThreshold.get());
+    }
+    size_t threadCount = std::min(CpuMemcpyHelper::defaultMaxThreadCount, static_cast<size_t>(std::thread::hardware_concurrency()));
+    if (DebugManager.flags.CpuMemcpyMaxThreadCount.get() != -1) {
+        threadCount = static_cast<size_t>(DebugManager.flags.CpuMemcpyMaxThreadCount.get());
+    }
+
+    if (threadCount < 2 || size < std::max(multiThreadThreshold, threadCount * granularity)) {
+        copyChunk(0u, size);
+        return;
+    }
+
+    auto chunkSize = Math::divideAndRoundUp(Math::divideAndRoundUp(size, threadCount), granularity) * granularity;
+    std::vector<CopyChunk> chunks;
+    for (size_t offset = chunkSize; offset < size; offset += chunkSize) {
+        chunks.push_back({&copyChunk, offset, std::min(chunkSize, size - offset)});
+    }
+
+    // Threads are created per copy, see the threshold comment in the header
+    std::vector<std::unique_ptr<Thread>> workers;
+    workers.reserve(chunks.size());
+    for (auto &chunk : chunks) {
+        workers.push_back(Thread::create(copyChunkThreadFunction, &chunk));
+    }
+
+    copyChunk(0u, chunkSize);
+
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+void cpuMemcpyToLockedMemory(void *dst, const void *src, size_t size) {
+    if (DebugManager.flags.EnableCpuMemcpyStreaming.get() != 1) {
+        memcpy_s(dst, size, src, size);
+        return;
+    }
+    // Chunks are multiples of cache line size so threads do not share lines of aligned buffers
+    CpuMemcpyHelper::copyInParallel(size, MemoryConstants::cacheLineSize, [dst, src](size_t offset, size_t chunkSize) {
+        CpuMemcpyHelper::copyToLockedMemory(ptrOffset(dst, offset), ptrOffset(src, offset), chunkSize);
+    });
+}
+
+void cpuMemcpyFromLockedMemory(void *dst, const void *src, size_t size) {
+    if (DebugManager.flags.EnableCpuMemcpyStreaming.get() != 1) {
+        memcpy_s(dst, size, src, size);
+        return;
+    }
+    CpuMemcpyHelper::copyInParallel(size, MemoryConstants::cacheLineSize, [dst, src](size_t offset, size_t chunkSize) {
+        CpuMemcpyHelper::copyFromLockedMemory(ptrOffset(dst, offset), ptrOffset(src, offset), chunkSize);
+    });
+}
+
+} // namespace NEO
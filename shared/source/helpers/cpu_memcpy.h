@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <functional>
+
+namespace NEO {
+
+// CPU copies to and from locked device memory, which is usually mapped write combined.
+// Writes use non-temporal stores and reads use streaming loads when supported by the CPU.
+// Copies above a size threshold are split between multiple threads.
+// Worker threads are created for each such copy, which costs tens of microseconds and pays off only for copies of
+// several megabytes. There is no persistent pool, its threads could not be joined safely while the library is unloaded.
+void cpuMemcpyToLockedMemory(void *dst, const void *src, size_t size);
+void cpuMemcpyFromLockedMemory(void *dst, const void *src, size_t size);
+
+struct CpuMemcpyHelper {
+    static constexpr size_t defaultMultiThreadThreshold = 4 * 1024 * 1024;
+    static constexpr size_t defaultMaxThreadCount = 4;
+
+    static void (*copyToLockedMemory)(void *dst, const void *src, size_t size);
+    static void (*copyFromLockedMemory)(void *dst, const void *src, size_t size);
+
+    // Calls copyChunk for consecutive parts of a copy of given size, on multiple threads when the size reaches
+    // CpuMemcpyMultiThreadThreshold. Boundaries between parts are multiples of granularity.
+    using CopyChunkFunction = std::function<void(size_t offset, size_t size)>;
+    static void copyInParallel(size_t size, size_t granularity, const CopyChunkFunction &copyChunk);
+
+  protected:
+    CpuMemcpyHelper();
+    static CpuMemcpyHelper initializer;
+};
+
+void cpuMemcpyToLockedMemoryAvx2(void *dst, const void *src, size_t size);
+void cpuMemcpyFromLockedMemoryAvx2(void *dst, const void *src, size_t size);
+
+} // namespace NEO
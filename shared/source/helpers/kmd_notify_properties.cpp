@@ -10,12 +10,22 @@
 #include "shared/source/command_stream/queue_throttle.h"
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <limits>
 
 using namespace NEO;
 
+KmdNotifyHelper::KmdNotifyHelper(const KmdNotifyProperties *properties) : properties(properties) {
+    adaptivePolicy = DebugManager.flags.EnableAdaptiveKmdNotify.get() == 1;
+    if (DebugManager.flags.AdaptiveKmdNotifyPercentile.get() != -1) {
+        adaptivePercentile = std::clamp(DebugManager.flags.AdaptiveKmdNotifyPercentile.get(), 1, 100);
+    }
+}
+
 WaitParams KmdNotifyHelper::obtainTimeoutParams(bool quickKmdSleepRequest,
                                                 TagAddressType currentHwTag,
                                                 TaskCountType taskCountToWait,
@@ -55,6 +65,9 @@ WaitParams KmdNotifyHelper::obtainTimeoutParams(bool quickKmdSleepRequest,
         params.waitTimeout = properties->delayQuickKmdSleepForDirectSubmissionMicroseconds;
     } else {
         params.waitTimeout = getBaseTimeout(multiplier);
+        if (adaptivePolicy && properties->enableKmdNotify) {
+            params.waitTimeout = obtainAdaptiveTimeout(params.waitTimeout);
+        }
     }
 
     params.enableTimeout = (properties->enableKmdNotify || !acLineConnected);
@@ -72,6 +85,68 @@ bool KmdNotifyHelper::applyQuickKmdSleepForSporadicWait() const {
     return false;
 }
 
+int64_t KmdNotifyHelper::obtainAdaptiveTimeout(int64_t baseTimeout) {
+    uint64_t histogram[KmdNotifyConstants::adaptiveHistogramBucketCount];
+    uint64_t sampleCount = 0;
+    for (uint32_t bucket = 0; bucket < KmdNotifyConstants::adaptiveHistogramBucketCount; bucket++) {
+        histogram[bucket] = waitDurationHistogram[bucket].load(std::memory_order_relaxed);
+        sampleCount += histogram[bucket];
+    }
+    if (sampleCount < KmdNotifyConstants::adaptiveMinimumSampleCount) {
+        return baseTimeout;
+    }
+
+    // Find the shortest poll that would have covered the requested share of past waits.
+    const uint64_t requiredSampleCount = (sampleCount * adaptivePercentile + 99) / 100;
+    int64_t percentileWaitUs = std::numeric_limits<int64_t>::max();
+    uint64_t coveredSampleCount = 0;
+    for (uint32_t bucket = 0; bucket < KmdNotifyConstants::adaptiveHistogramBucketCount - 1; bucket++) {
+        coveredSampleCount += histogram[bucket];
+        if (coveredSampleCount >= requiredSampleCount) {
+            percentileWaitUs = int64_t{1} << bucket;
+            break;
+        }
+    }
+
+    if (percentileWaitUs <= baseTimeout) {
+        adaptivePollCount++;
+        return percentileWaitUs;
+    }
+    // Polling for the base delay would most likely not see the completion, go to KMD wait right away.
+    // Every few such waits poll for the base delay anyway, so the histogram notices when waits get shorter again.
+    if (++adaptiveLongWaitDecisionCount % KmdNotifyConstants::adaptiveProbeInterval == 0) {
+        adaptiveProbeCount++;
+        return baseTimeout;
+    }
+    adaptiveKmdWaitCount++;
+    return 0;
+}
+
+void KmdNotifyHelper::recordWaitDuration(int64_t waitDurationUs) {
+    uint32_t bucket = 0;
+    if (waitDurationUs > 0) {
+        bucket = std::min(Math::log2(static_cast<uint64_t>(waitDurationUs)) + 1, KmdNotifyConstants::adaptiveHistogramBucketCount - 1);
+    }
+    waitDurationHistogram[bucket]++;
+
+    // Halve the history periodically so the policy follows changes in the workload.
+    if (++waitDurationSampleCount % KmdNotifyConstants::adaptiveHistogramAgingSampleCount == 0) {
+        for (auto &bucketCount : waitDurationHistogram) {
+            bucketCount.store(bucketCount.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+        }
+    }
+}
+
+void KmdNotifyHelper::getStatistics(KmdNotifyStatistics &statistics) const {
+    statistics.adaptivePollCount = adaptivePollCount.load();
+    statistics.adaptiveKmdWaitCount = adaptiveKmdWaitCount.load();
+    statistics.adaptiveProbeCount = adaptiveProbeCount.load();
+    statistics.adaptiveDecisionCount = statistics.adaptivePollCount + statistics.adaptiveKmdWaitCount + statistics.adaptiveProbeCount;
+    for (uint32_t bucket = 0; bucket < KmdNotifyConstants::adaptiveHistogramBucketCount; bucket++) {
+        statistics.waitDurationHistogram[bucket] = waitDurationHistogram[bucket].load();
+    }
+}
+
 void KmdNotifyHelper::updateLastWaitForCompletionTimestamp() {
     lastWaitForCompletionTimestampUs = getMicrosecondsSinceEpoch();
 }
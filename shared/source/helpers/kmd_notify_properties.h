@@ -34,12 +34,29 @@ struct KmdNotifyProperties {
 namespace KmdNotifyConstants {
 inline constexpr int64_t timeoutInMicrosecondsForDisconnectedAcLine = 10000;
 inline constexpr uint32_t minimumTaskCountDiffToCheckAcLine = 10;
+inline constexpr uint32_t adaptiveHistogramBucketCount = 24;
+inline constexpr uint64_t adaptiveMinimumSampleCount = 16;
+inline constexpr uint64_t adaptiveHistogramAgingSampleCount = 1024;
+inline constexpr int32_t adaptiveDefaultPercentile = 90;
+inline constexpr uint64_t adaptiveProbeInterval = 16;
 } // namespace KmdNotifyConstants
 
+struct KmdNotifyStatistics {
+    uint64_t adaptiveDecisionCount = 0;
+    // Polling was shortened to cover the configured percentile of observed waits
+    uint64_t adaptivePollCount = 0;
+    // Observed waits exceed the base delay, polling was skipped in favor of KMD wait
+    uint64_t adaptiveKmdWaitCount = 0;
+    // Observed waits exceed the base delay, but the base delay was polled to check if waits got shorter
+    uint64_t adaptiveProbeCount = 0;
+    // Bucket i holds waits shorter than 2^i microseconds, the last one holds all longer waits
+    uint64_t waitDurationHistogram[KmdNotifyConstants::adaptiveHistogramBucketCount] = {};
+};
+
 class KmdNotifyHelper {
   public:
     KmdNotifyHelper() = delete;
-    KmdNotifyHelper(const KmdNotifyProperties *properties) : properties(properties){};
+    KmdNotifyHelper(const KmdNotifyProperties *properties);
     MOCKABLE_VIRTUAL ~KmdNotifyHelper() = default;
 
     WaitParams obtainTimeoutParams(bool quickKmdSleepRequest,
@@ -54,6 +71,10 @@ class KmdNotifyHelper {
     MOCKABLE_VIRTUAL void updateLastWaitForCompletionTimestamp();
     MOCKABLE_VIRTUAL void updateAcLineStatus();
 
+    bool adaptivePolicyEnabled() const { return adaptivePolicy; }
+    void recordWaitDuration(int64_t waitDurationUs);
+    void getStatistics(KmdNotifyStatistics &statistics) const;
+
     static void overrideFromDebugVariable(int32_t debugVariableValue, int64_t &destination);
     static void overrideFromDebugVariable(int32_t debugVariableValue, bool &destination);
 
@@ -61,9 +82,19 @@ class KmdNotifyHelper {
     bool applyQuickKmdSleepForSporadicWait() const;
     int64_t getBaseTimeout(const int64_t &multiplier) const;
     int64_t getMicrosecondsSinceEpoch() const;
+    int64_t obtainAdaptiveTimeout(int64_t baseTimeout);
 
     const KmdNotifyProperties *properties = nullptr;
     std::atomic<int64_t> lastWaitForCompletionTimestampUs{0};
     std::atomic<bool> acLineConnected{true};
+
+    bool adaptivePolicy = false;
+    int32_t adaptivePercentile = KmdNotifyConstants::adaptiveDefaultPercentile;
+    std::atomic<uint64_t> waitDurationHistogram[KmdNotifyConstants::adaptiveHistogramBucketCount] = {};
+    std::atomic<uint64_t> waitDurationSampleCount{0};
+    std::atomic<uint64_t> adaptivePollCount{0};
+    std::atomic<uint64_t> adaptiveKmdWaitCount{0};
+    std::atomic<uint64_t> adaptiveProbeCount{0};
+    std::atomic<uint64_t> adaptiveLongWaitDecisionCount{0};
 };
 } // namespace NEO
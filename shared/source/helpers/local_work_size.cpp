@@ -14,6 +14,7 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/work_size_info.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 
@@ -89,6 +90,60 @@ inline uint32_t factor<0>(size_t workItems, uint32_t workSize, uint32_t maxWorkG
     return workSize;
 }
 
+uint32_t computeDivisors(size_t value, uint32_t maxDivisor, uint32_t divisors[1024]) {
+    uint32_t count = 0;
+    divisors[count++] = 1;
+
+    if (value == 0) {
+        for (uint32_t candidate = 2; candidate <= maxDivisor; candidate++) {
+            divisors[count++] = candidate;
+        }
+        return count;
+    }
+
+    // Build divisors from the prime factorization instead of testing every candidate up to maxDivisor.
+    // Prime factors above maxDivisor cannot be part of any divisor we are interested in.
+    auto addPrimePower = [&](uint64_t prime, uint32_t exponent) {
+        const uint32_t existingCount = count;
+        uint64_t multiplier = 1;
+        for (uint32_t power = 0; power < exponent; power++) {
+            multiplier *= prime;
+            if (multiplier > maxDivisor) {
+                break;
+            }
+            for (uint32_t i = 0; i < existingCount; i++) {
+                uint64_t divisor = divisors[i] * multiplier;
+                if (divisor <= maxDivisor) {
+                    divisors[count++] = static_cast<uint32_t>(divisor);
+                }
+            }
+        }
+    };
+
+    uint64_t remaining = value;
+    uint32_t exponent = 0;
+    while ((remaining & 1) == 0) {
+        remaining >>= 1;
+        exponent++;
+    }
+    addPrimePower(2, exponent);
+
+    for (uint64_t prime = 3; prime <= maxDivisor && prime * prime <= remaining; prime += 2) {
+        exponent = 0;
+        while ((remaining % prime) == 0) {
+            remaining /= prime;
+            exponent++;
+        }
+        addPrimePower(prime, exponent);
+    }
+    if (remaining > 1 && remaining <= maxDivisor) {
+        addPrimePower(remaining, 1);
+    }
+
+    std::sort(divisors, divisors + count);
+    return count;
+}
+
 void computePowerOfTwoLWS(const size_t workItems[3], WorkSizeInfo &workGroupInfo, size_t workGroupSize[3], const uint32_t workDim, bool canUseNx4) {
     uint32_t targetIndex = (canUseNx4 || workGroupInfo.numThreadsPerSubSlice < highThreadCountThreshold) ? 2 : 0;
     auto arraySize = arrayCount(optimalHardwareThreadCountGeneric);
@@ -247,13 +302,11 @@ void choosePrefferedWorkgroupSize(WorkSizeInfo &wsInfo, size_t workGroupSize[3],
     // find all divisors for all dimensions
     uint32_t xyzFactors[3][1024];
     uint32_t xyzFactorsLen[3] = {};
-    for (int i = 0; i < 3; i++)
-        xyzFactors[i][xyzFactorsLen[i]++] = 1;
-    for (auto i = 0u; i < workDim; i++) {
-        for (auto j = 2u; j < wsInfo.maxWorkGroupSize; ++j) {
-            if ((workItems[i] % j) == 0) {
-                xyzFactors[i][xyzFactorsLen[i]++] = j;
-            }
+    for (auto i = 0u; i < 3; i++) {
+        if (i < workDim) {
+            xyzFactorsLen[i] = computeDivisors(workItems[i], std::max(wsInfo.maxWorkGroupSize, 1u) - 1, xyzFactors[i]);
+        } else {
+            xyzFactors[i][xyzFactorsLen[i]++] = 1;
         }
     }
 
@@ -280,14 +333,11 @@ void computeWorkgroupSize2D(uint32_t maxWorkGroupSize, size_t workGroupSize[3],
     for (int i = 0; i < 3; i++)
         workGroupSize[i] = 1;
 
-    for (uint32_t i = 2; i <= maxWorkGroupSize; i++) {
-        if ((workItems[0] % i) == 0) {
-            xFactors[xFactorsLen++] = i;
-        }
-        if (((workItems[1] % i) == 0)) {
-            yFactors[yFactorsLen++] = i;
-        }
-    }
+    // Skip the trivial divisor 1, it is covered by the initial workGroupSize.
+    xFactorsLen = computeDivisors(workItems[0], maxWorkGroupSize, xFactors) - 1;
+    yFactorsLen = computeDivisors(workItems[1], maxWorkGroupSize, yFactors) - 1;
+    std::copy(xFactors + 1, xFactors + 1 + xFactorsLen, xFactors);
+    std::copy(yFactors + 1, yFactors + 1 + yFactorsLen, yFactors);
 
     for (uint32_t xFactorsIdx = 0; xFactorsIdx < xFactorsLen; ++xFactorsIdx) {
         for (uint32_t yFactorsIdx = 0; yFactorsIdx < yFactorsLen; ++yFactorsIdx) {
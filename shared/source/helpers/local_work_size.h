@@ -39,6 +39,8 @@ void computeWorkgroupSizeSquared(
     size_t simdSize,
     const uint32_t workDim);
 
+uint32_t computeDivisors(size_t value, uint32_t maxDivisor, uint32_t divisors[1024]);
+
 void choosePrefferedWorkgroupSize(WorkSizeInfo &wsInfo, size_t workGroupSize[3], const size_t workItems[3], const uint32_t workDim);
 
 Vec3<size_t> computeWorkgroupsNumber(
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/tiled_image_copy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/gmm_helper/gmm.h"
+#include "shared/source/gmm_helper/resource_info.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+namespace TiledImageCopy {
+
+namespace {
+size_t getOffsetInTileY(size_t x, size_t y) {
+    // 16 byte wide columns of 32 rows
+    return ((x / spanWidthInBytes) * tileHeight + y) * spanWidthInBytes + (x % spanWidthInBytes);
+}
+
+size_t getOffsetInTile4(size_t x, size_t y) {
+    // Offset bits are x[3:0], y[1:0], x[5:4], y[2], x[6], y[4:3]: 16B x 4 rows blocks form 512B blocks
+    // of 64B x 8 rows, laid out two per tile row
+    return (x & 0xf) |
+           ((y & 0x3) << 4) |
+           ((x & 0x30) << 2) |
+           ((y & 0x4) << 6) |
+           ((x & 0x40) << 3) |
+           ((y & 0x18) << 7);
+}
+
+template <bool linearToTiled>
+void copyImage(ImageTilingMode tilingMode, void *tiledPtr, size_t tiledRowPitch, size_t tiledSlicePitch,
+               void *linearPtr, size_t linearRowPitch, size_t linearSlicePitch,
+               size_t bytesPerPixel, const Vec3<size_t> &origin, const Vec3<size_t> &region) {
+    const size_t xStart = origin.x * bytesPerPixel;
+    const size_t xEnd = xStart + region.x * bytesPerPixel;
+
+    for (size_t slice = 0; slice < region.z; slice++) {
+        auto tiledSlice = ptrOffset(tiledPtr, (origin.z + slice) * tiledSlicePitch);
+        auto linearSlice = ptrOffset(linearPtr, slice * linearSlicePitch);
+
+        for (size_t row = 0; row < region.y; row++) {
+            const size_t y = origin.y + row;
+            auto linearRow = ptrOffset(linearSlice, row * linearRowPitch);
+
+            for (size_t x = xStart; x < xEnd;) {
+                size_t spanSize = xEnd - x;
+                if (tilingMode != ImageTilingMode::linear) {
+                    spanSize = std::min(spanSize, spanWidthInBytes - (x % spanWidthInBytes));
+                }
+                auto tiledSpan = ptrOffset(tiledSlice, getTiledOffset(tilingMode, x, y, tiledRowPitch));
+                auto linearSpan = ptrOffset(linearRow, x - xStart);
+                if (linearToTiled) {
+                    memcpy(tiledSpan, linearSpan, spanSize);
+                } else {
+                    memcpy(linearSpan, tiledSpan, spanSize);
+                }
+                x += spanSize;
+            }
+        }
+    }
+}
+} // namespace
+
+bool isCpuCopyPreferred(size_t copySize) {
+    if (DebugManager.flags.EnableCpuTiledImageCopy.get() != 1) {
+        return false;
+    }
+    size_t maxCpuCopySize = defaultMaxCpuCopySize;
+    if (DebugManager.flags.CpuTiledImageCopyMaxSize.get() != -1) {
+        maxCpuCopySize = static_cast<size_t>(DebugManager.flags.CpuTiledImageCopyMaxSize.get());
+    }
+    return copySize <= maxCpuCopySize;
+}
+
+bool isCpuCopySupported(const GraphicsAllocation &allocation, ImageTilingMode &tilingMode) {
+    if (!allocation.isAllocationLockable()) {
+        return false;
+    }
+    return getTilingMode(allocation.getDefaultGmm(), tilingMode);
+}
+
+bool getTilingMode(const Gmm *gmm, ImageTilingMode &tilingMode) {
+    if (gmm == nullptr) {
+        tilingMode = ImageTilingMode::linear;
+        return true;
+    }
+    if (gmm->isCompressionEnabled || gmm->hasMultisampleControlSurface()) {
+        return false;
+    }
+
+    auto &resourceFlags = gmm->gmmResourceInfo->getResourceFlags()->Info;
+    if (resourceFlags.RenderCompressed || resourceFlags.MediaCompressed) {
+        return false;
+    }
+    if (resourceFlags.Linear) {
+        tilingMode = ImageTilingMode::linear;
+        return true;
+    }
+    if (resourceFlags.Tile4) {
+        tilingMode = ImageTilingMode::tile4;
+        return true;
+    }
+    if (resourceFlags.TiledY && !resourceFlags.TiledYf && !resourceFlags.TiledYs) {
+        tilingMode = ImageTilingMode::tileY;
+        return true;
+    }
+    return false;
+}
+
+size_t getTiledOffset(ImageTilingMode tilingMode, size_t xInBytes, size_t y, size_t rowPitch) {
+    if (tilingMode == ImageTilingMode::linear) {
+        return y * rowPitch + xInBytes;
+    }
+
+    const size_t tileOffset = (y / tileHeight) * rowPitch * tileHeight + (xInBytes / tileWidthInBytes) * tileSizeInBytes;
+    const size_t xInTile = xInBytes % tileWidthInBytes;
+    const size_t yInTile = y % tileHeight;
+
+    if (tilingMode == ImageTilingMode::tile4) {
+        return tileOffset + getOffsetInTile4(xInTile, yInTile);
+    }
+    return tileOffset + getOffsetInTileY(xInTile, yInTile);
+}
+
+void copyLinearToTiled(ImageTilingMode tilingMode, void *tiledPtr, size_t tiledRowPitch, size_t tiledSlicePitch,
+                       const void *linearPtr, size_t linearRowPitch, size_t linearSlicePitch,
+                       size_t bytesPerPixel, const Vec3<size_t> &origin, const Vec3<size_t> &region) {
+    copyImage<true>(tilingMode, tiledPtr, tiledRowPitch, tiledSlicePitch,
+                    const_cast<void *>(linearPtr), linearRowPitch, linearSlicePitch,
+                    bytesPerPixel, origin, region);
+}
+
+void copyTiledToLinear(ImageTilingMode tilingMode, const void *tiledPtr, size_t tiledRowPitch, size_t tiledSlicePitch,
+                       void *linearPtr, size_t linearRowPitch, size_t linearSlicePitch,
+                       size_t bytesPerPixel, const Vec3<size_t> &origin, const Vec3<size_t> &region) {
+    copyImage<false>(tilingMode, const_cast<void *>(tiledPtr), tiledRowPitch, tiledSlicePitch,
+                     linearPtr, linearRowPitch, linearSlicePitch,
+                     bytesPerPixel, origin, region);
+}
+
+} // namespace TiledImageCopy
+} // namespace NEO
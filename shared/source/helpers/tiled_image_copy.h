@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/vec.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+class GraphicsAllocation;
+class Gmm;
+
+enum class ImageTilingMode : uint32_t {
+    linear,
+    tileY,
+    tile4
+};
+
+// CPU copies between linear memory and images stored in linear, TileY or Tile4 layout.
+// Both tile layouts use 4KB tiles of 128 bytes x 32 rows built from 16 byte wide spans,
+// so copies are done span by span with the tiled offset computed for each span.
+namespace TiledImageCopy {
+inline constexpr size_t tileWidthInBytes = 128;
+inline constexpr size_t tileHeight = 32;
+inline constexpr size_t tileSizeInBytes = tileWidthInBytes * tileHeight;
+inline constexpr size_t spanWidthInBytes = 16;
+inline constexpr size_t defaultMaxCpuCopySize = 64 * MemoryConstants::kiloByte;
+
+bool isCpuCopyPreferred(size_t copySize);
+bool isCpuCopySupported(const GraphicsAllocation &allocation, ImageTilingMode &tilingMode);
+bool getTilingMode(const Gmm *gmm, ImageTilingMode &tilingMode);
+size_t getTiledOffset(ImageTilingMode tilingMode, size_t xInBytes, size_t y, size_t rowPitch);
+
+void copyLinearToTiled(ImageTilingMode tilingMode, void *tiledPtr, size_t tiledRowPitch, size_t tiledSlicePitch,
+                       const void *linearPtr, size_t linearRowPitch, size_t linearSlicePitch,
+                       size_t bytesPerPixel, const Vec3<size_t> &origin, const Vec3<size_t> &region);
+void copyTiledToLinear(ImageTilingMode tilingMode, const void *tiledPtr, size_t tiledRowPitch, size_t tiledSlicePitch,
+                       void *linearPtr, size_t linearRowPitch, size_t linearSlicePitch,
+                       size_t bytesPerPixel, const Vec3<size_t> &origin, const Vec3<size_t> &region);
+} // namespace TiledImageCopy
+
+} // namespace NEO
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/cpu_memcpy.h"
+
+#include "shared/source/utilities/cpu_info.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <emmintrin.h>
+
+namespace NEO {
+
+namespace {
+// SSE2 is baseline on x86_64, streaming loads require SSE4.1 so reads use regular copy
+void cpuMemcpyToLockedMemorySse2(void *dst, const void *src, size_t size) {
+    constexpr size_t vectorSize = sizeof(__m128i);
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = std::min(size, (vectorSize - reinterpret_cast<uintptr_t>(dstBytes) % vectorSize) % vectorSize);
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    for (; size >= vectorSize; size -= vectorSize, dstBytes += vectorSize, srcBytes += vectorSize) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes)));
+    }
+    _mm_sfence();
+
+    memcpy(dstBytes, srcBytes, size);
+}
+
+void cpuMemcpyFromLockedMemoryDefault(void *dst, const void *src, size_t size) {
+    memcpy(dst, src, size);
+}
+} // namespace
+
+void (*CpuMemcpyHelper::copyToLockedMemory)(void *dst, const void *src, size_t size) = cpuMemcpyToLockedMemorySse2;
+void (*CpuMemcpyHelper::copyFromLockedMemory)(void *dst, const void *src, size_t size) = cpuMemcpyFromLockedMemoryDefault;
+
+// Initialize copy functions based on CPU capabilities
+CpuMemcpyHelper::CpuMemcpyHelper() {
+    bool supportsAVX2 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2);
+    if (supportsAVX2) {
+        CpuMemcpyHelper::copyToLockedMemory = cpuMemcpyToLockedMemoryAvx2;
+        CpuMemcpyHelper::copyFromLockedMemory = cpuMemcpyFromLockedMemoryAvx2;
+    }
+}
+
+CpuMemcpyHelper CpuMemcpyHelper::initializer;
+
+} // namespace NEO
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#if __AVX2__
+#include "shared/source/helpers/cpu_memcpy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+namespace NEO {
+
+namespace {
+constexpr size_t vectorSize = sizeof(__m256i);
+
+size_t getHeadSize(const void *ptr, size_t size) {
+    return std::min(size, (vectorSize - reinterpret_cast<uintptr_t>(ptr) % vectorSize) % vectorSize);
+}
+} // namespace
+
+void cpuMemcpyToLockedMemoryAvx2(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    // Non-temporal stores require aligned destination
+    auto headSize = getHeadSize(dstBytes, size);
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    for (; size >= 4 * vectorSize; size -= 4 * vectorSize, dstBytes += 4 * vectorSize, srcBytes += 4 * vectorSize) {
+        auto data0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes));
+        auto data1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + vectorSize));
+        auto data2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 2 * vectorSize));
+        auto data3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 3 * vectorSize));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes), data0);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + vectorSize), data1);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 2 * vectorSize), data2);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 3 * vectorSize), data3);
+    }
+    for (; size >= vectorSize; size -= vectorSize, dstBytes += vectorSize, srcBytes += vectorSize) {
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes)));
+    }
+    _mm_sfence();
+
+    memcpy(dstBytes, srcBytes, size);
+}
+
+void cpuMemcpyFromLockedMemoryAvx2(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<uint8_t *>(const_cast<void *>(src));
+
+    // Streaming loads require aligned source
+    auto headSize = getHeadSize(srcBytes, size);
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    for (; size >= 4 * vectorSize; size -= 4 * vectorSize, dstBytes += 4 * vectorSize, srcBytes += 4 * vectorSize) {
+        auto data0 = _mm256_stream_load_si256(reinterpret_cast<__m256i *>(srcBytes));
+        auto data1 = _mm256_stream_load_si256(reinterpret_cast<__m256i *>(srcBytes + vectorSize));
+        auto data2 = _mm256_stream_load_si256(reinterpret_cast<__m256i *>(srcBytes + 2 * vectorSize));
+        auto data3 = _mm256_stream_load_si256(reinterpret_cast<__m256i *>(srcBytes + 3 * vectorSize));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes), data0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes + vectorSize), data1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes + 2 * vectorSize), data2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes + 3 * vectorSize), data3);
+    }
+    for (; size >= vectorSize; size -= vectorSize, dstBytes += vectorSize, srcBytes += vectorSize) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes), _mm256_stream_load_si256(reinterpret_cast<__m256i *>(srcBytes)));
+    }
+
+    memcpy(dstBytes, srcBytes, size);
+}
+
+} // namespace NEO
+#endif
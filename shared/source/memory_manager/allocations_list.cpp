@@ -10,8 +10,11 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include <algorithm>
+
 namespace {
 struct ReusableAllocationRequirements {
     const void *requiredPtr;
@@ -56,42 +59,199 @@ std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t req
     req.activeTileCount = (commandStreamReceiver == nullptr) ? 1u : commandStreamReceiver->getActivePartitions();
     req.tagOffset = (commandStreamReceiver == nullptr) ? 0u : commandStreamReceiver->getPostSyncWriteOffset();
     req.forceSystemMemoryFlag = forceSystemMemoryFlag;
-    GraphicsAllocation *a = nullptr;
-    GraphicsAllocation *retAlloc = processLocked<AllocationsList, &AllocationsList::detachAllocationImpl>(a, static_cast<void *>(&req));
-    return std::unique_ptr<GraphicsAllocation>(retAlloc);
+    std::lock_guard<std::mutex> lock(mtx);
+    return std::unique_ptr<GraphicsAllocation>(detachAllocationImpl(&req));
 }
 
-GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *, void *data) {
+GraphicsAllocation *AllocationsList::detachAllocationImpl(void *data) {
     ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
-    auto *curr = head;
-    while (curr != nullptr) {
-        if ((req->allocationType == curr->getAllocationType()) &&
-            (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize) &&
-            (curr->storageInfo.systemMemoryForced == req->forceSystemMemoryFlag)) {
-            if (req->csrTagAddress == nullptr) {
-                return removeOneImpl(curr, nullptr);
+    if (req->csrTagAddress != nullptr && orderingContextId == invalidContextId) {
+        setOrderingContext(req->contextId);
+    }
+    const bool canStopOnBusyAllocation = req->csrTagAddress != nullptr &&
+                                         this->allocationUsage != TEMPORARY_ALLOCATION &&
+                                         req->contextId == orderingContextId;
+
+    // Size classes below the required one cannot fit, larger classes are checked from the smallest one
+    auto bucketIt = reuseIndex.lower_bound(getIndexKey(req->allocationType, req->requiredMinimalSize));
+    const auto bucketEnd = reuseIndex.lower_bound(getIndexKey(static_cast<AllocationType>(static_cast<uint32_t>(req->allocationType) + 1), 0u));
+    for (; bucketIt != bucketEnd; ++bucketIt) {
+        auto &bucket = bucketIt->second;
+        for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+            auto curr = *it;
+            if ((curr->getUnderlyingBufferSize() < req->requiredMinimalSize) ||
+                (curr->storageInfo.systemMemoryForced != req->forceSystemMemoryFlag)) {
+                continue;
             }
-            if ((this->allocationUsage == TEMPORARY_ALLOCATION || checkTagAddressReady(req, curr)) &&
-                (req->requiredPtr == nullptr || req->requiredPtr == curr->getUnderlyingBuffer())) {
+            if (req->csrTagAddress != nullptr) {
+                if (this->allocationUsage != TEMPORARY_ALLOCATION && !checkTagAddressReady(req, curr)) {
+                    if (canStopOnBusyAllocation) {
+                        break;
+                    }
+                    continue;
+                }
+                if (req->requiredPtr != nullptr && req->requiredPtr != curr->getUnderlyingBuffer()) {
+                    continue;
+                }
                 if (this->allocationUsage == TEMPORARY_ALLOCATION) {
                     // We may not have proper task count yet, so set notReady to avoid releasing in a different thread
                     curr->updateTaskCount(CompletionStamp::notReady, req->contextId);
                 }
-                return removeOneImpl(curr, nullptr);
             }
+            bucket.erase(it);
+            if (bucket.empty()) {
+                reuseIndex.erase(bucketIt);
+            }
+            reuseStatistics.hitCount++;
+            return allocations.removeOne(*curr).release();
         }
-        curr = curr->next;
     }
+    reuseStatistics.missCount++;
     return nullptr;
 }
 
 void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
-    auto *curr = head;
+    auto *curr = detachNodes();
     while (curr != nullptr) {
         auto currNext = curr->next;
         neoDevice->getMemoryManager()->freeGraphicsMemory(curr);
         curr = currNext;
     }
-    head = nullptr;
+}
+
+void AllocationsList::pushFrontOne(GraphicsAllocation &node) {
+    std::lock_guard<std::mutex> lock(mtx);
+    allocations.pushFrontOne(node);
+    addToIndex(node, true);
+}
+
+void AllocationsList::pushTailOne(GraphicsAllocation &node) {
+    std::lock_guard<std::mutex> lock(mtx);
+    allocations.pushTailOne(node);
+    addToIndex(node, false);
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeOne(GraphicsAllocation &node) {
+    std::lock_guard<std::mutex> lock(mtx);
+    removeFromIndex(node);
+    return allocations.removeOne(node);
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeFrontOne() {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto head = allocations.peekHead();
+    if (head == nullptr) {
+        return nullptr;
+    }
+    removeFromIndex(*head);
+    return allocations.removeOne(*head);
+}
+
+GraphicsAllocation *AllocationsList::detachSequence(GraphicsAllocation &first, GraphicsAllocation &last) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto curr = &first; curr != nullptr; curr = curr->next) {
+        removeFromIndex(*curr);
+        if (curr == &last) {
+            break;
+        }
+    }
+    return allocations.detachSequence(first, last);
+}
+
+GraphicsAllocation *AllocationsList::detachNodes() {
+    std::lock_guard<std::mutex> lock(mtx);
+    reuseIndex.clear();
+    return allocations.detachNodes();
+}
+
+void AllocationsList::splice(GraphicsAllocation &nodes) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto curr = &nodes; curr != nullptr; curr = curr->next) {
+        addToIndex(*curr, false);
+    }
+    allocations.splice(nodes);
+}
+
+void AllocationsList::deleteAll() {
+    auto nodes = detachNodes();
+    if (nodes != nullptr) {
+        nodes->deleteThisAndAllNext();
+    }
+}
+
+GraphicsAllocation *AllocationsList::peekHead() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return allocations.peekHead();
+}
+
+GraphicsAllocation *AllocationsList::peekTail() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return allocations.peekTail();
+}
+
+bool AllocationsList::peekIsEmpty() {
+    return peekHead() == nullptr;
+}
+
+bool AllocationsList::peekContains(GraphicsAllocation &node) {
+    std::lock_guard<std::mutex> lock(mtx);
+    return allocations.peekContains(node);
+}
+
+AllocationsList::IndexKey AllocationsList::getIndexKey(AllocationType allocationType, size_t size) {
+    auto sizeClass = (size == 0u) ? 0u : Math::log2(static_cast<uint64_t>(size));
+    return (static_cast<IndexKey>(allocationType) << 8) | sizeClass;
+}
+
+bool AllocationsList::isOrderedBefore(const GraphicsAllocation *lhs, const GraphicsAllocation *rhs) const {
+    return lhs->getTaskCount(orderingContextId) < rhs->getTaskCount(orderingContextId);
+}
+
+void AllocationsList::addToIndex(GraphicsAllocation &allocation, bool front) {
+    auto &bucket = reuseIndex[getIndexKey(allocation.getAllocationType(), allocation.getUnderlyingBufferSize())];
+    if (orderingContextId != invalidContextId) {
+        auto compare = [this](const GraphicsAllocation *lhs, const GraphicsAllocation *rhs) { return isOrderedBefore(lhs, rhs); };
+        auto position = front ? std::lower_bound(bucket.begin(), bucket.end(), &allocation, compare)
+                              : std::upper_bound(bucket.begin(), bucket.end(), &allocation, compare);
+        bucket.insert(position, &allocation);
+    } else if (front) {
+        bucket.insert(bucket.begin(), &allocation);
+    } else {
+        bucket.push_back(&allocation);
+    }
+}
+
+void AllocationsList::removeFromIndex(GraphicsAllocation &allocation) {
+    auto removeFromBucket = [&allocation, this](std::map<IndexKey, IndexBucket>::iterator bucketIt) {
+        auto &bucket = bucketIt->second;
+        auto it = std::find(bucket.begin(), bucket.end(), &allocation);
+        if (it == bucket.end()) {
+            return false;
+        }
+        bucket.erase(it);
+        if (bucket.empty()) {
+            reuseIndex.erase(bucketIt);
+        }
+        return true;
+    };
+
+    auto bucketIt = reuseIndex.find(getIndexKey(allocation.getAllocationType(), allocation.getUnderlyingBufferSize()));
+    if (bucketIt != reuseIndex.end() && removeFromBucket(bucketIt)) {
+        return;
+    }
+    // Size or type changed while allocation was on the list
+    for (bucketIt = reuseIndex.begin(); bucketIt != reuseIndex.end(); ++bucketIt) {
+        if (removeFromBucket(bucketIt)) {
+            return;
+        }
+    }
+}
+
+void AllocationsList::setOrderingContext(uint32_t contextId) {
+    orderingContextId = contextId;
+    for (auto &bucket : reuseIndex) {
+        std::stable_sort(bucket.second.begin(), bucket.second.end(),
+                         [this](const GraphicsAllocation *lhs, const GraphicsAllocation *rhs) { return isOrderedBefore(lhs, rhs); });
+    }
 }
 } // namespace NEO
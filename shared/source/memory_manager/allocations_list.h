@@ -10,13 +10,22 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/idlist.h"
 
+#include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
 
-class AllocationsList : public IDList<GraphicsAllocation, true, true> {
+class AllocationsList {
   public:
+    struct ReuseStatistics {
+        uint64_t hitCount = 0;
+        uint64_t missCount = 0;
+    };
+
     AllocationsList() = default;
     AllocationsList(AllocationUsage allocationUsage);
 
@@ -24,9 +33,42 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, bool forceSystemMemoryFlag, CommandStreamReceiver *commandStreamReceiver, AllocationType allocationType);
     void freeAllGraphicsAllocations(Device *neoDevice);
 
-  private:
-    GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    void pushFrontOne(GraphicsAllocation &node);
+    void pushTailOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeFrontOne();
+    GraphicsAllocation *detachSequence(GraphicsAllocation &first, GraphicsAllocation &last);
+    GraphicsAllocation *detachNodes();
+    void splice(GraphicsAllocation &nodes);
+    void deleteAll();
+
+    GraphicsAllocation *peekHead();
+    GraphicsAllocation *peekTail();
+    bool peekIsEmpty();
+    bool peekContains(GraphicsAllocation &node);
+
+    ReuseStatistics getReuseStatistics() const { return reuseStatistics; }
+
+  protected:
+    // Allocations are indexed by allocation type and power of two size class.
+    // Each bucket is ordered by task count of ordering context, so readiness checks may stop on first busy allocation.
+    using IndexKey = uint64_t;
+    using IndexBucket = std::vector<GraphicsAllocation *>;
+    static constexpr uint32_t invalidContextId = std::numeric_limits<uint32_t>::max();
+
+    static IndexKey getIndexKey(AllocationType allocationType, size_t size);
+    bool isOrderedBefore(const GraphicsAllocation *lhs, const GraphicsAllocation *rhs) const;
+    void addToIndex(GraphicsAllocation &allocation, bool front);
+    void removeFromIndex(GraphicsAllocation &allocation);
+    void setOrderingContext(uint32_t contextId);
+    GraphicsAllocation *detachAllocationImpl(void *data);
 
+    // List and its reuse index are modified together under the same lock.
+    std::mutex mtx;
+    IDList<GraphicsAllocation, false, true> allocations;
+    std::map<IndexKey, IndexBucket> reuseIndex;
+    ReuseStatistics reuseStatistics;
+    uint32_t orderingContextId = invalidContextId;
     const AllocationUsage allocationUsage{REUSABLE_ALLOCATION};
 };
 } // namespace NEO
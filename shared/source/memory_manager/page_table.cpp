@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,23 +12,68 @@
 
 namespace NEO {
 
+PageTableNodeArena::~PageTableNodeArena() {
+    for (auto it = destructors.rbegin(); it != destructors.rend(); it++) {
+        it->second(it->first);
+    }
+}
+
+void *PageTableNodeArena::allocate(size_t size, size_t alignment) {
+    UNRECOVERABLE_IF(size > chunkSize);
+
+    if (!chunks.empty()) {
+        auto chunkBase = reinterpret_cast<uintptr_t>(chunks.back().get());
+        chunkOffset = alignUp(chunkBase + chunkOffset, alignment) - chunkBase;
+    }
+    if (chunks.empty() || chunkOffset + size > chunkSize) {
+        chunks.emplace_back(new uint8_t[chunkSize]);
+        chunkOffset = 0;
+    }
+
+    auto memory = chunks.back().get() + chunkOffset;
+    chunkOffset += size;
+    return memory;
+}
+
+void PTE::reserveEntries(size_t indexStart, size_t indexEnd, uint64_t entryBits, uint32_t memoryBank) {
+    bool updateEntryBits = entryBits != PageTableEntry::nonValidBits;
+    uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
+    newEntryBits |= 0x1;
+
+    size_t index = indexStart;
+    while (index <= indexEnd) {
+        if (entries[index] == 0x0) {
+            // Reserve the whole run of unmapped entries at once, so 64KB and 2MB runs stay physically contiguous.
+            size_t runEnd = index;
+            while (runEnd < indexEnd && entries[runEnd + 1] == 0x0) {
+                runEnd++;
+            }
+            uint64_t tmp = allocator->reservePage(memoryBank, (runEnd - index + 1) * pageSize, pageSize);
+            for (; index <= runEnd; index++) {
+                entries[index] = reinterpret_cast<void *>(tmp | newEntryBits);
+                tmp += pageSize;
+            }
+            continue;
+        }
+        if (updateEntryBits) {
+            entries[index] = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask) | newEntryBits);
+        }
+        index++;
+    }
+}
+
 uintptr_t PTE::map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank) {
     const size_t shift = 12;
     const auto mask = static_cast<uint32_t>(maxNBitValue(bits));
     size_t indexStart = (vm >> shift) & mask;
     size_t indexEnd = ((vm + size - 1) >> shift) & mask;
     uintptr_t res = -1;
-    bool updateEntryBits = entryBits != PageTableEntry::nonValidBits;
     uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
     newEntryBits |= 0x1;
 
+    reserveEntries(indexStart, indexEnd, entryBits, memoryBank);
+
     for (size_t index = indexStart; index <= indexEnd; index++) {
-        if (entries[index] == 0x0) {
-            uint64_t tmp = allocator->reserve4kPage(memoryBank);
-            entries[index] = reinterpret_cast<void *>(tmp | newEntryBits);
-        } else if (updateEntryBits) {
-            entries[index] = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask) | newEntryBits);
-        }
         res = std::min(reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask, res);
     }
     return (res & ~newEntryBits) + (vm & (pageSize - 1));
@@ -42,17 +87,10 @@ void PTE::pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits,
     size_t indexEnd = ((vm + size - 1) >> shift) & mask;
     uint64_t res = -1;
     uintptr_t rem = vm & (pageSize - 1);
-    bool updateEntryBits = entryBits != PageTableEntry::nonValidBits;
-    uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
-    newEntryBits |= 0x1;
+
+    reserveEntries(indexStart, indexEnd, entryBits, memoryBank);
 
     for (size_t index = indexStart; index <= indexEnd; index++) {
-        if (entries[index] == 0x0) {
-            uint64_t tmp = allocator->reserve4kPage(memoryBank);
-            entries[index] = reinterpret_cast<void *>(tmp | newEntryBits);
-        } else if (updateEntryBits) {
-            entries[index] = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask) | newEntryBits);
-        }
         res = reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask;
 
         size_t lSize = std::min(pageSize - rem, size);
@@ -64,6 +102,36 @@ void PTE::pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits,
     }
 }
 
+void PTE::rangeWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalkRanges &ranges, uint32_t memoryBank) {
+    const size_t shift = 12;
+    const auto mask = static_cast<uint32_t>(maxNBitValue(bits));
+    size_t indexStart = (vm >> shift) & mask;
+    size_t indexEnd = ((vm + size - 1) >> shift) & mask;
+    uintptr_t rem = vm & (pageSize - 1);
+
+    reserveEntries(indexStart, indexEnd, entryBits, memoryBank);
+
+    for (size_t index = indexStart; index <= indexEnd; index++) {
+        auto entry = reinterpret_cast<uintptr_t>(entries[index]);
+        uint64_t physAddress = ((entry & MemoryConstants::page4kEntryMask) & ~0x1) + rem;
+        uint64_t pageEntryBits = entry & MemoryConstants::pageMask;
+        size_t lSize = std::min(pageSize - rem, size);
+
+        if (!ranges.empty() &&
+            ranges.back().physAddress + ranges.back().size == physAddress &&
+            ranges.back().offset + ranges.back().size == offset &&
+            ranges.back().entryBits == pageEntryBits) {
+            ranges.back().size += lSize;
+        } else {
+            ranges.push_back({physAddress, lSize, offset, pageEntryBits});
+        }
+
+        size -= lSize;
+        offset += lSize;
+        rem = 0;
+    }
+}
+
 template class PageTable<class PDP, 3, 9>;
 template class PageTable<class PDE, 2, 2>;
 } // namespace NEO
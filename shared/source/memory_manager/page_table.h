@@ -6,17 +6,56 @@
  */
 
 #pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/memory_manager/physical_address_allocator.h"
 
 #include <array>
 #include <cinttypes>
 #include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
 
 namespace NEO {
 
 class GraphicsAllocation;
 
 typedef std::function<void(uint64_t addr, size_t size, size_t offset, uint64_t entryBits)> PageWalker;
+
+struct PageWalkRange {
+    uint64_t physAddress;
+    size_t size;
+    size_t offset;
+    uint64_t entryBits;
+};
+using PageWalkRanges = std::vector<PageWalkRange>;
+
+// Allocates page table nodes of a single tree from large chunks, so that
+// neighbouring nodes share cache lines and pages during the walk.
+// Nodes live until the arena is destroyed.
+class PageTableNodeArena : NonCopyableOrMovableClass {
+  public:
+    PageTableNodeArena() = default;
+    ~PageTableNodeArena();
+
+    template <class T>
+    T *create(PhysicalAddressAllocator *allocator) {
+        auto node = new (allocate(sizeof(T), alignof(T))) T(allocator);
+        destructors.emplace_back(node, [](void *node) { static_cast<T *>(node)->~T(); });
+        return node;
+    }
+
+    static constexpr size_t chunkSize = 64 * MemoryConstants::pageSize;
+
+  protected:
+    void *allocate(size_t size, size_t alignment);
+
+    std::vector<std::unique_ptr<uint8_t[]>> chunks;
+    size_t chunkOffset = chunkSize;
+    std::vector<std::pair<void *, void (*)(void *)>> destructors;
+};
+
 template <class T, uint32_t level, uint32_t bits = 9>
 class PageTable {
   public:
@@ -25,12 +64,21 @@ class PageTable {
     };
 
     virtual ~PageTable() {
-        for (auto &e : entries)
-            delete e;
+        if (nodeArena == nullptr) {
+            for (auto &e : entries)
+                delete e;
+        }
     }
 
     virtual uintptr_t map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank);
     virtual void pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank);
+    virtual void rangeWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalkRanges &ranges, uint32_t memoryBank);
+
+    // Must be called on the root before anything is mapped.
+    void enableNodeArena() {
+        ownedNodeArena = std::make_unique<PageTableNodeArena>();
+        nodeArena = ownedNodeArena.get();
+    }
 
     static const size_t pageSize = 1 << 12;
     static size_t getBits() {
@@ -38,8 +86,15 @@ class PageTable {
     }
 
   protected:
+    template <class, uint32_t, uint32_t>
+    friend class PageTable;
+
+    T *getOrCreateEntry(size_t index);
+
     std::array<T *, 1 << bits> entries;
     PhysicalAddressAllocator *allocator = nullptr;
+    PageTableNodeArena *nodeArena = nullptr;
+    std::unique_ptr<PageTableNodeArena> ownedNodeArena;
 };
 
 template <>
@@ -52,9 +107,13 @@ class PTE : public PageTable<void, 0u> {
 
     uintptr_t map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank) override;
     void pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank) override;
+    void rangeWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalkRanges &ranges, uint32_t memoryBank) override;
 
     static const uint32_t level = 0;
     static const uint32_t bits = 9;
+
+  protected:
+    void reserveEntries(size_t indexStart, size_t indexEnd, uint64_t entryBits, uint32_t memoryBank);
 };
 
 class PDE : public PageTable<class PTE, 1> {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,23 @@ template <>
 inline void PageTable<void, 0, 9>::pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank) {
 }
 
+template <>
+inline void PageTable<void, 0, 9>::rangeWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalkRanges &ranges, uint32_t memoryBank) {
+}
+
+template <class T, uint32_t level, uint32_t bits>
+inline T *PageTable<T, level, bits>::getOrCreateEntry(size_t index) {
+    if (entries[index] == nullptr) {
+        if (nodeArena != nullptr) {
+            entries[index] = nodeArena->create<T>(allocator);
+            entries[index]->nodeArena = nodeArena;
+        } else {
+            entries[index] = new T(allocator);
+        }
+    }
+    return entries[index];
+}
+
 template <class T, uint32_t level, uint32_t bits>
 inline uintptr_t PageTable<T, level, bits>::map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank) {
     const size_t shift = T::getBits() + 12;
@@ -37,10 +54,7 @@ inline uintptr_t PageTable<T, level, bits>::map(uintptr_t vm, size_t size, uint6
         uintptr_t vmEnd = (uintptr_t(1) << shift) * (index + 1) - 1;
         vmEnd = std::min(vmEnd, maskedVm + size - 1);
 
-        if (entries[index] == nullptr) {
-            entries[index] = new T(allocator);
-        }
-        res = std::min((entries[index])->map(vmStart, vmEnd - vmStart + 1, entryBits, memoryBank), res);
+        res = std::min(getOrCreateEntry(index)->map(vmStart, vmEnd - vmStart + 1, entryBits, memoryBank), res);
     }
     return res;
 }
@@ -60,10 +74,28 @@ inline void PageTable<T, level, bits>::pageWalk(uintptr_t vm, size_t size, size_
         uintptr_t vmEnd = (uintptr_t(1) << shift) * (index + 1) - 1;
         vmEnd = std::min(vmEnd, maskedVm + size - 1);
 
-        if (entries[index] == nullptr) {
-            entries[index] = new T(allocator);
-        }
-        entries[index]->pageWalk(vmStart, vmEnd - vmStart + 1, offset, entryBits, pageWalker, memoryBank);
+        getOrCreateEntry(index)->pageWalk(vmStart, vmEnd - vmStart + 1, offset, entryBits, pageWalker, memoryBank);
+
+        offset += (vmEnd - vmStart + 1);
+    }
+}
+
+template <class T, uint32_t level, uint32_t bits>
+inline void PageTable<T, level, bits>::rangeWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalkRanges &ranges, uint32_t memoryBank) {
+    const size_t shift = T::getBits() + 12;
+    const uintptr_t mask = static_cast<uintptr_t>(maxNBitValue(bits));
+    size_t indexStart = (vm >> shift) & mask;
+    size_t indexEnd = ((vm + size - 1) >> shift) & mask;
+    uintptr_t vmMask = (uintptr_t(-1) >> (sizeof(void *) * 8 - shift - bits));
+    auto maskedVm = vm & vmMask;
+
+    for (size_t index = indexStart; index <= indexEnd; index++) {
+        uintptr_t vmStart = (uintptr_t(1) << shift) * index;
+        vmStart = std::max(vmStart, maskedVm);
+        uintptr_t vmEnd = (uintptr_t(1) << shift) * (index + 1) - 1;
+        vmEnd = std::min(vmEnd, maskedVm + size - 1);
+
+        getOrCreateEntry(index)->rangeWalk(vmStart, vmEnd - vmStart + 1, offset, entryBits, ranges, memoryBank);
 
         offset += (vmEnd - vmStart + 1);
     }
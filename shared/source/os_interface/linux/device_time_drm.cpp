@@ -7,12 +7,18 @@
 
 #include "shared/source/os_interface/linux/device_time_drm.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/ioctl_helper.h"
 #include "shared/source/os_interface/os_interface.h"
 
+#include <algorithm>
+#include <cmath>
 #include <time.h>
 
 namespace NEO {
@@ -22,6 +28,14 @@ DeviceTimeDrm::DeviceTimeDrm(OSInterface *osInterface) {
         pDrm = osInterface->getDriverModel()->as<Drm>();
     }
     timestampTypeDetect();
+
+    interpolationEnabled = DebugManager.flags.EnableCpuGpuTimeInterpolation.get() == 1;
+    if (DebugManager.flags.CpuGpuTimeInterpolationMaxErrorNs.get() > 0) {
+        maxInterpolationErrorNs = static_cast<uint64_t>(DebugManager.flags.CpuGpuTimeInterpolationMaxErrorNs.get());
+    }
+    if (DebugManager.flags.CpuGpuTimeMaxCalibrationIntervalMs.get() > 0) {
+        maxCalibrationIntervalNs = std::max(static_cast<uint64_t>(DebugManager.flags.CpuGpuTimeMaxCalibrationIntervalMs.get()) * 1'000'000u, minCalibrationIntervalNs);
+    }
 }
 
 void DeviceTimeDrm::timestampTypeDetect() {
@@ -102,6 +116,93 @@ bool DeviceTimeDrm::getCpuGpuTime(TimeStampData *pGpuCpuTime, OSTime *osTime) {
     if (nullptr == this->getGpuTime) {
         return false;
     }
+    if (!interpolationEnabled) {
+        return getCpuGpuTimeFromDevice(pGpuCpuTime, osTime);
+    }
+
+    uint64_t cpuTimeInNs = 0;
+    if (!osTime->getCpuTime(&cpuTimeInNs)) {
+        return false;
+    }
+
+    const auto timestampMask = getGpuTimestampMask();
+    {
+        std::lock_guard<std::mutex> lock(clockModelMutex);
+        if (gpuTicksPerNs > 0.0 &&
+            cpuTimeInNs >= calibrationSample.CPUTimeinNS &&
+            cpuTimeInNs - calibrationSample.CPUTimeinNS < calibrationIntervalNs) {
+            const auto elapsedNs = cpuTimeInNs - calibrationSample.CPUTimeinNS;
+            pGpuCpuTime->CPUTimeinNS = cpuTimeInNs;
+            pGpuCpuTime->GPUTimeStamp = (calibrationSample.GPUTimeStamp + static_cast<uint64_t>(elapsedNs * gpuTicksPerNs)) & timestampMask;
+            return true;
+        }
+    }
+
+    // register read is a syscall, so it is not done under the lock
+    if (!getCpuGpuTimeFromDevice(pGpuCpuTime, osTime)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(clockModelMutex);
+    calibrate(*pGpuCpuTime, timestampMask);
+    return true;
+}
+
+// Tracks the GPU to CPU clock ratio between consecutive register reads. The interval
+// between reads doubles while interpolation stays within the error bound and halves
+// when it drifts outside of it.
+void DeviceTimeDrm::calibrate(const TimeStampData &sample, uint64_t timestampMask) {
+    if (calibrationSampleValid && sample.CPUTimeinNS <= calibrationSample.CPUTimeinNS) {
+        // sampled by another thread before the current reference, nothing to learn from it
+        return;
+    }
+
+    // GPU timestamp wraps at its valid bits, a forward delta is at most half of the range
+    const auto gpuTicks = (sample.GPUTimeStamp - calibrationSample.GPUTimeStamp) & timestampMask;
+    const bool monotonic = calibrationSampleValid && gpuTicks > 0u && gpuTicks <= timestampMask / 2;
+    if (!monotonic) {
+        // first sample or timestamp going backwards, start over
+        gpuTicksPerNs = 0.0;
+        calibrationIntervalNs = minCalibrationIntervalNs;
+        calibrationSample = sample;
+        calibrationSampleValid = true;
+        return;
+    }
+
+    const auto elapsedNs = sample.CPUTimeinNS - calibrationSample.CPUTimeinNS;
+    if (gpuTicksPerNs == 0.0 && elapsedNs < minCalibrationIntervalNs) {
+        // too short to measure the clock ratio precisely, keep the older reference
+        return;
+    }
+
+    const double measuredTicksPerNs = static_cast<double>(gpuTicks) / elapsedNs;
+    if (gpuTicksPerNs > 0.0) {
+        const double errorNs = std::abs(elapsedNs * gpuTicksPerNs - static_cast<double>(gpuTicks)) / measuredTicksPerNs;
+        if (errorNs > maxInterpolationErrorNs) {
+            calibrationIntervalNs = std::max(calibrationIntervalNs / 2, minCalibrationIntervalNs);
+        } else if (errorNs * 2 < maxInterpolationErrorNs) {
+            calibrationIntervalNs = std::min(calibrationIntervalNs * 2, maxCalibrationIntervalNs);
+        }
+    }
+    gpuTicksPerNs = measuredTicksPerNs;
+    calibrationSample = sample;
+}
+
+uint64_t DeviceTimeDrm::getGpuTimestampMask() const {
+    uint32_t timestampValidBits = 64u;
+    if (pDrm) {
+        auto validBits = pDrm->getRootDeviceEnvironment().getHardwareInfo()->capabilityTable.timestampValidBits;
+        if (validBits > 0u && validBits < 64u) {
+            timestampValidBits = validBits;
+        }
+    }
+    if (getGpuTime == &DeviceTimeDrm::getGpuTime32) {
+        timestampValidBits = std::min(timestampValidBits, 32u);
+    }
+    return maxNBitValue(timestampValidBits);
+}
+
+bool DeviceTimeDrm::getCpuGpuTimeFromDevice(TimeStampData *pGpuCpuTime, OSTime *osTime) {
     if (!(this->*getGpuTime)(&pGpuCpuTime->GPUTimeStamp)) {
         return false;
     }
@@ -8,6 +8,8 @@
 #pragma once
 #include "shared/source/os_interface/os_time.h"
 
+#include <mutex>
+
 namespace NEO {
 class Drm;
 
@@ -24,8 +26,25 @@ class DeviceTimeDrm : public DeviceTime {
     double getDynamicDeviceTimerResolution(HardwareInfo const &hwInfo) const override;
     uint64_t getDynamicDeviceTimerClock(HardwareInfo const &hwInfo) const override;
 
+    static constexpr uint64_t defaultMaxInterpolationErrorNs = 1000u;
+    static constexpr uint64_t defaultMaxCalibrationIntervalNs = 100'000'000u;
+    static constexpr uint64_t minCalibrationIntervalNs = 1'000'000u;
+
   protected:
+    bool getCpuGpuTimeFromDevice(TimeStampData *pGpuCpuTime, OSTime *osTime);
+    void calibrate(const TimeStampData &sample, uint64_t timestampMask);
+    uint64_t getGpuTimestampMask() const;
+
     Drm *pDrm = nullptr;
+
+    std::mutex clockModelMutex;
+    TimeStampData calibrationSample = {};
+    double gpuTicksPerNs = 0.0;
+    uint64_t calibrationIntervalNs = minCalibrationIntervalNs;
+    uint64_t maxCalibrationIntervalNs = defaultMaxCalibrationIntervalNs;
+    uint64_t maxInterpolationErrorNs = defaultMaxInterpolationErrorNs;
+    bool calibrationSampleValid = false;
+    bool interpolationEnabled = false;
 };
 
 } // namespace NEO
@@ -100,6 +100,10 @@ BufferObject::BufferObject(Drm *drm, uint64_t patIndex, BufferObjectHandleWrappe
         bindInfo.resize(1);
         bindInfo[0].fill(false);
     }
+
+    if (DebugManager.flags.EnableExecObjectCaching.get() == 1) {
+        execObjectCache.resize(maxOsContextCount);
+    }
 }
 
 uint32_t BufferObject::getRefCount() const {
@@ -179,10 +183,53 @@ void BufferObject::fillExecObject(ExecObject &execObject, OsContext *osContext,
     ioctlHelper->fillExecObject(execObject, this->handle.getBoHandle(), this->gpuAddress, drmContextId, this->bindInfo[osContextId][vmHandleId], this->isMarkedForCapture());
 }
 
+void BufferObject::fillExecObjectFromCache(ExecObject &execObject, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId) {
+    const auto contextId = osContext->getContextId();
+    if (contextId >= execObjectCache.size()) {
+        fillExecObject(execObject, osContext, vmHandleId, drmContextId);
+        return;
+    }
+
+    // Each OsContext is submitted under its own CSR lock, so a slot is never accessed concurrently.
+    auto &cachedExecObjects = execObjectCache[contextId];
+    if (!cachedExecObjects) {
+        cachedExecObjects = std::make_unique<CachedExecObjects>();
+    }
+    if (cachedExecObjects->osContext != osContext) {
+        cachedExecObjects->osContext = osContext;
+        for (auto &cachedEntry : cachedExecObjects->entries) {
+            cachedEntry.valid = false;
+        }
+    }
+
+    auto &cached = cachedExecObjects->entries[vmHandleId];
+    const auto osContextId = drm->isPerContextVMRequired() ? contextId : 0;
+    const bool bound = this->bindInfo[osContextId][vmHandleId];
+    const bool async = DebugManager.flags.UseAsyncDrmExec.get() == 1;
+    if (!cached.valid || cached.gpuAddress != this->gpuAddress || cached.boHandle != this->handle.getBoHandle() ||
+        cached.drmContextId != drmContextId || cached.bound != bound || cached.capture != this->isMarkedForCapture() || cached.async != async) {
+        fillExecObject(cached.execObject, osContext, vmHandleId, drmContextId);
+        cached.gpuAddress = this->gpuAddress;
+        cached.boHandle = this->handle.getBoHandle();
+        cached.drmContextId = drmContextId;
+        cached.bound = bound;
+        cached.capture = this->isMarkedForCapture();
+        cached.async = async;
+        cached.valid = true;
+    }
+    memcpy(&execObject, &cached.execObject, sizeof(ExecObject));
+}
+
 int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId,
                        BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, TaskCountType completionValue) {
-    for (size_t i = 0; i < residencyCount; i++) {
-        residency[i]->fillExecObject(execObjectsStorage[i], osContext, vmHandleId, drmContextId);
+    if (DebugManager.flags.EnableExecObjectCaching.get() == 1) {
+        for (size_t i = 0; i < residencyCount; i++) {
+            residency[i]->fillExecObjectFromCache(execObjectsStorage[i], osContext, vmHandleId, drmContextId);
+        }
+    } else {
+        for (size_t i = 0; i < residencyCount; i++) {
+            residency[i]->fillExecObject(execObjectsStorage[i], osContext, vmHandleId, drmContextId);
+        }
     }
     this->fillExecObject(execObjectsStorage[residencyCount], osContext, vmHandleId, drmContextId);
     auto ioctlHelper = drm->getIoctlHelper();
@@ -13,11 +13,13 @@
 #include "shared/source/memory_manager/definitions/engine_limits.h"
 #include "shared/source/memory_manager/memory_operations_status.h"
 #include "shared/source/os_interface/linux/cache_info.h"
+#include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include <array>
 #include <atomic>
 #include <cstddef>
+#include <memory>
 #include <mutex>
 #include <stdint.h>
 #include <utility>
@@ -25,8 +27,6 @@
 
 namespace NEO {
 
-struct ExecBuffer;
-struct ExecObject;
 class DrmMemoryManager;
 class Drm;
 class OsContext;
@@ -232,7 +232,23 @@ class BufferObject {
     bool requiresImmediateBinding = false;
     bool requiresExplicitResidency = false;
 
+    struct CachedExecObject {
+        ExecObject execObject{};
+        uint64_t gpuAddress = 0;
+        int boHandle = -1;
+        uint32_t drmContextId = 0;
+        bool bound = false;
+        bool capture = false;
+        bool async = false;
+        bool valid = false;
+    };
+    struct CachedExecObjects {
+        OsContext *osContext = nullptr;
+        std::array<CachedExecObject, EngineLimits::maxHandleCount> entries;
+    };
+
     MOCKABLE_VIRTUAL void fillExecObject(ExecObject &execObject, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
+    void fillExecObjectFromCache(ExecObject &execObject, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
     void printBOBindingResult(OsContext *osContext, uint32_t vmHandleId, bool bind, int retVal);
 
     void *lockedAddress; // CPU side virtual address
@@ -249,6 +265,9 @@ class BufferObject {
     size_t colourChunk = 0;
     std::vector<uint64_t> bindAddresses;
 
+    // Encoded exec objects indexed by OsContext id, allocated on first exec on given context and dropped when another OsContext takes the id.
+    std::vector<std::unique_ptr<CachedExecObjects>> execObjectCache;
+
   private:
     uint64_t gpuAddress = 0llu;
 };
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <poll.h>
 #include <sys/mman.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
 
 namespace NEO {
@@ -34,5 +35,10 @@ int fcntl(int fd, int cmd);
 int fcntl(int fd, int cmd, int arg);
 char *realpath(const char *path, char *buf);
 int pipe(int pipefd[2]);
+int socket(int domain, int type, int protocol);
+int connect(int sockfd, const struct sockaddr *addr, socklen_t addrlen);
+ssize_t send(int sockfd, const void *buf, size_t len, int flags);
+ssize_t recv(int sockfd, void *buf, size_t len, int flags);
+int shutdown(int sockfd, int how);
 } // namespace SysCalls
 } // namespace NEO
@@ -13,6 +13,7 @@
 #include <poll.h>
 #include <stdio.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/sysmacros.h>
 #include <unistd.h>
@@ -113,5 +114,25 @@ int pipe(int pipeFd[2]) {
     return ::pipe(pipeFd);
 }
 
+int socket(int domain, int type, int protocol) {
+    return ::socket(domain, type, protocol);
+}
+
+int connect(int sockfd, const struct sockaddr *addr, socklen_t addrlen) {
+    return ::connect(sockfd, addr, addrlen);
+}
+
+ssize_t send(int sockfd, const void *buf, size_t len, int flags) {
+    return ::send(sockfd, buf, len, flags);
+}
+
+ssize_t recv(int sockfd, void *buf, size_t len, int flags) {
+    return ::recv(sockfd, buf, len, flags);
+}
+
+int shutdown(int sockfd, int how) {
+    return ::shutdown(sockfd, how);
+}
+
 } // namespace SysCalls
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,24 +13,126 @@
 
 namespace NEO {
 
+const PrintfFormatProgram &PrintfFormatCache::getProgram(uint32_t stringIndex, const char *formatString) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto programIt = programs.find(stringIndex);
+    if (programIt != programs.end()) {
+        return programIt->second;
+    }
+
+    auto &program = programs[stringIndex];
+    compileFormatString(formatString, program);
+    return program;
+}
+
+size_t PrintfFormatCache::getCachedProgramsCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return programs.size();
+}
+
+void PrintfFormatCache::compileFormatString(const char *formatString, PrintfFormatProgram &program) {
+    program.clear();
+    size_t length = strnlen_s(formatString, PrintFormatter::maxSinglePrintStringLength - 1);
+
+    std::string literal;
+    auto commitLiteral = [&]() {
+        if (!literal.empty()) {
+            program.emplace_back();
+            program.back().text = std::move(literal);
+            literal.clear();
+        }
+    };
+
+    for (size_t i = 0; i < length; i++) {
+        if (formatString[i] == '\\') {
+            auto escaped = PrintFormatter::escapeChar(formatString[++i]);
+            if (escaped == '\0') {
+                // trailing escape terminates the printed string
+                break;
+            }
+            literal += escaped;
+        } else if (formatString[i] == '%') {
+            if (i + 1 < length && formatString[i + 1] == '%') {
+                literal += '%';
+                i++;
+                continue;
+            }
+
+            size_t end = i;
+            while (PrintFormatter::isConversionSpecifier(formatString[end++]) == false && end < length)
+                ;
+
+            commitLiteral();
+            program.emplace_back();
+            auto &token = program.back();
+            token.isConversion = true;
+            token.isStringConversion = formatString[end - 1] == 's';
+            token.text.assign(formatString + i, end - i);
+
+            if (!token.isStringConversion) {
+                token.longFormat = token.text;
+                PrintFormatter::adjustLongFormatString(token.longFormat);
+
+                std::unique_ptr<char[]> strippedFormat(new char[token.text.size() + 1]);
+                PrintFormatter::stripVectorFormat(token.text.c_str(), strippedFormat.get());
+                PrintFormatter::stripVectorTypeConversion(strippedFormat.get());
+                token.vectorFormat = strippedFormat.get();
+                token.vectorLongFormat = token.vectorFormat;
+                PrintFormatter::adjustLongFormatString(token.vectorLongFormat);
+            }
+
+            i = end - 1;
+        } else {
+            literal += formatString[i];
+        }
+    }
+    commitLiteral();
+}
+
 PrintFormatter::PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
-                               bool using32BitPointers, const StringMap *stringLiteralMap)
+                               bool using32BitPointers, const StringMap *stringLiteralMap,
+                               PrintfFormatCache *formatCache)
     : printfOutputBuffer(printfOutputBuffer),
       printfOutputBufferSize(printfOutputBufferMaxSize),
+      printfOutputBufferMaxSize(printfOutputBufferMaxSize),
       using32BitPointers(using32BitPointers),
       usesStringMap(stringLiteralMap != nullptr),
       stringLiteralMap(stringLiteralMap) {
 
     output.reset(new char[maxSinglePrintStringLength]);
+
+    if (usesStringMap) {
+        if (formatCache == nullptr) {
+            ownedFormatCache = std::make_unique<PrintfFormatCache>();
+            formatCache = ownedFormatCache.get();
+        }
+        this->formatCache = formatCache;
+    }
 }
 
 void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print) {
     currentOffset = 0;
+    printfOutputBufferSize = printfOutputBufferMaxSize;
 
     // first 4 bytes of the buffer store the actual size of data that was written by printf from within EUs
     uint32_t printfOutputBufferSizeRead = 0;
     read(&printfOutputBufferSizeRead);
-    printfOutputBufferSize = std::min(printfOutputBufferSizeRead, printfOutputBufferSize);
+    printfOutputBufferSize = std::min(printfOutputBufferSizeRead, printfOutputBufferMaxSize);
+
+    printRecords(print);
+}
+
+uint32_t PrintFormatter::printKernelOutputRange(uint32_t startOffset, uint32_t endOffset, const std::function<void(char *)> &print) {
+    printfOutputBufferSize = std::min(endOffset, printfOutputBufferMaxSize);
+    currentOffset = startOffset;
+
+    printRecords(print);
+    return std::max(startOffset, std::min(currentOffset, printfOutputBufferSize));
+}
+
+void PrintFormatter::printRecords(const std::function<void(char *)> &print) {
+    outputBuffer.clear();
 
     if (usesStringMap) {
         uint32_t stringIndex = 0;
@@ -38,59 +140,50 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
             read(&stringIndex);
             const char *formatString = queryPrintfString(stringIndex);
             if (formatString != nullptr) {
-                printString(formatString, print);
+                printString(formatCache->getProgram(stringIndex, formatString));
             }
         }
     } else {
         while (currentOffset + sizeof(char *) <= printfOutputBufferSize) {
             char *formatString = nullptr;
             read(&formatString);
-            printString(formatString, print);
+            PrintfFormatCache::compileFormatString(formatString, scratchProgram);
+            printString(scratchProgram);
         }
     }
-}
 
-void PrintFormatter::printString(const char *formatString, const std::function<void(char *)> &print) {
-    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
+    // all records are flushed at once, output of a single print call is not interleaved with other writers
+    if (!outputBuffer.empty()) {
+        print(outputBuffer.data());
+    }
+}
 
+void PrintFormatter::printString(const PrintfFormatProgram &program) {
+    constexpr size_t maxCursor = maxSinglePrintStringLength - 1;
     size_t cursor = 0;
-    std::unique_ptr<char[]> dataFormat(new char[length + 1]);
-
-    for (size_t i = 0; i <= length; i++) {
-        if (formatString[i] == '\\')
-            output[cursor++] = escapeChar(formatString[++i]);
-        else if (formatString[i] == '%') {
-            size_t end = i;
-            if (end + 1 <= length && formatString[end + 1] == '%') {
-                output[cursor++] = '%';
-                i++;
-                continue;
-            }
 
-            while (isConversionSpecifier(formatString[end++]) == false && end < length)
-                ;
-
-            memcpy_s(dataFormat.get(), length, formatString + i, end - i);
-            dataFormat[end - i] = '\0';
-
-            if (formatString[end - 1] == 's')
-                cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
-            else
-                cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
-
-            i = end - 1;
+    for (const auto &token : program) {
+        if (token.isConversion == false) {
+            auto count = std::min(token.text.size(), maxCursor - cursor);
+            memcpy_s(output.get() + cursor, maxSinglePrintStringLength - cursor, token.text.c_str(), count);
+            cursor += count;
+        } else if (token.isStringConversion) {
+            cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, token.text.c_str());
         } else {
-            output[cursor++] = formatString[i];
+            cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, token);
         }
+        cursor = std::min(cursor, maxCursor);
     }
-    output[maxSinglePrintStringLength - 1] = '\0';
-    print(output.get());
+    output[cursor] = '\0';
+    outputBuffer.append(output.get());
 }
 
 void PrintFormatter::stripVectorFormat(const char *format, char *stripped) {
     while (*format != '\0') {
         if (*format != 'v') {
             *stripped = *format;
+        } else if (*(format + 1) == '\0') {
+            break;
         } else if (*(format + 1) != '1') {
             format += 2;
             continue;
@@ -113,24 +206,25 @@ void PrintFormatter::stripVectorTypeConversion(char *format) {
     }
 }
 
-template <>
-void PrintFormatter::adjustFormatString<int64_t>(std::string &formatString) {
+void PrintFormatter::adjustLongFormatString(std::string &formatString) {
     auto longPosition = formatString.find('l');
 
-    if (longPosition == std::string::npos) {
+    if (longPosition == std::string::npos || formatString.size() - 1 == longPosition) {
         return;
     }
-    UNRECOVERABLE_IF(formatString.size() - 1 == longPosition);
 
     if (formatString.at(longPosition + 1) != 'l') {
         formatString.insert(longPosition, "l");
     }
 }
 
-size_t PrintFormatter::printToken(char *output, size_t size, const char *formatString) {
+size_t PrintFormatter::printToken(char *output, size_t size, const PrintfFormatToken &token) {
     PRINTF_DATA_TYPE type(PRINTF_DATA_TYPE::INVALID);
     read(&type);
 
+    const char *formatString = token.text.c_str();
+    const char *vectorFormatString = token.vectorFormat.c_str();
+
     switch (type) {
     case PRINTF_DATA_TYPE::BYTE:
         return typedPrintToken<int8_t>(output, size, formatString);
@@ -141,23 +235,23 @@ size_t PrintFormatter::printToken(char *output, size_t size, const char *formatS
     case PRINTF_DATA_TYPE::FLOAT:
         return typedPrintToken<float>(output, size, formatString);
     case PRINTF_DATA_TYPE::LONG:
-        return typedPrintToken<int64_t>(output, size, formatString);
+        return typedPrintToken<int64_t>(output, size, token.longFormat.c_str());
     case PRINTF_DATA_TYPE::POINTER:
         return printPointerToken(output, size, formatString);
     case PRINTF_DATA_TYPE::DOUBLE:
         return typedPrintToken<double>(output, size, formatString);
     case PRINTF_DATA_TYPE::VECTOR_BYTE:
-        return typedPrintVectorToken<int8_t>(output, size, formatString);
+        return typedPrintVectorToken<int8_t>(output, size, vectorFormatString);
     case PRINTF_DATA_TYPE::VECTOR_SHORT:
-        return typedPrintVectorToken<int16_t>(output, size, formatString);
+        return typedPrintVectorToken<int16_t>(output, size, vectorFormatString);
     case PRINTF_DATA_TYPE::VECTOR_INT:
-        return typedPrintVectorToken<int>(output, size, formatString);
+        return typedPrintVectorToken<int>(output, size, vectorFormatString);
     case PRINTF_DATA_TYPE::VECTOR_LONG:
-        return typedPrintVectorToken<int64_t>(output, size, formatString);
+        return typedPrintVectorToken<int64_t>(output, size, token.vectorLongFormat.c_str());
     case PRINTF_DATA_TYPE::VECTOR_FLOAT:
-        return typedPrintVectorToken<float>(output, size, formatString);
+        return typedPrintVectorToken<float>(output, size, vectorFormatString);
     case PRINTF_DATA_TYPE::VECTOR_DOUBLE:
-        return typedPrintVectorToken<double>(output, size, formatString);
+        return typedPrintVectorToken<double>(output, size, vectorFormatString);
     default:
         return 0;
     }
@@ -15,8 +15,10 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 extern int memcpy_s(void *dst, size_t destSize, const void *src, size_t count); // NOLINT(readability-identifier-naming)
 
@@ -43,25 +45,63 @@ enum class PRINTF_DATA_TYPE : int {
 };
 static_assert(sizeof(PRINTF_DATA_TYPE) == sizeof(int));
 
+// Single piece of a parsed format string: either literal text (escapes already resolved)
+// or a conversion with all format variants the value type may require precomputed.
+struct PrintfFormatToken {
+    bool isConversion = false;
+    bool isStringConversion = false;
+    std::string text;             // literal text or conversion format as written in the kernel
+    std::string longFormat;       // conversion format adjusted for 64-bit integers
+    std::string vectorFormat;     // conversion format with vector size and type stripped
+    std::string vectorLongFormat; // vector format adjusted for 64-bit integers
+};
+
+using PrintfFormatProgram = std::vector<PrintfFormatToken>;
+
+// Compiled format strings of a single kernel, keyed by printf string index.
+class PrintfFormatCache {
+  public:
+    PrintfFormatCache() = default;
+    PrintfFormatCache(PrintfFormatCache &) = delete;
+    PrintfFormatCache &operator=(const PrintfFormatCache &other) = delete;
+
+    const PrintfFormatProgram &getProgram(uint32_t stringIndex, const char *formatString);
+    size_t getCachedProgramsCount() const;
+
+    static void compileFormatString(const char *formatString, PrintfFormatProgram &program);
+
+  protected:
+    std::unordered_map<uint32_t, PrintfFormatProgram> programs;
+    mutable std::mutex mutex;
+};
+
 class PrintFormatter {
   public:
     PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
-                   bool using32BitPointers, const StringMap *stringLiteralMap = nullptr);
+                   bool using32BitPointers, const StringMap *stringLiteralMap = nullptr,
+                   PrintfFormatCache *formatCache = nullptr);
     void printKernelOutput(const std::function<void(char *)> &print = [](char *str) { printToStdout(str); });
 
+    // Prints records stored between given offsets, returns offset past the last printed record.
+    uint32_t printKernelOutputRange(uint32_t startOffset, uint32_t endOffset,
+                                    const std::function<void(char *)> &print = [](char *str) { printToStdout(str); });
+
     constexpr static size_t maxSinglePrintStringLength = 16 * MemoryConstants::kiloByte;
 
   protected:
+    friend class PrintfFormatCache;
+
     const char *queryPrintfString(uint32_t index) const;
-    void printString(const char *formatString, const std::function<void(char *)> &print);
-    size_t printToken(char *output, size_t size, const char *formatString);
+    void printRecords(const std::function<void(char *)> &print);
+    void printString(const PrintfFormatProgram &program);
+    size_t printToken(char *output, size_t size, const PrintfFormatToken &token);
     size_t printStringToken(char *output, size_t size, const char *formatString);
     size_t printPointerToken(char *output, size_t size, const char *formatString);
 
-    char escapeChar(char escape);
-    bool isConversionSpecifier(char c);
-    void stripVectorFormat(const char *format, char *stripped);
-    void stripVectorTypeConversion(char *format);
+    static char escapeChar(char escape);
+    static bool isConversionSpecifier(char c);
+    static void stripVectorFormat(const char *format, char *stripped);
+    static void stripVectorTypeConversion(char *format);
 
     template <class T>
     bool read(T *value) {
@@ -80,36 +120,27 @@ class PrintFormatter {
         }
     }
 
-    template <class T>
-    void adjustFormatString(std::string &formatString) {}
+    static void adjustLongFormatString(std::string &formatString);
 
     template <class T>
-    size_t typedPrintToken(char *output, size_t size, const char *inputFormatString) {
+    size_t typedPrintToken(char *output, size_t size, const char *formatString) {
         T value{0};
         read(&value);
         currentOffset = alignUp(currentOffset, sizeof(uint32_t));
-        std::string formatString(inputFormatString);
-        adjustFormatString<T>(formatString);
-        return simpleSprintf(output, size, formatString.c_str(), value);
+        return simpleSprintf(output, size, formatString, value);
     }
 
     template <class T>
-    size_t typedPrintVectorToken(char *output, size_t size, const char *inputFormatString) {
+    size_t typedPrintVectorToken(char *output, size_t size, const char *formatString) {
         T value = {0};
         int valueCount = 0;
         read(&valueCount);
 
         size_t charactersPrinted = 0;
-        char strippedFormat[1024]{};
-
-        stripVectorFormat(inputFormatString, strippedFormat);
-        stripVectorTypeConversion(strippedFormat);
-        std::string formatString(strippedFormat);
-        adjustFormatString<T>(formatString);
 
         for (int i = 0; i < valueCount; i++) {
             read(&value);
-            charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, formatString.c_str(), value);
+            charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, formatString, value);
             if (i < valueCount - 1) {
                 charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, "%c", ',');
             }
@@ -123,9 +154,15 @@ class PrintFormatter {
     }
 
     std::unique_ptr<char[]> output;
+    std::string outputBuffer; // all records of a single printKernelOutput call, flushed at once
+
+    PrintfFormatCache *formatCache = nullptr;
+    std::unique_ptr<PrintfFormatCache> ownedFormatCache;
+    PrintfFormatProgram scratchProgram; // used for format strings that cannot be cached by index
 
     const uint8_t *printfOutputBuffer = nullptr; // buffer extracted from the kernel, contains values to be printed
     uint32_t printfOutputBufferSize = 0;         // size of the data contained in the buffer
+    const uint32_t printfOutputBufferMaxSize;
 
     bool using32BitPointers = false;
     const bool usesStringMap;
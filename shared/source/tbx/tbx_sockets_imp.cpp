@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/tbx/tbx_sockets_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -16,6 +17,8 @@
 #endif
 typedef int socklen_t;
 #else
+#include "shared/source/os_interface/linux/sys_calls.h"
+
 #include <arpa/inet.h>
 #include <netdb.h>
 #include <stdlib.h>
@@ -34,18 +37,26 @@ namespace NEO {
 
 TbxSocketsImp::TbxSocketsImp(std::ostream &err)
     : cerrStream(err) {
+    if (DebugManager.flags.TbxSocketsBatchWrites.get() == 1) {
+        batchSize = defaultBatchSize;
+        if (DebugManager.flags.TbxSocketsBatchSize.get() > 0) {
+            batchSize = static_cast<size_t>(DebugManager.flags.TbxSocketsBatchSize.get());
+        }
+        writeBatch.reserve(batchSize);
+    }
 }
 
 void TbxSocketsImp::close() {
     if (0 != m_socket) {
+        flushWrites();
 #ifdef WIN32
         ::shutdown(m_socket, 0x02 /*SD_BOTH*/);
 
         ::closesocket(m_socket);
         ::WSACleanup();
 #else
-        ::shutdown(m_socket, SHUT_RDWR);
-        ::close(m_socket);
+        SysCalls::shutdown(m_socket, SHUT_RDWR);
+        SysCalls::close(m_socket);
 #endif
         m_socket = 0;
     }
@@ -71,7 +82,11 @@ bool TbxSocketsImp::init(const std::string &hostNameOrIp, uint16_t port) {
         }
 #endif
 
+#ifdef WIN32
         m_socket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+#else
+        m_socket = SysCalls::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+#endif
         if (m_socket == INVALID_SOCKET) {
             logErrorInfo("Error at socket(): ");
             break;
@@ -120,7 +135,12 @@ bool TbxSocketsImp::connectToServer(const std::string &hostNameOrIp, uint16_t po
         clientService.sin_family = AF_INET;
         clientService.sin_port = htons(port);
 
-        if (::connect(m_socket, (SOCKADDR *)&clientService, sizeof(clientService)) == SOCKET_ERROR) {
+#ifdef WIN32
+        auto connectResult = ::connect(m_socket, (SOCKADDR *)&clientService, sizeof(clientService));
+#else
+        auto connectResult = SysCalls::connect(m_socket, (SOCKADDR *)&clientService, sizeof(clientService));
+#endif
+        if (connectResult == SOCKET_ERROR) {
             logErrorInfo("Failed to connect: ");
             cerrStream << "Is TBX server process running on host system [ " << hostNameOrIp.c_str()
                        << ", port " << port << "]?" << std::endl;
@@ -146,7 +166,7 @@ bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
         cmd.u.mmio_req.msg_type = MSG_TYPE_MMIO;
         cmd.u.mmio_req.size = sizeof(uint32_t);
 
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+        success = queueWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size, nullptr, 0) && flushWrites();
         if (!success) {
             break;
         }
@@ -183,7 +203,8 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
     cmd.u.mmio_req.write = 1;
     cmd.u.mmio_req.size = sizeof(uint32_t);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    // MMIO writes may kick off execution on the simulator, so they are never held back.
+    return queueWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size, nullptr, 0) && flushWrites();
 }
 
 bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
@@ -202,7 +223,7 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ));
+        success = queueWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ), nullptr, 0) && flushWrites();
         if (!success) {
             break;
         }
@@ -242,19 +263,10 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
     cmd.u.write_req.cacheline_disable = cmd.u.write_req.frontdoor;
     cmd.u.write_req.memory_type = type;
 
-    bool success;
-    do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ));
-        if (!success) {
-            break;
-        }
-
-        success = sendWriteData(data, size);
-        if (!success) {
-            cerrStream << "Problem sending write data?" << std::endl;
-            break;
-        }
-    } while (false);
+    bool success = queueWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ), data, size);
+    if (!success) {
+        cerrStream << "Problem sending write data?" << std::endl;
+    }
 
     DEBUG_BREAK_IF(!success);
     return success;
@@ -271,7 +283,42 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     cmd.u.gtt64_req.data = static_cast<uint32_t>(entry & 0xffffffff);
     cmd.u.gtt64_req.data_h = static_cast<uint32_t>(entry >> 32);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    return queueWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size, nullptr, 0);
+}
+
+bool TbxSocketsImp::queueWriteData(const void *header, size_t headerSize, const void *data, size_t dataSize) {
+    if (batchSize == 0) {
+        return sendWriteData(header, headerSize) &&
+               (dataSize == 0 || sendWriteData(data, dataSize));
+    }
+
+    if (writeBatch.size() + headerSize + dataSize > batchSize) {
+        if (!flushWrites()) {
+            return false;
+        }
+    }
+
+    auto headerBytes = reinterpret_cast<const char *>(header);
+    writeBatch.insert(writeBatch.end(), headerBytes, headerBytes + headerSize);
+
+    if (headerSize + dataSize > batchSize) {
+        // Payloads larger than the batch are sent in place instead of being copied.
+        return flushWrites() && sendWriteData(data, dataSize);
+    }
+
+    auto dataBytes = reinterpret_cast<const char *>(data);
+    writeBatch.insert(writeBatch.end(), dataBytes, dataBytes + dataSize);
+    return true;
+}
+
+bool TbxSocketsImp::flushWrites() {
+    if (writeBatch.empty()) {
+        return true;
+    }
+
+    auto success = sendWriteData(writeBatch.data(), writeBatch.size());
+    writeBatch.clear();
+    return success;
 }
 
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
@@ -279,7 +326,11 @@ bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
     auto dataBuffer = reinterpret_cast<const char *>(buffer);
 
     do {
+#ifdef WIN32
         auto bytesSent = ::send(m_socket, &dataBuffer[totalSent], static_cast<int>(sizeInBytes - totalSent), 0);
+#else
+        auto bytesSent = SysCalls::send(m_socket, &dataBuffer[totalSent], sizeInBytes - totalSent, 0);
+#endif
         if (bytesSent == 0 || bytesSent == WSAECONNRESET) {
             logErrorInfo("Connection Closed.");
             return false;
@@ -300,7 +351,11 @@ bool TbxSocketsImp::getResponseData(void *buffer, size_t sizeInBytes) {
     auto dataBuffer = static_cast<char *>(buffer);
 
     do {
+#ifdef WIN32
         auto bytesRecv = ::recv(m_socket, &dataBuffer[totalRecv], static_cast<int>(sizeInBytes - totalRecv), 0);
+#else
+        auto bytesRecv = SysCalls::recv(m_socket, &dataBuffer[totalRecv], sizeInBytes - totalRecv, 0);
+#endif
         if (bytesRecv == 0 || bytesRecv == WSAECONNRESET) {
             logErrorInfo("Connection Closed.");
             return false;
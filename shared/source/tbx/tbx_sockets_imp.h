@@ -6,12 +6,14 @@
  */
 
 #pragma once
+#include "shared/source/helpers/constants.h"
 #include "shared/source/tbx/tbx_sockets.h"
 
 #include "os_socket.h"
 
 #include <cstdint>
 #include <iostream>
+#include <vector>
 
 namespace NEO {
 
@@ -20,6 +22,8 @@ class TbxSocketsImp : public TbxSockets {
     TbxSocketsImp(std::ostream &err = std::cerr);
     ~TbxSocketsImp() override = default;
 
+    static constexpr size_t defaultBatchSize = 1 * MemoryConstants::megaByte;
+
     bool init(const std::string &hostNameOrIp, uint16_t port) override;
     void close() override;
 
@@ -31,12 +35,15 @@ class TbxSocketsImp : public TbxSockets {
     bool readMMIO(uint32_t offset, uint32_t *data) override;
     bool writeMMIO(uint32_t offset, uint32_t data) override;
 
+    bool flushWrites();
+
   protected:
     std::ostream &cerrStream;
     SOCKET m_socket = 0;
 
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
     bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    bool queueWriteData(const void *header, size_t headerSize, const void *data, size_t dataSize);
     bool getResponseData(void *buffer, size_t sizeInBytes);
 
     inline uint32_t getNextTransID() { return transID++; }
@@ -44,5 +51,10 @@ class TbxSocketsImp : public TbxSockets {
     void logErrorInfo(const char *tag);
 
     uint32_t transID = 0;
+
+    // Write requests need no response, so they are coalesced here and only sent
+    // when the batch is full or a read needs the server to be in sync.
+    std::vector<char> writeBatch;
+    size_t batchSize = 0;
 };
 } // namespace NEO
@@ -21,6 +21,7 @@ using namespace NEO;
 
 class TestedBufferObject : public BufferObject {
   public:
+    using BufferObject::execObjectCache;
     using BufferObject::handle;
     using BufferObject::tilingMode;
 
@@ -33,6 +34,7 @@ class TestedBufferObject : public BufferObject {
     void fillExecObject(ExecObject &execObject, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId) override {
         BufferObject::fillExecObject(execObject, osContext, vmHandleId, drmContextId);
         execObjectPointerFilled = &execObject;
+        fillExecObjectCalled++;
     }
 
     void setSize(size_t size) {
@@ -63,6 +65,7 @@ class TestedBufferObject : public BufferObject {
     ExecObject *execObjectPointerFilled = nullptr;
     TaskCountType receivedCompletionValue = 0;
     uint32_t execCalled = 0;
+    uint32_t fillExecObjectCalled = 0;
     bool callBaseEvictUnusedAllocations{true};
 };
 
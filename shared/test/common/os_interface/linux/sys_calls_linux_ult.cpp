@@ -64,6 +64,11 @@ ssize_t (*sysCallsWrite)(int fd, void *buf, size_t count) = nullptr;
 int (*sysCallsPipe)(int pipeFd[2]) = nullptr;
 int (*sysCallsFstat)(int fd, struct stat *buf) = nullptr;
 char *(*sysCallsRealpath)(const char *path, char *buf) = nullptr;
+int (*sysCallsSocket)(int domain, int type, int protocol) = nullptr;
+int (*sysCallsConnect)(int sockfd, const struct sockaddr *addr, socklen_t addrlen) = nullptr;
+ssize_t (*sysCallsSend)(int sockfd, const void *buf, size_t len, int flags) = nullptr;
+ssize_t (*sysCallsRecv)(int sockfd, void *buf, size_t len, int flags) = nullptr;
+int (*sysCallsShutdown)(int sockfd, int how) = nullptr;
 
 int close(int fileDescriptor) {
     closeFuncCalled++;
@@ -254,6 +259,41 @@ int pipe(int pipeFd[2]) {
     return 0;
 }
 
+int socket(int domain, int type, int protocol) {
+    if (sysCallsSocket != nullptr) {
+        return sysCallsSocket(domain, type, protocol);
+    }
+    return fakeFileDescriptor;
+}
+
+int connect(int sockfd, const struct sockaddr *addr, socklen_t addrlen) {
+    if (sysCallsConnect != nullptr) {
+        return sysCallsConnect(sockfd, addr, addrlen);
+    }
+    return 0;
+}
+
+ssize_t send(int sockfd, const void *buf, size_t len, int flags) {
+    if (sysCallsSend != nullptr) {
+        return sysCallsSend(sockfd, buf, len, flags);
+    }
+    return static_cast<ssize_t>(len);
+}
+
+ssize_t recv(int sockfd, void *buf, size_t len, int flags) {
+    if (sysCallsRecv != nullptr) {
+        return sysCallsRecv(sockfd, buf, len, flags);
+    }
+    return 0;
+}
+
+int shutdown(int sockfd, int how) {
+    if (sysCallsShutdown != nullptr) {
+        return sysCallsShutdown(sockfd, how);
+    }
+    return 0;
+}
+
 int fcntl(int fd, int cmd) {
     if (cmd == F_GETFL) {
         getFileDescriptorFlagsCalled++;
@@ -9,6 +9,7 @@
 
 #include <iostream>
 #include <poll.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
 #include <vector>
 
@@ -26,6 +27,11 @@ extern ssize_t (*sysCallsWrite)(int fd, void *buf, size_t count);
 extern int (*sysCallsPipe)(int pipeFd[2]);
 extern int (*sysCallsFstat)(int fd, struct stat *buf);
 extern char *(*sysCallsRealpath)(const char *path, char *buf);
+extern int (*sysCallsSocket)(int domain, int type, int protocol);
+extern int (*sysCallsConnect)(int sockfd, const struct sockaddr *addr, socklen_t addrlen);
+extern ssize_t (*sysCallsSend)(int sockfd, const void *buf, size_t len, int flags);
+extern ssize_t (*sysCallsRecv)(int sockfd, void *buf, size_t len, int flags);
+extern int (*sysCallsShutdown)(int sockfd, int how);
 
 extern const char *drmVersion;
 constexpr int fakeFileDescriptor = 123;
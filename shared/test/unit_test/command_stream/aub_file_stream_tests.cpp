@@ -31,7 +31,9 @@
 #include "gtest/gtest.h"
 #include "sys_calls.h"
 
+#include <cstdio>
 #include <fstream>
+#include <iterator>
 #include <memory>
 
 using namespace NEO;
@@ -1004,3 +1006,78 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWithAubManagerWhenInit
 
     EXPECT_EQ(expectedAddedComments, mockAubManager->receivedComments);
 }
+
+TEST(AubFileStreamAsyncWriteTests, givenAsyncWriteEnabledWhenDataIsWrittenThenFileContainsAllDataInOrderAfterFlush) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AubDumpAsyncWrite.set(1);
+    DebugManager.flags.AubDumpAsyncWriteBufferSize.set(16);
+
+    std::string fileName = "async_file_name.aub";
+    std::vector<char> expectedData(100);
+    for (size_t i = 0; i < expectedData.size(); i++) {
+        expectedData[i] = static_cast<char>(i);
+    }
+
+    AubMemDump::AubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+    ASSERT_TRUE(aubFileStream.isOpen());
+
+    aubFileStream.write(expectedData.data(), 7);
+    aubFileStream.write(expectedData.data() + 7, 50);
+    aubFileStream.write(expectedData.data() + 57, 43);
+    aubFileStream.flush();
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> fileData((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(expectedData, fileData);
+    file.close();
+
+    aubFileStream.write(expectedData.data(), 10);
+    aubFileStream.close();
+    EXPECT_FALSE(aubFileStream.isOpen());
+
+    file.open(fileName, std::ios::binary | std::ios::ate);
+    EXPECT_EQ(110, static_cast<int>(file.tellg()));
+    file.close();
+    std::remove(fileName.c_str());
+}
+
+TEST(AubFileStreamSkipUnchangedPagesTests, givenSkipUnchangedPagesEnabledWhenSamePageContentIsWrittenAgainThenWriteIsRedundant) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AubDumpSkipUnchangedPages.set(1);
+
+    std::string fileName = "skip_pages_file_name.aub";
+    AubMemDump::AubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+
+    uint32_t page[1024] = {};
+    const uint64_t physAddress = 0x10000;
+    const uint64_t gpuAddress = 0x20000;
+
+    EXPECT_FALSE(aubFileStream.isPageWriteRedundant(physAddress, gpuAddress, page, sizeof(page), 0u));
+    EXPECT_TRUE(aubFileStream.isPageWriteRedundant(physAddress, gpuAddress, page, sizeof(page), 0u));
+
+    page[17] = 1u;
+    EXPECT_FALSE(aubFileStream.isPageWriteRedundant(physAddress, gpuAddress, page, sizeof(page), 0u));
+    EXPECT_TRUE(aubFileStream.isPageWriteRedundant(physAddress, gpuAddress, page, sizeof(page), 0u));
+
+    EXPECT_FALSE(aubFileStream.isPageWriteRedundant(physAddress, gpuAddress, page, sizeof(page), 1u));
+    EXPECT_FALSE(aubFileStream.isPageWriteRedundant(physAddress, gpuAddress + MemoryConstants::pageSize, page, sizeof(page), 1u));
+    EXPECT_FALSE(aubFileStream.isPageWriteRedundant(physAddress + MemoryConstants::pageSize, gpuAddress + MemoryConstants::pageSize, page, sizeof(page), 1u));
+
+    aubFileStream.close();
+    std::remove(fileName.c_str());
+}
+
+TEST(AubFileStreamSkipUnchangedPagesTests, givenSkipUnchangedPagesDisabledWhenSamePageContentIsWrittenAgainThenWriteIsNotRedundant) {
+    std::string fileName = "skip_pages_file_name.aub";
+    AubMemDump::AubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+
+    uint32_t page[1024] = {};
+    EXPECT_FALSE(aubFileStream.isPageWriteRedundant(0x10000, 0x20000, page, sizeof(page), 0u));
+    EXPECT_FALSE(aubFileStream.isPageWriteRedundant(0x10000, 0x20000, page, sizeof(page), 0u));
+
+    aubFileStream.close();
+    std::remove(fileName.c_str());
+}
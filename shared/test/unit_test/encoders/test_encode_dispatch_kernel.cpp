@@ -1601,4 +1601,192 @@ HWTEST_F(CommandEncodeStatesTest, givenCommandContainerWhenIsKernelDispatchedFro
     dispatchArgs.isKernelDispatchedFromImmediateCmdList = true;
     EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
     EXPECT_NE(0u, cmdContainer->getHeapWithRequiredSizeAndAlignmentCalled);
-}
\ No newline at end of file
+}
+using DispatchKernelTemplatesTest = Test<CommandEncodeStatesFixture>;
+
+HWTEST_F(DispatchKernelTemplatesTest, givenDispatchKernelTemplatesDisabledWhenDispatchingKernelThenTemplateCacheIsNotUsed) {
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    uint32_t dims[] = {2, 1, 1};
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    EXPECT_EQ(0u, cmdContainer->getDispatchKernelTemplateCache().getHitCount());
+    EXPECT_EQ(0u, cmdContainer->getDispatchKernelTemplateCache().getMissCount());
+}
+
+HWTEST_F(DispatchKernelTemplatesTest, givenDispatchKernelTemplatesEnabledWhenDispatchingSameKernelWithDifferentGroupCountThenTemplateIsReusedAndGroupCountIsPatched) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableDispatchKernelTemplates.set(1);
+
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    uint32_t firstDims[] = {2, 1, 1};
+    uint32_t secondDims[] = {4, 3, 2};
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), firstDims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    dispatchArgs.threadGroupDimensions = secondDims;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    auto &templateCache = cmdContainer->getDispatchKernelTemplateCache();
+    EXPECT_EQ(1u, templateCache.getMissCount());
+    EXPECT_EQ(1u, templateCache.getHitCount());
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    auto walkers = findAll<WALKER_TYPE *>(commands.begin(), commands.end());
+    ASSERT_EQ(2u, walkers.size());
+
+    auto secondWalker = genCmdCast<WALKER_TYPE *>(*walkers[1]);
+    EXPECT_EQ(4u, secondWalker->getThreadGroupIdXDimension());
+    EXPECT_EQ(3u, secondWalker->getThreadGroupIdYDimension());
+    EXPECT_EQ(2u, secondWalker->getThreadGroupIdZDimension());
+}
+
+HWTEST_F(DispatchKernelTemplatesTest, givenDispatchKernelTemplatesEnabledWhenKernelStateChangesThenNewTemplateIsEncoded) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableDispatchKernelTemplates.set(1);
+
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    uint32_t dims[] = {2, 1, 1};
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    dispatchInterface->groupSizes[0] = 16;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    dispatchInterface->getSlmTotalSizeResult = 1024;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    auto &templateCache = cmdContainer->getDispatchKernelTemplateCache();
+    EXPECT_EQ(3u, templateCache.getMissCount());
+    EXPECT_EQ(0u, templateCache.getHitCount());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, DispatchKernelTemplatesTest, givenDispatchKernelTemplatesEnabledWhenDispatchingFromTemplateThenWalkerMatchesFullyEncodedWalker) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    DebugManagerStateRestore restore;
+
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    uint32_t firstDims[] = {2, 1, 1};
+    uint32_t secondDims[] = {4, 3, 2};
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), secondDims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    DebugManager.flags.EnableDispatchKernelTemplates.set(1);
+    dispatchArgs.threadGroupDimensions = firstDims;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    dispatchArgs.threadGroupDimensions = secondDims;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    EXPECT_EQ(1u, cmdContainer->getDispatchKernelTemplateCache().getHitCount());
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    auto walkers = findAll<WALKER_TYPE *>(commands.begin(), commands.end());
+    ASSERT_EQ(3u, walkers.size());
+
+    auto encodedWalker = *genCmdCast<WALKER_TYPE *>(*walkers[0]);
+    auto templateWalker = *genCmdCast<WALKER_TYPE *>(*walkers[2]);
+    encodedWalker.setIndirectDataStartAddress(0);
+    templateWalker.setIndirectDataStartAddress(0);
+    EXPECT_EQ(0, memcmp(&encodedWalker, &templateWalker, sizeof(WALKER_TYPE)));
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, DispatchKernelTemplatesTest, givenDispatchKernelTemplatesEnabledWhenDispatchingFromTemplateThenWalkerAndInterfaceDescriptorMatchFullyEncodedOnes) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+    DebugManagerStateRestore restore;
+
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    uint32_t firstDims[] = {2, 1, 1};
+    uint32_t secondDims[] = {4, 3, 2};
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), secondDims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    DebugManager.flags.EnableDispatchKernelTemplates.set(1);
+    dispatchArgs.threadGroupDimensions = firstDims;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    dispatchArgs.threadGroupDimensions = secondDims;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    EXPECT_EQ(1u, cmdContainer->getDispatchKernelTemplateCache().getHitCount());
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    auto walkers = findAll<WALKER_TYPE *>(commands.begin(), commands.end());
+    ASSERT_EQ(3u, walkers.size());
+
+    auto encodedWalker = *genCmdCast<WALKER_TYPE *>(*walkers[0]);
+    auto templateWalker = *genCmdCast<WALKER_TYPE *>(*walkers[2]);
+    auto interfaceDescriptors = static_cast<INTERFACE_DESCRIPTOR_DATA *>(cmdContainer->getIddBlock());
+    EXPECT_EQ(0, memcmp(&interfaceDescriptors[encodedWalker.getInterfaceDescriptorOffset()],
+                        &interfaceDescriptors[templateWalker.getInterfaceDescriptorOffset()],
+                        sizeof(INTERFACE_DESCRIPTOR_DATA)));
+
+    encodedWalker.setIndirectDataStartAddress(0);
+    encodedWalker.setInterfaceDescriptorOffset(0);
+    templateWalker.setIndirectDataStartAddress(0);
+    templateWalker.setInterfaceDescriptorOffset(0);
+    EXPECT_EQ(0, memcmp(&encodedWalker, &templateWalker, sizeof(WALKER_TYPE)));
+}
+
+HWTEST_F(DispatchKernelTemplatesTest, givenDispatchKernelTemplatesEnabledWhenDispatchingKernelRepeatedlyThenTemplateIsEncodedOnceAndPatchedForEachLaunch) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableDispatchKernelTemplates.set(1);
+
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    constexpr uint32_t launchCount = 100;
+    bool requiresUncachedMocs = false;
+    for (uint32_t i = 0; i < launchCount; i++) {
+        uint32_t dims[] = {i + 1, 1, 1};
+        EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+        EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    }
+
+    auto &templateCache = cmdContainer->getDispatchKernelTemplateCache();
+    EXPECT_EQ(1u, templateCache.getMissCount());
+    EXPECT_EQ(launchCount - 1, templateCache.getHitCount());
+
+    cmdContainer->reset();
+    uint32_t dims[] = {1, 1, 1};
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+    EXPECT_EQ(2u, templateCache.getMissCount());
+}
+
+TEST(DispatchKernelTemplateCacheTest, givenFullCacheWhenStoringNewTemplateThenOldestTemplateIsReplaced) {
+    DispatchKernelTemplateCache templateCache;
+    uint32_t data = 0;
+
+    DispatchKernelTemplateKey key;
+    for (uint32_t i = 0; i < DispatchKernelTemplateCache::maxTemplateCount; i++) {
+        key.crossThreadDataSize = i;
+        data = i;
+        templateCache.store(key, &data, sizeof(data));
+    }
+
+    key.crossThreadDataSize = DispatchKernelTemplateCache::maxTemplateCount;
+    templateCache.store(key, &data, sizeof(data));
+
+    key.crossThreadDataSize = 0;
+    EXPECT_EQ(nullptr, templateCache.find(key, sizeof(data)));
+
+    key.crossThreadDataSize = 1;
+    auto storedTemplate = templateCache.find(key, sizeof(data));
+    ASSERT_NE(nullptr, storedTemplate);
+    EXPECT_EQ(1u, *reinterpret_cast<const uint32_t *>(storedTemplate));
+
+    EXPECT_EQ(nullptr, templateCache.find(key, sizeof(uint64_t)));
+    EXPECT_EQ(1u, templateCache.getHitCount());
+    EXPECT_EQ(2u, templateCache.getMissCount());
+}
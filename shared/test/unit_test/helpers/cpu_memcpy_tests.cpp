@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/cpu_memcpy.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+
+using CopyFunction = void (*)(void *dst, const void *src, size_t size);
+
+// Host memory is used as a stand-in for locked device memory
+struct CpuMemcpyTest : public ::testing::TestWithParam<bool> {
+    CpuMemcpyTest() {
+        DebugManager.flags.EnableCpuMemcpyStreaming.set(1);
+    }
+
+    void verifyCopy(CopyFunction copyFunction, size_t size, size_t dstOffset, size_t srcOffset) {
+        std::vector<uint8_t> src(size + srcOffset);
+        std::iota(src.begin(), src.end(), static_cast<uint8_t>(size));
+        std::vector<uint8_t> dst(size + dstOffset + guardSize, guardValue);
+
+        copyFunction(ptrOffset(dst.data(), dstOffset), ptrOffset(src.data(), srcOffset), size);
+
+        for (size_t i = 0; i < dstOffset; i++) {
+            ASSERT_EQ(guardValue, dst[i]);
+        }
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(src[srcOffset + i], dst[dstOffset + i]) << "size: " << size << " offset: " << i;
+        }
+        for (size_t i = 0; i < guardSize; i++) {
+            ASSERT_EQ(guardValue, dst[dstOffset + size + i]);
+        }
+    }
+
+    CopyFunction getCopyFunction() const {
+        return GetParam() ? cpuMemcpyToLockedMemory : cpuMemcpyFromLockedMemory;
+    }
+
+    static constexpr size_t guardSize = 64;
+    static constexpr uint8_t guardValue = 0xcd;
+    DebugManagerStateRestore restorer;
+};
+
+} // namespace
+
+TEST_P(CpuMemcpyTest, givenVariousSizesAndMisalignmentsWhenCopyingThenDataIsCopiedAndNeighbouringBytesAreUntouched) {
+    for (size_t size : {0u, 1u, 15u, 31u, 32u, 33u, 127u, 128u, 129u, 4096u, 4099u}) {
+        for (size_t dstOffset : {0u, 1u, 7u, 16u, 31u}) {
+            for (size_t srcOffset : {0u, 3u, 16u}) {
+                verifyCopy(getCopyFunction(), size, dstOffset, srcOffset);
+            }
+        }
+    }
+}
+
+TEST_P(CpuMemcpyTest, givenStreamingDisabledWhenCopyingThenDataIsCopied) {
+    DebugManager.flags.EnableCpuMemcpyStreaming.set(0);
+    verifyCopy(getCopyFunction(), 1000, 1, 2);
+}
+
+TEST_P(CpuMemcpyTest, givenSizeAboveMultiThreadThresholdWhenCopyingThenDataIsCopied) {
+    DebugManager.flags.CpuMemcpyMultiThreadThreshold.set(4096);
+    DebugManager.flags.CpuMemcpyMaxThreadCount.set(4);
+    for (size_t size : {4096u, 4097u, 10000u, 65536u + 5u}) {
+        verifyCopy(getCopyFunction(), size, 3, 1);
+    }
+}
+
+TEST_P(CpuMemcpyTest, givenSingleThreadAllowedWhenCopyingAboveThresholdThenDataIsCopied) {
+    DebugManager.flags.CpuMemcpyMultiThreadThreshold.set(64);
+    DebugManager.flags.CpuMemcpyMaxThreadCount.set(1);
+    verifyCopy(getCopyFunction(), 8192, 0, 0);
+}
+
+TEST(CpuMemcpyHelperTest, givenSizeAboveMultiThreadThresholdWhenCopyingInParallelThenChunksAreMultiplesOfGranularityAndCoverWholeCopy) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuMemcpyMultiThreadThreshold.set(0);
+    DebugManager.flags.CpuMemcpyMaxThreadCount.set(4);
+
+    constexpr size_t granularity = 12;
+    constexpr size_t size = granularity * 101;
+    std::vector<std::atomic<uint32_t>> copyCounts(size);
+    std::atomic<uint32_t> chunkCount{0};
+
+    CpuMemcpyHelper::copyInParallel(size, granularity, [&](size_t offset, size_t chunkSize) {
+        EXPECT_EQ(0u, offset % granularity);
+        EXPECT_EQ(0u, chunkSize % granularity);
+        for (size_t i = offset; i < offset + chunkSize; i++) {
+            copyCounts[i]++;
+        }
+        chunkCount++;
+    });
+
+    EXPECT_EQ(4u, chunkCount.load());
+    for (auto &copyCount : copyCounts) {
+        EXPECT_EQ(1u, copyCount.load());
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(CpuMemcpy,
+                        CpuMemcpyTest,
+                        ::testing::Bool());
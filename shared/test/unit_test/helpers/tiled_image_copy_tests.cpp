@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/gmm_helper/resource_info.h"
+#include "shared/source/helpers/tiled_image_copy.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_gmm.h"
+#include "shared/test/common/mocks/mock_gmm_resource_info.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <vector>
+
+using namespace NEO;
+
+TEST(TiledImageCopyTest, givenTileYWhenGettingTiledOffsetThenSpansAreOrderedInColumnsOf32Rows) {
+    constexpr size_t rowPitch = 2 * TiledImageCopy::tileWidthInBytes;
+    EXPECT_EQ(0u, TiledImageCopy::getTiledOffset(ImageTilingMode::tileY, 0, 0, rowPitch));
+    EXPECT_EQ(5u, TiledImageCopy::getTiledOffset(ImageTilingMode::tileY, 5, 0, rowPitch));
+    EXPECT_EQ(16u, TiledImageCopy::getTiledOffset(ImageTilingMode::tileY, 0, 1, rowPitch));
+    EXPECT_EQ(512u, TiledImageCopy::getTiledOffset(ImageTilingMode::tileY, 16, 0, rowPitch));
+    EXPECT_EQ(512u + 31 * 16 + 15, TiledImageCopy::getTiledOffset(ImageTilingMode::tileY, 31, 31, rowPitch));
+    EXPECT_EQ(4096u, TiledImageCopy::getTiledOffset(ImageTilingMode::tileY, 128, 0, rowPitch));
+    EXPECT_EQ(8192u + 16, TiledImageCopy::getTiledOffset(ImageTilingMode::tileY, 0, 33, rowPitch));
+}
+
+TEST(TiledImageCopyTest, givenTile4WhenGettingTiledOffsetThenOffsetsMatchReferenceLayout) {
+    constexpr size_t rowPitch = 2 * TiledImageCopy::tileWidthInBytes;
+    EXPECT_EQ(0u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 0, 0, rowPitch));
+    EXPECT_EQ(55u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 7, 3, rowPitch));
+    EXPECT_EQ(64u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 16, 0, rowPitch));
+    EXPECT_EQ(128u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 32, 0, rowPitch));
+    EXPECT_EQ(256u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 0, 4, rowPitch));
+    EXPECT_EQ(357u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 21, 6, rowPitch));
+    EXPECT_EQ(448u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 48, 4, rowPitch));
+    EXPECT_EQ(512u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 64, 0, rowPitch));
+    EXPECT_EQ(1024u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 0, 8, rowPitch));
+    EXPECT_EQ(2048u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 0, 16, rowPitch));
+    EXPECT_EQ(4095u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 127, 31, rowPitch));
+    EXPECT_EQ(4096u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 128, 0, rowPitch));
+    EXPECT_EQ(8192u, TiledImageCopy::getTiledOffset(ImageTilingMode::tile4, 0, 32, rowPitch));
+}
+
+TEST(TiledImageCopyTest, givenLinearModeWhenGettingTiledOffsetThenRowPitchIsUsed) {
+    EXPECT_EQ(3u * 100 + 7, TiledImageCopy::getTiledOffset(ImageTilingMode::linear, 7, 3, 100));
+}
+
+TEST(TiledImageCopyTest, givenTiledModesWhenGettingOffsetsOfWholeTileThenEachByteIsMappedOnce) {
+    for (auto tilingMode : {ImageTilingMode::tileY, ImageTilingMode::tile4}) {
+        std::set<size_t> offsets;
+        for (size_t y = 0; y < TiledImageCopy::tileHeight; y++) {
+            for (size_t x = 0; x < TiledImageCopy::tileWidthInBytes; x++) {
+                auto offset = TiledImageCopy::getTiledOffset(tilingMode, x, y, TiledImageCopy::tileWidthInBytes);
+                EXPECT_LT(offset, TiledImageCopy::tileSizeInBytes);
+                offsets.insert(offset);
+            }
+        }
+        EXPECT_EQ(TiledImageCopy::tileSizeInBytes, offsets.size());
+    }
+}
+
+TEST(TiledImageCopyTest, givenRegionWithOriginWhenCopyingLinearToTiledAndBackThenOnlyRegionIsWrittenAndDataMatches) {
+    constexpr size_t bytesPerPixel = 4;
+    constexpr size_t tiledRowPitch = 3 * TiledImageCopy::tileWidthInBytes;
+    constexpr size_t tiledHeight = 2 * TiledImageCopy::tileHeight;
+    constexpr size_t tiledSlicePitch = tiledRowPitch * tiledHeight;
+    constexpr size_t slices = 3;
+
+    const Vec3<size_t> origin = {5, 7, 1};
+    const Vec3<size_t> region = {61, 37, 2};
+    const size_t linearRowPitch = region.x * bytesPerPixel + 12;
+    const size_t linearSlicePitch = linearRowPitch * region.y;
+
+    std::vector<uint8_t> linear(linearSlicePitch * region.z);
+    for (size_t i = 0; i < linear.size(); i++) {
+        linear[i] = static_cast<uint8_t>(i * 13 + 5);
+    }
+
+    for (auto tilingMode : {ImageTilingMode::linear, ImageTilingMode::tileY, ImageTilingMode::tile4}) {
+        std::vector<uint8_t> tiled(tiledSlicePitch * slices, 0);
+        TiledImageCopy::copyLinearToTiled(tilingMode, tiled.data(), tiledRowPitch, tiledSlicePitch,
+                                          linear.data(), linearRowPitch, linearSlicePitch, bytesPerPixel, origin, region);
+
+        size_t writtenBytes = 0;
+        for (auto value : tiled) {
+            writtenBytes += value != 0 ? 1 : 0;
+        }
+        EXPECT_GE(region.x * region.y * region.z * bytesPerPixel, writtenBytes);
+
+        for (size_t z = 0; z < region.z; z++) {
+            for (size_t y = 0; y < region.y; y++) {
+                for (size_t x = 0; x < region.x * bytesPerPixel; x++) {
+                    auto tiledOffset = (origin.z + z) * tiledSlicePitch +
+                                       TiledImageCopy::getTiledOffset(tilingMode, origin.x * bytesPerPixel + x, origin.y + y, tiledRowPitch);
+                    ASSERT_EQ(linear[z * linearSlicePitch + y * linearRowPitch + x], tiled[tiledOffset]);
+                }
+            }
+        }
+
+        std::vector<uint8_t> readBack(linear.size(), 0);
+        TiledImageCopy::copyTiledToLinear(tilingMode, tiled.data(), tiledRowPitch, tiledSlicePitch,
+                                          readBack.data(), linearRowPitch, linearSlicePitch, bytesPerPixel, origin, region);
+        for (size_t z = 0; z < region.z; z++) {
+            for (size_t y = 0; y < region.y; y++) {
+                auto rowOffset = z * linearSlicePitch + y * linearRowPitch;
+                EXPECT_EQ(0, memcmp(&linear[rowOffset], &readBack[rowOffset], region.x * bytesPerPixel));
+            }
+        }
+    }
+}
+
+TEST(TiledImageCopyTest, givenGmmResourceFlagsWhenGettingTilingModeThenSupportedLayoutsAreRecognized) {
+    MockExecutionEnvironment executionEnvironment;
+    auto gmm = std::make_unique<MockGmm>(executionEnvironment.rootDeviceEnvironments[0]->getGmmHelper());
+    auto &flags = static_cast<MockGmmResourceInfo *>(gmm->gmmResourceInfo.get())->getResourceFlags()->Info;
+    flags = {};
+
+    ImageTilingMode tilingMode = ImageTilingMode::linear;
+    EXPECT_TRUE(TiledImageCopy::getTilingMode(nullptr, tilingMode));
+    EXPECT_EQ(ImageTilingMode::linear, tilingMode);
+
+    EXPECT_FALSE(TiledImageCopy::getTilingMode(gmm.get(), tilingMode));
+
+    flags.TiledY = 1;
+    EXPECT_TRUE(TiledImageCopy::getTilingMode(gmm.get(), tilingMode));
+    EXPECT_EQ(ImageTilingMode::tileY, tilingMode);
+
+    flags.TiledYs = 1;
+    EXPECT_FALSE(TiledImageCopy::getTilingMode(gmm.get(), tilingMode));
+
+    flags = {};
+    flags.Tile4 = 1;
+    EXPECT_TRUE(TiledImageCopy::getTilingMode(gmm.get(), tilingMode));
+    EXPECT_EQ(ImageTilingMode::tile4, tilingMode);
+
+    flags.RenderCompressed = 1;
+    EXPECT_FALSE(TiledImageCopy::getTilingMode(gmm.get(), tilingMode));
+
+    flags = {};
+    flags.Linear = 1;
+    EXPECT_TRUE(TiledImageCopy::getTilingMode(gmm.get(), tilingMode));
+    EXPECT_EQ(ImageTilingMode::linear, tilingMode);
+
+    gmm->isCompressionEnabled = true;
+    EXPECT_FALSE(TiledImageCopy::getTilingMode(gmm.get(), tilingMode));
+}
+
+TEST(TiledImageCopyTest, givenNotLockableAllocationWhenCheckingCpuCopySupportThenFalseIsReturned) {
+    MockExecutionEnvironment executionEnvironment;
+    auto gmm = std::make_unique<MockGmm>(executionEnvironment.rootDeviceEnvironments[0]->getGmmHelper());
+    auto &flags = static_cast<MockGmmResourceInfo *>(gmm->gmmResourceInfo.get())->getResourceFlags()->Info;
+    flags = {};
+    flags.Tile4 = 1;
+
+    MockGraphicsAllocation allocation;
+    allocation.setDefaultGmm(gmm.get());
+
+    ImageTilingMode tilingMode = ImageTilingMode::linear;
+    EXPECT_TRUE(TiledImageCopy::isCpuCopySupported(allocation, tilingMode));
+    EXPECT_EQ(ImageTilingMode::tile4, tilingMode);
+
+    gmm->resourceParams.Flags.Info.NotLockable = 1;
+    EXPECT_FALSE(TiledImageCopy::isCpuCopySupported(allocation, tilingMode));
+}
+
+TEST(TiledImageCopyTest, givenDebugFlagsWhenCheckingIfCpuCopyIsPreferredThenSizeLimitIsApplied) {
+    DebugManagerStateRestore restorer;
+    EXPECT_FALSE(TiledImageCopy::isCpuCopyPreferred(1));
+
+    DebugManager.flags.EnableCpuTiledImageCopy.set(1);
+    EXPECT_TRUE(TiledImageCopy::isCpuCopyPreferred(TiledImageCopy::defaultMaxCpuCopySize));
+    EXPECT_FALSE(TiledImageCopy::isCpuCopyPreferred(TiledImageCopy::defaultMaxCpuCopySize + 1));
+
+    DebugManager.flags.CpuTiledImageCopyMaxSize.set(256);
+    EXPECT_TRUE(TiledImageCopy::isCpuCopyPreferred(256));
+    EXPECT_FALSE(TiledImageCopy::isCpuCopyPreferred(257));
+}
@@ -326,3 +326,82 @@ TEST_F(InternalAllocationStorageTest, givenInternalAllocationWhenTaskCountMetsEx
     EXPECT_FALSE(csr->getTemporaryAllocations().peekIsEmpty());
     allocation->hostPtrTaskCountAssignment = 0;
 }
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsOfDifferentSizesWhenObtainingAllocationThenSmallestFittingSizeClassIsReturned) {
+    auto largeAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 16 * MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    *csr->getTagAddress() = 1u;
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(largeAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(smallAllocation), REUSABLE_ALLOCATION, 1u);
+
+    auto reusedAllocation = storage->obtainReusableAllocation(1, AllocationType::BUFFER);
+    EXPECT_EQ(smallAllocation, reusedAllocation.get());
+
+    auto secondReusedAllocation = storage->obtainReusableAllocation(2 * MemoryConstants::pageSize, AllocationType::BUFFER);
+    EXPECT_EQ(largeAllocation, secondReusedAllocation.get());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+    memoryManager->freeGraphicsMemory(secondReusedAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsStoredOutOfTaskCountOrderWhenObtainingAllocationThenCompletedAllocationIsReturnedAndStatisticsAreUpdated) {
+    auto busyAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto completedAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    auto *hwTag = csr->getTagAddress();
+    *hwTag = 5u;
+
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, AllocationType::BUFFER));
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 10u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(completedAllocation), REUSABLE_ALLOCATION, 3u);
+    EXPECT_EQ(busyAllocation, reusableAllocations.peekHead());
+
+    auto reusedAllocation = storage->obtainReusableAllocation(1, AllocationType::BUFFER);
+    EXPECT_EQ(completedAllocation, reusedAllocation.get());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, AllocationType::BUFFER));
+
+    auto statistics = reusableAllocations.getReuseStatistics();
+    EXPECT_EQ(1u, statistics.hitCount);
+    EXPECT_EQ(2u, statistics.missCount);
+
+    *hwTag = 10u;
+    auto secondReusedAllocation = storage->obtainReusableAllocation(1, AllocationType::BUFFER);
+    EXPECT_EQ(busyAllocation, secondReusedAllocation.get());
+    EXPECT_EQ(2u, reusableAllocations.getReuseStatistics().hitCount);
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+    memoryManager->freeGraphicsMemory(secondReusedAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenAllocationsMovedOutOfAndBackToReusableListWhenObtainingAllocationThenIndexFollowsListContents) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    *csr->getTagAddress() = 1u;
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION, 1u);
+
+    auto removedAllocation = reusableAllocations.removeOne(*allocation);
+    EXPECT_EQ(allocation, removedAllocation.get());
+
+    auto reusedAllocation = storage->obtainReusableAllocation(1, AllocationType::BUFFER);
+    EXPECT_EQ(allocation2, reusedAllocation.get());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, AllocationType::BUFFER));
+
+    reusableAllocations.pushFrontOne(*removedAllocation.release());
+    auto detachedNodes = reusableAllocations.detachNodes();
+    EXPECT_EQ(allocation, detachedNodes);
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, AllocationType::BUFFER));
+
+    reusableAllocations.splice(*detachedNodes);
+    auto splicedAllocation = storage->obtainReusableAllocation(1, AllocationType::BUFFER);
+    EXPECT_EQ(allocation, splicedAllocation.get());
+    EXPECT_TRUE(reusableAllocations.peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+    memoryManager->freeGraphicsMemory(splicedAllocation.release());
+}
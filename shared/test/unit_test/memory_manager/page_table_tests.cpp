@@ -553,3 +553,106 @@ TEST_F(PageTableTests32, GivenPagesOnTableBoundary2ndAllocationWhenMappingThenAd
     auto phys2 = pageTable->map(addr1, size, 0, MemoryBanks::MainBank);
     EXPECT_EQ(startAddress + pageSize, phys2);
 }
+
+TEST_F(PageTableTests48, givenUnmappedRangeWhenRangeWalkIsCalledThenSingleContiguousRangeIsReturned) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr + (510 * pageSize) + 0x10;
+    size_t size = MemoryConstants::pageSize2Mb;
+    auto address = allocator.mainAllocator.load();
+
+    PageWalkRanges ranges;
+    pageTable->rangeWalk(gpuVa, size, 0, 0, ranges, MemoryBanks::MainBank);
+
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(address + 0x10, ranges[0].physAddress);
+    EXPECT_EQ(size, ranges[0].size);
+    EXPECT_EQ(0u, ranges[0].offset);
+    EXPECT_EQ(1u, ranges[0].entryBits);
+}
+
+TEST_F(PageTableTests48, givenPartiallyMappedRangeWhenRangeWalkIsCalledThenRangesMatchPageWalk) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr + (500 * pageSize);
+    size_t size = 32 * pageSize;
+
+    pageTable->map(gpuVa + 8 * pageSize, pageSize, 0, MemoryBanks::MainBank);
+    pageTable->map(gpuVa + 20 * pageSize, 2 * pageSize, 0, MemoryBanks::MainBank);
+
+    PageWalkRanges ranges;
+    pageTable->rangeWalk(gpuVa, size, 0, 0, ranges, MemoryBanks::MainBank);
+    EXPECT_EQ(5u, ranges.size());
+
+    size_t rangeIndex = 0;
+    size_t offsetInRange = 0;
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        ASSERT_LT(rangeIndex, ranges.size());
+        EXPECT_EQ(ranges[rangeIndex].physAddress + offsetInRange, physAddress);
+        EXPECT_EQ(ranges[rangeIndex].offset + offsetInRange, offset);
+        EXPECT_EQ(ranges[rangeIndex].entryBits, entryBits);
+
+        offsetInRange += size;
+        if (offsetInRange == ranges[rangeIndex].size) {
+            rangeIndex++;
+            offsetInRange = 0;
+        }
+    };
+    pageTable->pageWalk(gpuVa, size, 0, 0, walker, MemoryBanks::MainBank);
+    EXPECT_EQ(ranges.size(), rangeIndex);
+}
+
+TEST_F(PageTableTests48, givenRangeWithDifferentEntryBitsWhenRangeWalkIsCalledThenRangesAreNotMerged) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr;
+
+    pageTable->map(gpuVa, 4 * pageSize, 0, MemoryBanks::MainBank);
+    pageTable->map(gpuVa + 2 * pageSize, 2 * pageSize, 0x2, MemoryBanks::MainBank);
+
+    PageWalkRanges ranges;
+    pageTable->rangeWalk(gpuVa, 4 * pageSize, 0, PageTableEntry::nonValidBits, ranges, MemoryBanks::MainBank);
+
+    ASSERT_EQ(2u, ranges.size());
+    EXPECT_EQ(2 * pageSize, ranges[0].size);
+    EXPECT_EQ(0x1u, ranges[0].entryBits);
+    EXPECT_EQ(2 * pageSize, ranges[1].offset);
+    EXPECT_EQ(0x3u, ranges[1].entryBits);
+}
+
+TEST_F(PageTableTests48, givenNodeArenaEnabledWhenMappingThenPhysicalAddressesMatchHeapAllocatedTree) {
+    MockPhysicalAddressAllocator arenaAllocator;
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    std::unique_ptr<PPGTTPageTable> arenaPageTable(new PPGTTPageTable(&arenaAllocator));
+    arenaPageTable->enableNodeArena();
+
+    uintptr_t gpuVa = refAddr + pageSize * 16;
+    size_t size = 3 * MemoryConstants::pageSize2Mb;
+
+    EXPECT_EQ(pageTable->map(gpuVa, size, 0, MemoryBanks::MainBank), arenaPageTable->map(gpuVa, size, 0, MemoryBanks::MainBank));
+
+    PageWalkRanges ranges;
+    PageWalkRanges arenaRanges;
+    pageTable->rangeWalk(gpuVa, size, 0, 0, ranges, MemoryBanks::MainBank);
+    arenaPageTable->rangeWalk(gpuVa, size, 0, 0, arenaRanges, MemoryBanks::MainBank);
+
+    ASSERT_EQ(ranges.size(), arenaRanges.size());
+    for (size_t i = 0; i < ranges.size(); i++) {
+        EXPECT_EQ(ranges[i].physAddress, arenaRanges[i].physAddress);
+        EXPECT_EQ(ranges[i].size, arenaRanges[i].size);
+    }
+}
+
+TEST(PageTableNodeArenaTest, givenNodesExceedingChunkWhenCreatingThenAllNodesAreAlignedAndDistinct) {
+    MockPhysicalAddressAllocator allocator;
+    PageTableNodeArena arena;
+
+    const size_t nodeCount = 2 * PageTableNodeArena::chunkSize / sizeof(PTE) + 1;
+    std::vector<PTE *> nodes;
+    for (size_t i = 0; i < nodeCount; i++) {
+        auto node = arena.create<PTE>(&allocator);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(node) % alignof(PTE));
+        nodes.push_back(node);
+    }
+
+    for (size_t i = 1; i < nodeCount; i++) {
+        EXPECT_NE(nodes[i - 1], nodes[i]);
+    }
+}
@@ -616,6 +616,170 @@ TEST_F(DrmBufferObjectTest, givenAsyncDebugFlagWhenFillingExecObjectThenFlagIsSe
     EXPECT_TRUE(execObject.hasAsyncFlag());
 }
 
+TEST_F(DrmBufferObjectTest, givenResidentBoWhenExecutedTwiceThenExecObjectIsEncodedOnEachExec) {
+    mock->ioctl_expected.total = 2;
+
+    TestedBufferObject residentBo(this->mock.get(), 0x1000);
+    residentBo.setAddress(0x45000);
+    EXPECT_TRUE(residentBo.execObjectCache.empty());
+    BufferObject *residency[1] = {&residentBo};
+    MockExecObject execObjects[2]{};
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(1u, residentBo.fillExecObjectCalled);
+
+    memset(execObjects, 0, sizeof(execObjects));
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(2u, residentBo.fillExecObjectCalled);
+    EXPECT_EQ(0x45000u, execObjects[0].getOffset());
+    EXPECT_EQ(1u, execObjects[0].getReserved());
+    EXPECT_EQ(static_cast<uint32_t>(residentBo.peekHandle()), execObjects[0].getHandle());
+}
+
+TEST_F(DrmBufferObjectTest, givenResidentBoStateChangedBetweenExecsWhenExecutedThenExecObjectReflectsCurrentState) {
+    DebugManagerStateRestore restorer;
+    mock->ioctl_expected.total = 6;
+
+    TestedBufferObject residentBo(this->mock.get(), 0x1000);
+    residentBo.setAddress(0x45000);
+    BufferObject *residency[1] = {&residentBo};
+    MockExecObject execObjects[2]{};
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(0x45000u, execObjects[0].getOffset());
+    EXPECT_FALSE(execObjects[0].hasCaptureFlag());
+    EXPECT_FALSE(execObjects[0].hasAsyncFlag());
+
+    residentBo.setAddress(0x46000);
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(0x46000u, execObjects[0].getOffset());
+
+    residentBo.markForCapture();
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_TRUE(execObjects[0].hasCaptureFlag());
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 2, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(2u, execObjects[0].getReserved());
+
+    DebugManager.flags.UseAsyncDrmExec.set(1);
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 2, residency, 1u, execObjects, 0, 0));
+    EXPECT_TRUE(execObjects[0].hasAsyncFlag());
+
+    residentBo.bindInfo[0][0] = true;
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 2, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(0u, execObjects[0].getHandle());
+}
+
+TEST_F(DrmBufferObjectTest, givenExecObjectCachingEnabledWhenResidentBoIsExecutedAgainThenCachedExecObjectIsReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableExecObjectCaching.set(1);
+    mock->ioctl_expected.total = 2;
+
+    TestedBufferObject residentBo(this->mock.get(), 0x1000);
+    residentBo.setAddress(0x45000);
+    ASSERT_EQ(1u, residentBo.execObjectCache.size());
+    EXPECT_EQ(nullptr, residentBo.execObjectCache[0].get());
+
+    BufferObject *residency[1] = {&residentBo};
+    MockExecObject execObjects[2]{};
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(1u, residentBo.fillExecObjectCalled);
+    ASSERT_NE(nullptr, residentBo.execObjectCache[0].get());
+    EXPECT_EQ(osContext.get(), residentBo.execObjectCache[0]->osContext);
+
+    memset(execObjects, 0, sizeof(execObjects));
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(1u, residentBo.fillExecObjectCalled);
+    EXPECT_EQ(0x45000u, execObjects[0].getOffset());
+    EXPECT_EQ(1u, execObjects[0].getReserved());
+    EXPECT_EQ(static_cast<uint32_t>(residentBo.peekHandle()), execObjects[0].getHandle());
+}
+
+TEST_F(DrmBufferObjectTest, givenExecObjectCachingEnabledWhenBoStateChangesThenCachedExecObjectIsRebuilt) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableExecObjectCaching.set(1);
+    mock->ioctl_expected.total = 7;
+
+    TestedBufferObject residentBo(this->mock.get(), 0x1000);
+    residentBo.setAddress(0x45000);
+    BufferObject *residency[1] = {&residentBo};
+    MockExecObject execObjects[2]{};
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(1u, residentBo.fillExecObjectCalled);
+
+    residentBo.setAddress(0x46000);
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(2u, residentBo.fillExecObjectCalled);
+    EXPECT_EQ(0x46000u, execObjects[0].getOffset());
+
+    residentBo.markForCapture();
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(3u, residentBo.fillExecObjectCalled);
+    EXPECT_TRUE(execObjects[0].hasCaptureFlag());
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 2, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(4u, residentBo.fillExecObjectCalled);
+    EXPECT_EQ(2u, execObjects[0].getReserved());
+
+    DebugManager.flags.UseAsyncDrmExec.set(1);
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 2, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(5u, residentBo.fillExecObjectCalled);
+    EXPECT_TRUE(execObjects[0].hasAsyncFlag());
+
+    residentBo.bindInfo[0][0] = true;
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 2, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(6u, residentBo.fillExecObjectCalled);
+    EXPECT_EQ(0u, execObjects[0].getHandle());
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 2, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(6u, residentBo.fillExecObjectCalled);
+    EXPECT_EQ(0u, execObjects[0].getHandle());
+    EXPECT_TRUE(execObjects[0].hasAsyncFlag());
+    EXPECT_TRUE(execObjects[0].hasCaptureFlag());
+}
+
+TEST_F(DrmBufferObjectTest, givenExecObjectCachingEnabledWhenOsContextWithSameIdChangesThenCachedExecObjectIsRebuilt) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableExecObjectCaching.set(1);
+    mock->ioctl_expected.total = 4;
+
+    OsContextLinux otherOsContext(*this->mock, 0, 0u, EngineDescriptorHelper::getDefaultDescriptor());
+    TestedBufferObject residentBo(this->mock.get(), 0x1000);
+    BufferObject *residency[1] = {&residentBo};
+    MockExecObject execObjects[2]{};
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(1u, residentBo.fillExecObjectCalled);
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, &otherOsContext, 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(2u, residentBo.fillExecObjectCalled);
+    EXPECT_EQ(&otherOsContext, residentBo.execObjectCache[0]->osContext);
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, &otherOsContext, 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(2u, residentBo.fillExecObjectCalled);
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(3u, residentBo.fillExecObjectCalled);
+    EXPECT_EQ(osContext.get(), residentBo.execObjectCache[0]->osContext);
+}
+
+TEST_F(DrmBufferObjectTest, givenExecObjectCachingEnabledWhenOsContextIdExceedsCacheSizeThenExecObjectIsEncodedOnEachExec) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableExecObjectCaching.set(1);
+    mock->ioctl_expected.total = 2;
+
+    OsContextLinux secondOsContext(*this->mock, 0, 1u, EngineDescriptorHelper::getDefaultDescriptor());
+    TestedBufferObject residentBo(this->mock.get(), 0x1000);
+    BufferObject *residency[1] = {&residentBo};
+    MockExecObject execObjects[2]{};
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, &secondOsContext, 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, &secondOsContext, 0, 1, residency, 1u, execObjects, 0, 0));
+    EXPECT_EQ(2u, residentBo.fillExecObjectCalled);
+    EXPECT_EQ(nullptr, residentBo.execObjectCache[0].get());
+}
+
 TEST_F(DrmBufferObjectTest, given47bitAddressWhenSetThenIsAddressNotCanonized) {
     MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
     executionEnvironment.rootDeviceEnvironments[0]->getGmmHelper()->setAddressWidth(48);
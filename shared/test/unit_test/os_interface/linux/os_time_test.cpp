@@ -5,9 +5,11 @@
  *
  */
 
+#include "shared/source/helpers/constants.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_time_linux.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/linux/mock_os_time_linux.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
@@ -16,6 +18,7 @@
 #include "gtest/gtest.h"
 
 #include <dlfcn.h>
+#include <limits>
 
 static int actualTime = 0;
 
@@ -37,7 +40,31 @@ int resolutionFuncTrue(clockid_t clkId, struct timespec *res) throw() {
     return 0;
 }
 
+static uint64_t calibrationCpuTimeNs = 0;
+static uint64_t calibrationGpuTimeOffset = 0;
+
+int getTimeFuncCalibration(clockid_t clkId, struct timespec *tp) throw() {
+    tp->tv_sec = static_cast<time_t>(calibrationCpuTimeNs / NSEC_PER_SEC);
+    tp->tv_nsec = static_cast<long>(calibrationCpuTimeNs % NSEC_PER_SEC);
+    return 0;
+}
+
 using namespace NEO;
+
+class DrmMockTimeCalibration : public DrmMockSuccess {
+  public:
+    using DrmMockSuccess::DrmMockSuccess;
+    int ioctl(DrmIoctl request, void *arg) override {
+        auto *reg = reinterpret_cast<NEO::RegisterRead *>(arg);
+        reg->value = (calibrationCpuTimeNs / 2 + calibrationGpuTimeOffset) & timestampMask;
+        regReadCount++;
+        return 0;
+    };
+
+    uint64_t timestampMask = std::numeric_limits<uint64_t>::max();
+    uint32_t regReadCount = 0;
+};
+
 struct DrmTimeTest : public ::testing::Test {
   public:
     void SetUp() override {
@@ -270,3 +297,141 @@ TEST_F(DrmTimeTest, givenAlwaysPassingResolutionFuncWhenGetCpuRawTimestampIsCall
     auto retVal = osTime->getCpuRawTimestamp();
     EXPECT_EQ(1ull, retVal);
 }
+
+TEST_F(DrmTimeTest, givenCpuGpuTimeInterpolationDisabledWhenGettingCpuGpuTimeThenGpuTimestampIsAlwaysRead) {
+    auto pDrm = new DrmMockTimeCalibration(mockFd, *executionEnvironment.rootDeviceEnvironments[0]);
+    osTime->setGetTimeFunc(getTimeFuncCalibration);
+    osTime->updateDrm(pDrm);
+    pDrm->regReadCount = 0;
+
+    TimeStampData cpuGpuTime = {};
+    for (uint32_t i = 0; i < 4; i++) {
+        calibrationCpuTimeNs = 1'000'000u * (i + 1);
+        EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+        EXPECT_EQ(calibrationCpuTimeNs / 2, cpuGpuTime.GPUTimeStamp);
+    }
+    EXPECT_EQ(4u, pDrm->regReadCount);
+}
+
+TEST_F(DrmTimeTest, givenCpuGpuTimeInterpolationEnabledWhenGettingCpuGpuTimeThenGpuTimestampIsReadOnlyToCalibrate) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCpuGpuTimeInterpolation.set(1);
+    calibrationGpuTimeOffset = 0;
+
+    auto calibratedOsTime = MockOSTimeLinux::create(osInterface.get());
+    auto pDrm = new DrmMockTimeCalibration(mockFd, *executionEnvironment.rootDeviceEnvironments[0]);
+    calibratedOsTime->setGetTimeFunc(getTimeFuncCalibration);
+    calibratedOsTime->updateDrm(pDrm);
+    pDrm->regReadCount = 0;
+
+    TimeStampData cpuGpuTime = {};
+    auto getCpuGpuTime = [&](uint64_t cpuTimeNs) {
+        calibrationCpuTimeNs = cpuTimeNs;
+        EXPECT_TRUE(calibratedOsTime->getCpuGpuTime(&cpuGpuTime));
+        EXPECT_EQ(cpuTimeNs, cpuGpuTime.CPUTimeinNS);
+    };
+
+    // samples closer than the minimal calibration interval do not establish the clock ratio
+    getCpuGpuTime(1'000'000u);
+    getCpuGpuTime(1'500'000u);
+    EXPECT_EQ(2u, pDrm->regReadCount);
+
+    getCpuGpuTime(3'000'000u);
+    EXPECT_EQ(3u, pDrm->regReadCount);
+
+    getCpuGpuTime(3'500'000u);
+    EXPECT_EQ(3u, pDrm->regReadCount);
+    EXPECT_EQ(1'750'000u, cpuGpuTime.GPUTimeStamp);
+
+    // prediction within error bound doubles the calibration interval
+    getCpuGpuTime(4'000'000u);
+    EXPECT_EQ(4u, pDrm->regReadCount);
+    getCpuGpuTime(5'500'000u);
+    EXPECT_EQ(4u, pDrm->regReadCount);
+    EXPECT_EQ(2'750'000u, cpuGpuTime.GPUTimeStamp);
+
+    // drift above error bound halves the calibration interval
+    calibrationGpuTimeOffset = 10'000u;
+    getCpuGpuTime(6'000'000u);
+    EXPECT_EQ(5u, pDrm->regReadCount);
+    EXPECT_EQ(3'010'000u, cpuGpuTime.GPUTimeStamp);
+    getCpuGpuTime(6'500'000u);
+    EXPECT_EQ(5u, pDrm->regReadCount);
+    getCpuGpuTime(7'000'000u);
+    EXPECT_EQ(6u, pDrm->regReadCount);
+    EXPECT_EQ(3'510'000u, cpuGpuTime.GPUTimeStamp);
+
+    calibrationGpuTimeOffset = 0;
+}
+
+TEST_F(DrmTimeTest, givenCpuGpuTimeInterpolationEnabledAndGpuTimestampWrapWhenGettingCpuGpuTimeThenInterpolatedTimestampIsMaskedAndModelIsKept) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCpuGpuTimeInterpolation.set(1);
+    executionEnvironment.rootDeviceEnvironments[0]->getMutableHardwareInfo()->capabilityTable.timestampValidBits = 32u;
+    calibrationGpuTimeOffset = maxNBitValue(32) + 1 - 1'600'000u;
+
+    auto calibratedOsTime = MockOSTimeLinux::create(osInterface.get());
+    auto pDrm = new DrmMockTimeCalibration(mockFd, *executionEnvironment.rootDeviceEnvironments[0]);
+    calibratedOsTime->setGetTimeFunc(getTimeFuncCalibration);
+    calibratedOsTime->updateDrm(pDrm);
+    pDrm->timestampMask = maxNBitValue(32);
+    pDrm->regReadCount = 0;
+
+    TimeStampData cpuGpuTime = {};
+    auto getCpuGpuTime = [&](uint64_t cpuTimeNs) {
+        calibrationCpuTimeNs = cpuTimeNs;
+        EXPECT_TRUE(calibratedOsTime->getCpuGpuTime(&cpuGpuTime));
+        EXPECT_EQ(cpuTimeNs, cpuGpuTime.CPUTimeinNS);
+    };
+
+    getCpuGpuTime(1'000'000u);
+    getCpuGpuTime(3'000'000u);
+    EXPECT_EQ(2u, pDrm->regReadCount);
+    EXPECT_EQ(maxNBitValue(32) + 1 - 100'000u, cpuGpuTime.GPUTimeStamp);
+
+    // counter wraps between calibration and query
+    getCpuGpuTime(3'500'000u);
+    EXPECT_EQ(2u, pDrm->regReadCount);
+    EXPECT_EQ(150'000u, cpuGpuTime.GPUTimeStamp);
+
+    // calibration across the wrap keeps the clock model and doubles the interval
+    getCpuGpuTime(4'000'000u);
+    EXPECT_EQ(3u, pDrm->regReadCount);
+    EXPECT_EQ(400'000u, cpuGpuTime.GPUTimeStamp);
+    getCpuGpuTime(5'500'000u);
+    EXPECT_EQ(3u, pDrm->regReadCount);
+    EXPECT_EQ(1'150'000u, cpuGpuTime.GPUTimeStamp);
+
+    calibrationGpuTimeOffset = 0;
+}
+
+TEST_F(DrmTimeTest, givenCpuGpuTimeInterpolationEnabledWhenSampleOlderThanCalibrationReferenceIsReportedThenClockModelIsKept) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCpuGpuTimeInterpolation.set(1);
+    calibrationGpuTimeOffset = 0;
+
+    auto calibratedOsTime = MockOSTimeLinux::create(osInterface.get());
+    auto pDrm = new DrmMockTimeCalibration(mockFd, *executionEnvironment.rootDeviceEnvironments[0]);
+    calibratedOsTime->setGetTimeFunc(getTimeFuncCalibration);
+    calibratedOsTime->updateDrm(pDrm);
+    pDrm->regReadCount = 0;
+
+    TimeStampData cpuGpuTime = {};
+    auto getCpuGpuTime = [&](uint64_t cpuTimeNs) {
+        calibrationCpuTimeNs = cpuTimeNs;
+        EXPECT_TRUE(calibratedOsTime->getCpuGpuTime(&cpuGpuTime));
+    };
+
+    getCpuGpuTime(1'000'000u);
+    getCpuGpuTime(3'000'000u);
+    EXPECT_EQ(2u, pDrm->regReadCount);
+
+    // a sample taken by a thread that lost the race for the lock does not reset the model
+    getCpuGpuTime(500'000u);
+    EXPECT_EQ(3u, pDrm->regReadCount);
+    EXPECT_EQ(250'000u, cpuGpuTime.GPUTimeStamp);
+
+    getCpuGpuTime(3'500'000u);
+    EXPECT_EQ(3u, pDrm->regReadCount);
+    EXPECT_EQ(1'750'000u, cpuGpuTime.GPUTimeStamp);
+}
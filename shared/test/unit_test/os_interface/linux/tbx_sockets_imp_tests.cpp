@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/tbx/tbx_proto.h"
+#include "shared/source/tbx/tbx_sockets_imp.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <sstream>
+
+using namespace NEO;
+
+namespace {
+
+uint32_t sendCalled = 0u;
+size_t maxBytesPerSend = 0u;
+std::vector<char> sentBytes;
+std::vector<char> responseBytes;
+size_t responseOffset = 0u;
+
+ssize_t mockSend(int sockfd, const void *buf, size_t len, int flags) {
+    sendCalled++;
+    if (maxBytesPerSend != 0u) {
+        len = std::min(len, maxBytesPerSend);
+    }
+    auto bytes = static_cast<const char *>(buf);
+    sentBytes.insert(sentBytes.end(), bytes, bytes + len);
+    return static_cast<ssize_t>(len);
+}
+
+ssize_t mockRecv(int sockfd, void *buf, size_t len, int flags) {
+    len = std::min(len, responseBytes.size() - responseOffset);
+    memcpy(buf, responseBytes.data() + responseOffset, len);
+    responseOffset += len;
+    return static_cast<ssize_t>(len);
+}
+
+class MockTbxSocketsImp : public TbxSocketsImp {
+  public:
+    using TbxSocketsImp::batchSize;
+    using TbxSocketsImp::TbxSocketsImp;
+    using TbxSocketsImp::transID;
+    using TbxSocketsImp::writeBatch;
+};
+
+struct TbxSocketsImpTest : public ::testing::Test {
+    void SetUp() override {
+        sendCalled = 0u;
+        maxBytesPerSend = 0u;
+        sentBytes.clear();
+        responseBytes.clear();
+        responseOffset = 0u;
+    }
+
+    std::unique_ptr<MockTbxSocketsImp> createConnectedSockets() {
+        auto sockets = std::make_unique<MockTbxSocketsImp>(errStream);
+        EXPECT_TRUE(sockets->init("127.0.0.1", 4321));
+
+        // Drop the control request sent while connecting.
+        EXPECT_EQ(1u, sendCalled);
+        sendCalled = 0u;
+        sentBytes.clear();
+        return sockets;
+    }
+
+    std::vector<uint8_t> createPattern(size_t size, uint8_t seed) {
+        std::vector<uint8_t> pattern(size);
+        std::iota(pattern.begin(), pattern.end(), seed);
+        return pattern;
+    }
+
+    void queueResponse(const void *data, size_t size) {
+        auto bytes = static_cast<const char *>(data);
+        responseBytes.insert(responseBytes.end(), bytes, bytes + size);
+    }
+
+    void queueMmioResponse(uint32_t transId, uint32_t value) {
+        HAS_MSG resp = {};
+        resp.hdr.msg_type = HAS_MMIO_RES_TYPE;
+        resp.hdr.trans_id = transId;
+        resp.hdr.size = sizeof(HAS_MMIO_RES);
+        resp.u.mmio_res.data = value;
+        queueResponse(&resp, sizeof(HAS_HDR) + sizeof(HAS_MMIO_RES));
+    }
+
+    void queueReadDataResponse(uint32_t transId, const std::vector<uint8_t> &data) {
+        HAS_MSG resp = {};
+        resp.hdr.msg_type = HAS_READ_DATA_RES_TYPE;
+        resp.hdr.trans_id = transId;
+        resp.hdr.size = sizeof(HAS_READ_DATA_RES);
+        resp.u.read_res.size = static_cast<uint32_t>(data.size());
+        queueResponse(&resp, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_RES));
+        queueResponse(data.data(), data.size());
+    }
+
+    // Splits the sent byte stream into requests, returning their message types in order.
+    std::vector<uint32_t> parseSentRequests() {
+        std::vector<uint32_t> msgTypes;
+        size_t offset = 0u;
+        while (offset < sentBytes.size()) {
+            HAS_MSG cmd = {};
+            memcpy(&cmd.hdr, sentBytes.data() + offset, sizeof(HAS_HDR));
+            memcpy(&cmd.u, sentBytes.data() + offset + sizeof(HAS_HDR), cmd.hdr.size);
+            offset += sizeof(HAS_HDR) + cmd.hdr.size;
+            if (cmd.hdr.msg_type == HAS_WRITE_DATA_REQ_TYPE) {
+                offset += cmd.u.write_req.size;
+            }
+            msgTypes.push_back(cmd.hdr.msg_type);
+        }
+        EXPECT_EQ(sentBytes.size(), offset);
+        return msgTypes;
+    }
+
+    DebugManagerStateRestore restorer;
+    VariableBackup<decltype(SysCalls::sysCallsSend)> sendBackup{&SysCalls::sysCallsSend, mockSend};
+    VariableBackup<decltype(SysCalls::sysCallsRecv)> recvBackup{&SysCalls::sysCallsRecv, mockRecv};
+    std::stringstream errStream;
+};
+
+} // namespace
+
+TEST_F(TbxSocketsImpTest, givenDefaultSettingsWhenWritingMemoryThenHeaderAndDataAreSentImmediately) {
+    auto sockets = createConnectedSockets();
+    EXPECT_EQ(0u, sockets->batchSize);
+
+    auto pattern = createPattern(MemoryConstants::pageSize, 1);
+    EXPECT_TRUE(sockets->writeMemory(0x1000, pattern.data(), pattern.size(), 0));
+    EXPECT_TRUE(sockets->writeBatch.empty());
+    EXPECT_EQ(2u, sendCalled);
+
+    ASSERT_EQ(sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ) + pattern.size(), sentBytes.size());
+    EXPECT_EQ(0, memcmp(pattern.data(), sentBytes.data() + sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ), pattern.size()));
+    sockets->close();
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchedWritesWhenWritingGttAndMemoryThenRequestsAreQueuedUntilReadForcesSync) {
+    DebugManager.flags.TbxSocketsBatchWrites.set(1);
+    auto sockets = createConnectedSockets();
+    EXPECT_EQ(TbxSocketsImp::defaultBatchSize, sockets->batchSize);
+
+    constexpr uint32_t pageCount = 16;
+    for (uint32_t page = 0; page < pageCount; page++) {
+        auto pattern = createPattern(MemoryConstants::pageSize, static_cast<uint8_t>(page));
+        EXPECT_TRUE(sockets->writeGTT(page * sizeof(uint64_t), 0x100000000ull + page * MemoryConstants::pageSize));
+        EXPECT_TRUE(sockets->writeMemory(page * MemoryConstants::pageSize, pattern.data(), pattern.size(), 0));
+    }
+    EXPECT_FALSE(sockets->writeBatch.empty());
+    EXPECT_EQ(0u, sendCalled);
+
+    queueMmioResponse(sockets->transID, 0x1234);
+    uint32_t mmioValue = 0;
+    EXPECT_TRUE(sockets->readMMIO(0x2000, &mmioValue));
+    EXPECT_EQ(0x1234u, mmioValue);
+    EXPECT_TRUE(sockets->writeBatch.empty());
+    EXPECT_EQ(1u, sendCalled);
+
+    auto msgTypes = parseSentRequests();
+    ASSERT_EQ(2 * pageCount + 1, msgTypes.size());
+    for (uint32_t page = 0; page < pageCount; page++) {
+        EXPECT_EQ(static_cast<uint32_t>(HAS_GTT_REQ_TYPE), msgTypes[2 * page]);
+        EXPECT_EQ(static_cast<uint32_t>(HAS_WRITE_DATA_REQ_TYPE), msgTypes[2 * page + 1]);
+    }
+    EXPECT_EQ(static_cast<uint32_t>(HAS_MMIO_REQ_TYPE), msgTypes.back());
+    sockets->close();
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchedWritesWhenReadingMemoryThenQueuedWritesAreSentBeforeReadRequest) {
+    DebugManager.flags.TbxSocketsBatchWrites.set(1);
+    auto sockets = createConnectedSockets();
+
+    auto pattern = createPattern(MemoryConstants::pageSize, 5);
+    EXPECT_TRUE(sockets->writeMemory(0x1000, pattern.data(), pattern.size(), 0));
+    EXPECT_EQ(0u, sendCalled);
+
+    queueReadDataResponse(sockets->transID, pattern);
+    std::vector<uint8_t> readBack(pattern.size());
+    EXPECT_TRUE(sockets->readMemory(0x1000, readBack.data(), readBack.size()));
+    EXPECT_EQ(pattern, readBack);
+    EXPECT_EQ(1u, sendCalled);
+
+    auto msgTypes = parseSentRequests();
+    ASSERT_EQ(2u, msgTypes.size());
+    EXPECT_EQ(static_cast<uint32_t>(HAS_WRITE_DATA_REQ_TYPE), msgTypes[0]);
+    EXPECT_EQ(static_cast<uint32_t>(HAS_READ_DATA_REQ_TYPE), msgTypes[1]);
+    sockets->close();
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchedWritesWhenWritingMmioThenBatchIsSentImmediately) {
+    DebugManager.flags.TbxSocketsBatchWrites.set(1);
+    auto sockets = createConnectedSockets();
+
+    EXPECT_TRUE(sockets->writeGTT(0, 0x1000));
+    EXPECT_FALSE(sockets->writeBatch.empty());
+    EXPECT_EQ(0u, sendCalled);
+
+    EXPECT_TRUE(sockets->writeMMIO(0x2000, 0xabcd));
+    EXPECT_TRUE(sockets->writeBatch.empty());
+    EXPECT_EQ(1u, sendCalled);
+
+    auto msgTypes = parseSentRequests();
+    ASSERT_EQ(2u, msgTypes.size());
+    EXPECT_EQ(static_cast<uint32_t>(HAS_GTT_REQ_TYPE), msgTypes[0]);
+    EXPECT_EQ(static_cast<uint32_t>(HAS_MMIO_REQ_TYPE), msgTypes[1]);
+    sockets->close();
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchedWritesWhenBatchIsFullThenQueuedRequestsAreSent) {
+    DebugManager.flags.TbxSocketsBatchWrites.set(1);
+    DebugManager.flags.TbxSocketsBatchSize.set(256);
+    auto sockets = createConnectedSockets();
+    EXPECT_EQ(256u, sockets->batchSize);
+
+    auto pattern = createPattern(128, 7);
+    EXPECT_TRUE(sockets->writeMemory(0x1000, pattern.data(), pattern.size(), 0));
+    auto queuedSize = sockets->writeBatch.size();
+    EXPECT_EQ(sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ) + pattern.size(), queuedSize);
+    EXPECT_EQ(0u, sendCalled);
+
+    EXPECT_TRUE(sockets->writeMemory(0x2000, pattern.data(), pattern.size(), 0));
+    EXPECT_EQ(queuedSize, sockets->writeBatch.size());
+    EXPECT_EQ(1u, sendCalled);
+    EXPECT_EQ(queuedSize, sentBytes.size());
+    sockets->close();
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchedWritesWhenPayloadIsLargerThanBatchThenItIsSentWithoutQueueing) {
+    DebugManager.flags.TbxSocketsBatchWrites.set(1);
+    DebugManager.flags.TbxSocketsBatchSize.set(256);
+    auto sockets = createConnectedSockets();
+
+    auto pattern = createPattern(4 * MemoryConstants::pageSize, 3);
+    EXPECT_TRUE(sockets->writeMemory(0x10000, pattern.data(), pattern.size(), 0));
+    EXPECT_TRUE(sockets->writeBatch.empty());
+    EXPECT_EQ(2u, sendCalled);
+
+    ASSERT_EQ(sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ) + pattern.size(), sentBytes.size());
+    EXPECT_EQ(0, memcmp(pattern.data(), sentBytes.data() + sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ), pattern.size()));
+    sockets->close();
+}
+
+TEST_F(TbxSocketsImpTest, givenPartialSendsWhenFlushingBatchThenRemainingBytesAreSent) {
+    DebugManager.flags.TbxSocketsBatchWrites.set(1);
+    auto sockets = createConnectedSockets();
+
+    auto pattern = createPattern(100, 11);
+    EXPECT_TRUE(sockets->writeMemory(0x1000, pattern.data(), pattern.size(), 0));
+    auto queuedSize = sockets->writeBatch.size();
+
+    maxBytesPerSend = 16u;
+    EXPECT_TRUE(sockets->flushWrites());
+    EXPECT_EQ((queuedSize + maxBytesPerSend - 1) / maxBytesPerSend, sendCalled);
+    EXPECT_EQ(queuedSize, sentBytes.size());
+    sockets->close();
+}
+
+TEST_F(TbxSocketsImpTest, givenBatchedWritesWhenClosingThenQueuedRequestsAreSentBeforeSocketIsClosed) {
+    DebugManager.flags.TbxSocketsBatchWrites.set(1);
+    VariableBackup<uint32_t> closeCalledBackup(&SysCalls::closeFuncCalled, 0u);
+    auto sockets = createConnectedSockets();
+
+    auto pattern = createPattern(64, 9);
+    EXPECT_TRUE(sockets->writeMemory(0x3000, pattern.data(), pattern.size(), 0));
+    EXPECT_FALSE(sockets->writeBatch.empty());
+    EXPECT_EQ(0u, sendCalled);
+
+    sockets->close();
+    EXPECT_TRUE(sockets->writeBatch.empty());
+    EXPECT_EQ(1u, sendCalled);
+    EXPECT_EQ(1u, SysCalls::closeFuncCalled);
+    EXPECT_EQ(0, memcmp(pattern.data(), sentBytes.data() + sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ), pattern.size()));
+}
@@ -993,6 +993,102 @@ TEST_F(PrintFormatterTest, GivenTypeSmallerThan4BThenItIsReadAs4BValue) {
     EXPECT_STREQ(expectedOutput, output);
 }
 
+TEST_F(PrintFormatterTest, GivenMultiplePrintfRecordsWhenPrintingThenOutputIsFlushedWithSinglePrintCall) {
+    auto stringIndex = injectFormatString("value %d\\n");
+    for (int i = 0; i < 3; i++) {
+        storeData(stringIndex);
+        injectValue(i);
+    }
+
+    uint32_t printCalls = 0;
+    std::string output;
+    printFormatter->printKernelOutput([&](char *str) {
+        printCalls++;
+        output += str;
+    });
+
+    EXPECT_EQ(1u, printCalls);
+    EXPECT_STREQ("value 0\nvalue 1\nvalue 2\n", output.c_str());
+}
+
+TEST_F(PrintFormatterTest, GivenFormatCacheWhenSameFormatStringIsPrintedRepeatedlyThenItIsCompiledOnce) {
+    PrintfFormatCache formatCache;
+    printFormatter.reset(new PrintFormatter(static_cast<uint8_t *>(data->getUnderlyingBuffer()), printfBufferSize, is32bit, &kernelInfo->kernelDescriptor.kernelMetadata.printfStringsMap, &formatCache));
+
+    auto intStringIndex = injectFormatString("%d ");
+    auto longStringIndex = injectFormatString("%ld ");
+    for (int i = 0; i < 4; i++) {
+        storeData(intStringIndex);
+        injectValue(i);
+        storeData(longStringIndex);
+        injectValue(static_cast<int64_t>(i) << 32);
+    }
+
+    char referenceOutput[maxPrintfOutputLength];
+    snprintf(referenceOutput, sizeof(referenceOutput), "0 0 1 %lld 2 %lld 3 %lld ", 1ll << 32, 2ll << 32, 3ll << 32);
+
+    std::string output;
+    printFormatter->printKernelOutput([&output](char *str) { output = str; });
+    EXPECT_STREQ(referenceOutput, output.c_str());
+    EXPECT_EQ(2u, formatCache.getCachedProgramsCount());
+
+    printFormatter->printKernelOutput([&output](char *str) { output = str; });
+    EXPECT_STREQ(referenceOutput, output.c_str());
+    EXPECT_EQ(2u, formatCache.getCachedProgramsCount());
+}
+
+TEST_F(PrintFormatterTest, GivenOffsetRangeWhenPrintingKernelOutputRangeThenOnlyRecordsWithinRangeArePrinted) {
+    auto stringIndex = injectFormatString("%d;");
+    uint32_t recordOffsets[4] = {};
+    for (int i = 0; i < 3; i++) {
+        recordOffsets[i] = offset;
+        storeData(stringIndex);
+        injectValue(i);
+    }
+    recordOffsets[3] = offset;
+
+    std::string output;
+    auto endOffset = printFormatter->printKernelOutputRange(recordOffsets[1], recordOffsets[3], [&output](char *str) { output += str; });
+    EXPECT_STREQ("1;2;", output.c_str());
+    EXPECT_EQ(recordOffsets[3], endOffset);
+
+    output.clear();
+    endOffset = printFormatter->printKernelOutputRange(recordOffsets[0], recordOffsets[1], [&output](char *str) { output += str; });
+    EXPECT_STREQ("0;", output.c_str());
+    EXPECT_EQ(recordOffsets[1], endOffset);
+
+    output.clear();
+    endOffset = printFormatter->printKernelOutputRange(recordOffsets[3], recordOffsets[3], [&output](char *str) { output += str; });
+    EXPECT_TRUE(output.empty());
+    EXPECT_EQ(recordOffsets[3], endOffset);
+}
+
+TEST(PrintfFormatCacheTest, GivenFormatStringWhenCompiledThenLiteralsAndConversionsAreSeparated) {
+    PrintfFormatProgram program;
+    PrintfFormatCache::compileFormatString("a%%b %5ld|%v4hld %s\\", program);
+
+    ASSERT_EQ(6u, program.size());
+    EXPECT_FALSE(program[0].isConversion);
+    EXPECT_STREQ("a%b ", program[0].text.c_str());
+
+    EXPECT_TRUE(program[1].isConversion);
+    EXPECT_FALSE(program[1].isStringConversion);
+    EXPECT_STREQ("%5ld", program[1].text.c_str());
+    EXPECT_STREQ("%5lld", program[1].longFormat.c_str());
+
+    EXPECT_STREQ("|", program[2].text.c_str());
+
+    EXPECT_TRUE(program[3].isConversion);
+    EXPECT_STREQ("%d", program[3].vectorFormat.c_str());
+    EXPECT_STREQ("%d", program[3].vectorLongFormat.c_str());
+
+    EXPECT_STREQ(" ", program[4].text.c_str());
+
+    EXPECT_TRUE(program[5].isConversion);
+    EXPECT_TRUE(program[5].isStringConversion);
+    EXPECT_STREQ("%s", program[5].text.c_str());
+}
+
 TEST(printToStdoutTest, GivenStringWhenPrintingToStdoutThenOutputOccurs) {
     testing::internal::CaptureStdout();
     printToStdout("test");